@@ -0,0 +1,150 @@
+///
+/// @file Fast_Canvas.ino
+/// @brief Example of off-screen canvases for fast edition
+///
+/// @details Library for Pervasive Displays EXT3 - Basic level
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.txt for references
+/// @n
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "hV_Canvas.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_LOOPS 20
+#define CANVAS_X 160
+#define CANVAS_Y 48
+
+// Define structures and classes
+
+// Define variables and constants
+Screen_EPD_EXT3_Fast myScreen(eScreen_EPD_271_PS_09, boardRaspberryPiPico_RP2040);
+
+uint8_t bufferHeader[CANVAS_BYTES(CANVAS_X, CANVAS_Y)];
+hV_Canvas myHeader;
+
+// Prototypes
+
+// Utilities
+
+// Functions
+///
+/// @brief Draw the header
+/// @param screen screen or canvas
+/// @param x0 top left coordinate, x-axis
+/// @param y0 top left coordinate, y-axis
+///
+void drawHeader(hV_Screen_Buffer * screen, uint16_t x0, uint16_t y0)
+{
+    screen->setPenSolid(false);
+    screen->selectFont(Font_Terminal8x12);
+    screen->gText(x0 + 4, y0 + 4, "Temperature 21.5 oC");
+    screen->gText(x0 + 4, y0 + 20, "Humidity 45 %");
+    screen->circle(x0 + 140, y0 + 18, 12, myColours.black);
+    screen->line(x0, y0 + CANVAS_Y - 1, x0 + CANVAS_X - 1, y0 + CANVAS_Y - 1, myColours.black);
+}
+
+///
+/// @brief Compare drawing the header against stamping the canvas
+/// @note Results as CSV on the serial console
+///
+void performTest()
+{
+    uint32_t chrono;
+
+    // Canvas with the format of the screen, drawn once
+    myHeader.begin(bufferHeader, CANVAS_X, CANVAS_Y, myScreen.bitmapFormat());
+    myHeader.clear(myColours.white);
+    drawHeader(&myHeader, 0, 0);
+
+    mySerial.println("Method,us");
+
+    chrono = micros();
+    for (uint8_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        drawHeader(&myScreen, 8, 8);
+    }
+    chrono = micros() - chrono;
+    mySerial.println(formatString("Draw,%i", chrono / NUMBER_LOOPS));
+
+    chrono = micros();
+    for (uint8_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        myHeader.stamp(&myScreen, 8, 8, CANVAS_COPY);
+    }
+    chrono = micros() - chrono;
+    mySerial.println(formatString("Stamp copy,%i", chrono / NUMBER_LOOPS));
+
+    chrono = micros();
+    for (uint8_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        myHeader.stamp(&myScreen, 8, 8 + CANVAS_Y, CANVAS_OR);
+    }
+    chrono = micros() - chrono;
+    mySerial.println(formatString("Stamp OR,%i", chrono / NUMBER_LOOPS));
+
+    // Header cut out of a black band
+    myScreen.setPenSolid(true);
+    myScreen.dRectangle(8, 8 + CANVAS_Y * 2, CANVAS_X, CANVAS_Y, myColours.black);
+    myHeader.stamp(&myScreen, 8, 8 + CANVAS_Y * 2, CANVAS_AND_NOT);
+    myScreen.flush();
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    mySerial.println("Canvas");
+    myScreen.clear();
+    performTest();
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
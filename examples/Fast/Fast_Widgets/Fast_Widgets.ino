@@ -0,0 +1,164 @@
+///
+/// @file Fast_Widgets.ino
+/// @brief Example of retained widgets for fast edition
+///
+/// @details Library for Pervasive Displays EXT3 - Basic level
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// @see ReadMe.txt for references
+/// @n
+///
+
+// Screen
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "hV_Widgets.h"
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_STEPS 8
+
+// Define structures and classes
+
+// Define variables and constants
+Screen_EPD_EXT3_Fast myScreen(eScreen_EPD_271_PS_09, boardRaspberryPiPico_RP2040);
+
+hV_Widget_Layer myLayer;
+hV_Widget_Frame myFrame;
+hV_Widget_Label myTitle;
+hV_Widget_Value myTemperature;
+hV_Widget_Bar myBar;
+hV_Widget_Icon myIcon;
+hV_Widget_Label myStatus;
+
+// 8x8 icon, sun
+static const uint8_t iconSun[8] = { 0x24, 0x00, 0x3c, 0xbd, 0x3c, 0x3c, 0x00, 0x24 };
+
+// Prototypes
+
+// Utilities
+
+// Functions
+///
+/// @brief Set the widgets
+///
+void setWidgets()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+
+    // Frames and other containers go first
+    myFrame.setArea(0, 0, x, y);
+    myFrame.setThickness(2);
+    myLayer.add(&myFrame);
+
+    myTitle.setArea(8, 8, x - 16, 16);
+    myTitle.setFont(Font_Terminal12x16);
+    myTitle.setText("Sensor");
+    myLayer.add(&myTitle);
+
+    myIcon.setArea(x - 16, 8, 8, 8);
+    myIcon.setIcon(iconSun, 8, 8);
+    myLayer.add(&myIcon);
+
+    myTemperature.setArea(8, 32, x - 16, 24);
+    myTemperature.setFont(Font_Terminal16x24);
+    myTemperature.setFormat(1, "oC");
+    myLayer.add(&myTemperature);
+
+    myBar.setArea(8, 64, x - 16, 16);
+    myBar.setRange(0, 400);
+    myLayer.add(&myBar);
+
+    myStatus.setArea(8, y - 20, x - 16, 12);
+    myStatus.setFont(Font_Terminal8x12);
+    myLayer.add(&myStatus);
+}
+
+///
+/// @brief Update the values and redraw the dirty widgets only
+///
+void performTest()
+{
+    uint32_t chrono;
+    uint16_t count;
+    area_s area;
+
+    for (uint8_t step = 0; step < NUMBER_STEPS; step += 1)
+    {
+        int32_t value = 180 + step * 15;
+
+        myTemperature.setValue(value);
+        myBar.setValue(value);
+        myStatus.setText(formatString("Step %i/%i", step + 1, NUMBER_STEPS));
+        myIcon.setVisible((step % 2) == 0);
+
+        chrono = millis();
+        count = myLayer.update(&myScreen, &area);
+        chrono = millis() - chrono;
+
+        mySerial.println(formatString("Step %i: %i widgets redrawn in %i ms, area %i.%i-%i.%i", step, count, chrono, area.x1, area.y1, area.x2, area.y2));
+
+        // Flush only when a widget was redrawn
+        if (count > 0)
+        {
+            myScreen.flush();
+        }
+        delay(1000);
+    }
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    mySerial.println("Widgets");
+    myScreen.clear();
+    setWidgets();
+    performTest();
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
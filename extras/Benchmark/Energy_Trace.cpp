@@ -0,0 +1,129 @@
+//
+// Energy_Trace.cpp
+// Host trace of the energy estimator per power profile and update interval
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Energy_Trace.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Energy_Trace
+//   ./Energy_Trace > energy.csv
+//   ./Energy_Trace 343
+//
+// The optional argument selects the screens with the string in their name.
+//
+// For each screen, each power case and each interval, updates the screen NUMBER_UPDATES times
+// with the interval between updates, and reports one CSV line
+// * refresh us, refresh of the last update from getFlushStatistics()
+// * charge uC and energy uJ, last update with the powered idle before, from getFlushStatistics()
+// * total uC, total uJ and idle ms, from getEnergyCounters(), reset before the first update
+//
+// The stand-in panel is never busy, so the refresh only includes the delays of the scripts.
+// The values compare the power profiles, not the actual panels.
+//
+// Power cases, as Power_Trace
+// * none, panelPower not connected, the panel remains powered between updates
+// * auto-GPIO, panelPower connected, POWER_MODE_AUTO with POWER_SCOPE_GPIO_ONLY
+// * auto-bus-GPIO, panelPower connected, POWER_MODE_AUTO with POWER_SCOPE_BUS_GPIO
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define PIN_POWER 22 ///< Pin for panelPower, free on the board
+#define NUMBER_UPDATES 5 ///< Updates per case
+
+struct panel_s
+{
+    eScreen_EPD_t screen;
+    const char * name;
+};
+
+// Screens with embedded fast update, film P, one per family
+static const panel_s panels[] =
+{
+    { eScreen_EPD_271_PS_09, "271-PS-09" },
+    { eScreen_EPD_343_PS_0B, "343-PS-0B" },
+    { eScreen_EPD_969_PS_0B, "969-PS-0B" },
+};
+
+struct case_s
+{
+    const char * name;
+    bool flagPower; ///< panelPower connected
+    uint8_t mode;
+    uint8_t scope;
+};
+
+static const case_s cases[] =
+{
+    { "none", false, POWER_MODE_MANUAL, POWER_SCOPE_NONE },
+    { "auto-GPIO", true, POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY },
+    { "auto-bus-GPIO", true, POWER_MODE_AUTO, POWER_SCOPE_BUS_GPIO },
+};
+
+// Intervals between updates, s
+static const uint16_t intervals[] = { 10, 60, 600 };
+
+int main(int argc, char ** argv)
+{
+    const char * filter = (argc > 1) ? argv[1] : "";
+
+    printf("panel,case,interval s,refresh us,charge uC,energy uJ,total uC,total uJ,idle ms\n");
+
+    for (const panel_s & panel : panels)
+    {
+        if (strstr(panel.name, filter) == 0)
+        {
+            continue;
+        }
+
+        Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(panel.screen, boardRaspberryPiPico_RP2040);
+        pins_t pins = screen->getBoardPins();
+        hostSetPins(pins.panelDC, pins.panelCS, pins.panelCSS);
+
+        for (const case_s & power : cases)
+        {
+            for (uint16_t interval : intervals)
+            {
+                screen->setPanelPowerPin(power.flagPower ? PIN_POWER : NOT_CONNECTED);
+                screen->begin();
+                screen->setPowerProfile(power.mode, power.scope);
+                screen->suspend(power.scope);
+                screen->resetEnergyCounters();
+
+                for (uint8_t update = 0; update < NUMBER_UPDATES; update += 1)
+                {
+                    delay((uint32_t)interval * 1000);
+                    screen->flush();
+                }
+
+                flushStatistics_s statistics = screen->getFlushStatistics();
+                energyCounters_s counters = screen->getEnergyCounters();
+                printf("%s,%s,%i,%u,%.3f,%u,%.3f,%llu,%llu\n", panel.name, power.name, interval,
+                       statistics.refresh, statistics.charge / 1000.0, statistics.energy,
+                       counters.charge / 1000.0, (unsigned long long)counters.energy, (unsigned long long)counters.idle);
+
+                // Release the bus for the next case
+                screen->suspend(POWER_SCOPE_BUS_GPIO);
+            }
+        }
+
+        delete screen;
+    }
+
+    return 0;
+}
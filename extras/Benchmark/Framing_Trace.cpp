@@ -0,0 +1,126 @@
+//
+// Framing_Trace.cpp
+// Host trace of the commands and data sent to the screens
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Framing_Trace.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Framing_Trace
+//   ./Framing_Trace > before.csv
+//   ./Framing_Trace > after.csv
+//   diff before.csv after.csv
+//   ./Framing_Trace 343 20000000 > fast_spi.csv
+//
+// The optional arguments select the screens with the string in their name,
+// and the SPI speed in Hz, set with setSpeedSPI().
+//
+// For each screen, reports one CSV line per phase, begin, global and fast flushes
+// * SPI bytes, bytes sent on 4-wire SPI
+// * GPIO writes, calls to digitalWrite() except for 3-wire SPI
+// * waited ms, time requested by delay() and delayMicroseconds()
+// * signature, hash of the bytes with the levels of panelDC, panelCS and panelCSS
+// * upload us, time for the image data from getFlushStatistics(), with the SPI transfers at the SPI speed
+// * reset us, time for the resets from getFlushStatistics(), as per the timing profile
+// * soft-start us, time for the DC/DC soft-start from getFlushStatistics(), medium and large screens
+//
+// A change of the framing only, like the number of /CS toggles, keeps the signature
+// and changes the GPIO writes.
+// A change of the SPI speed keeps the signature and changes the upload time.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+struct panel_s
+{
+    eScreen_EPD_t screen;
+    const char * name;
+};
+
+// Screens with embedded fast update, film P
+static const panel_s panels[] =
+{
+    { eScreen_EPD_154_PS_0C, "154-PS-0C" },
+    { eScreen_EPD_213_PS_0E, "213-PS-0E" },
+    { eScreen_EPD_266_PS_0C, "266-PS-0C" },
+    { eScreen_EPD_271_PS_09, "271-PS-09" },
+    { eScreen_EPD_287_PS_09, "287-PS-09" },
+    { eScreen_EPD_343_PS_0B, "343-PS-0B" },
+    { eScreen_EPD_370_PS_0C, "370-PS-0C" },
+    { eScreen_EPD_417_PS_0D, "417-PS-0D" },
+    { eScreen_EPD_437_PS_0C, "437-PS-0C" },
+    { eScreen_EPD_969_PS_0B, "969-PS-0B" },
+    { eScreen_EPD_B98_PS_0B, "B98-PS-0B" },
+};
+
+///
+/// @brief Report a phase
+/// @param panel name of the screen
+/// @param phase name of the phase
+/// @param statistics statistics of the screen
+///
+static void report(const char * panel, const char * phase, flushStatistics_s statistics)
+{
+    printf("%s,%s,%u,%u,%.3f,%08x,%u,%u,%u\n", panel, phase, hostTransfers(), hostWrites(), hostWaited() / 1000.0, hostSignature(),
+           statistics.upload, statistics.reset, statistics.softStart);
+}
+
+int main(int argc, char ** argv)
+{
+    const char * filter = (argc > 1) ? argv[1] : "";
+    uint32_t speed = (argc > 2) ? strtoul(argv[2], 0, 10) : SPI_SPEED_DEFAULT;
+
+    printf("panel,phase,SPI bytes,GPIO writes,waited ms,signature,upload us,reset us,soft-start us\n");
+
+    for (const panel_s & panel : panels)
+    {
+        if (strstr(panel.name, filter) == 0)
+        {
+            continue;
+        }
+
+        Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(panel.screen, boardRaspberryPiPico_RP2040);
+        pins_t pins = screen->getBoardPins();
+        hostSetPins(pins.panelDC, pins.panelCS, pins.panelCSS);
+
+        hostReset();
+        screen->begin();
+        report(panel.name, "begin", screen->getFlushStatistics());
+        screen->setSpeedSPI(speed);
+
+        // Same content for every screen
+        screen->setOrientation(0);
+        screen->clear();
+        screen->setPenSolid(true);
+        screen->dRectangle(8, 8, screen->screenSizeX() / 2, screen->screenSizeY() / 2, myColours.black);
+        screen->selectFont(Font_Terminal8x12);
+        screen->gText(4, screen->screenSizeY() - 16, "PDLS");
+
+        hostReset();
+        screen->flushMode(UPDATE_GLOBAL);
+        report(panel.name, "global", screen->getFlushStatistics());
+
+        hostReset();
+        screen->flush();
+        report(panel.name, "fast", screen->getFlushStatistics());
+
+        delete screen;
+    }
+
+    return 0;
+}
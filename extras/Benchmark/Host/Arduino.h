@@ -0,0 +1,123 @@
+///
+/// @file Arduino.h
+/// @brief Stand-in for the Arduino core, host benchmark only
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Only the functions used by the library are provided.
+/// Time waited with delay() is counted but not spent, GPIO and SPI are emulated by Host_HAL.cpp.
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// SDK
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+///
+/// @name Pins
+/// @{
+#define HIGH 0x01 ///< High level
+#define LOW 0x00 ///< Low level
+#define INPUT 0x00 ///< Input
+#define OUTPUT 0x01 ///< Output
+#define INPUT_PULLUP 0x02 ///< Input with pull-up
+#define SCK 18 ///< SPI clock
+#define MOSI 19 ///< SPI data out, also 3-wire SPI data
+#define MISO 16 ///< SPI data in
+#define LED_BUILTIN 25 ///< Built-in LED
+/// @}
+
+///
+/// @name SPI options
+/// @{
+#define MSBFIRST 1 ///< Most significant bit first
+#define LSBFIRST 0 ///< Least significant bit first
+#define SPI_MODE0 0x00 ///< Mode 0
+/// @}
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+///
+/// @name Bits
+/// @{
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+/// @}
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+uint32_t millis();
+uint32_t micros();
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh);
+
+///
+/// @brief Subset of Arduino String
+///
+class String
+{
+  public:
+    String(const char * text = "") : s_text(text ? text : "") {}
+    String(const std::string & text) : s_text(text) {}
+    String(char character) : s_text(1, character) {}
+    String(int value) : s_text(std::to_string(value)) {}
+    String(unsigned int value) : s_text(std::to_string(value)) {}
+    String(long value) : s_text(std::to_string(value)) {}
+    String(unsigned long value) : s_text(std::to_string(value)) {}
+
+    unsigned int length() const { return s_text.size(); }
+    char charAt(unsigned int index) const { return (index < s_text.size()) ? s_text[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    const char * c_str() const { return s_text.c_str(); }
+    unsigned char reserve(unsigned int size) { s_text.reserve(size); return 1; }
+    void toCharArray(char * buffer, unsigned int size) const { if (size > 0) { size_t count = std::min((size_t)size - 1, s_text.size()); memcpy(buffer, s_text.data(), count); buffer[count] = 0; } }
+    String substring(unsigned int from, unsigned int to) const { return String(s_text.substr(from, to - from)); }
+    String substring(unsigned int from) const { return String(s_text.substr(from)); }
+    String & operator+=(const String & other) { s_text += other.s_text; return *this; }
+    friend String operator+(const String & left, const String & right) { return String(left.s_text + right.s_text); }
+    bool operator==(const String & other) const { return s_text == other.s_text; }
+
+  private:
+    std::string s_text;
+};
+
+///
+/// @brief Serial console, messages printed with HOST_VERBOSE set
+///
+class HardwareSerial
+{
+  public:
+    void begin(long speed) { (void)speed; }
+    void flush() { fflush(stdout); }
+    void print(const String & text) { if (getenv("HOST_VERBOSE")) fputs(text.c_str(), stdout); }
+    void print(const char * text) { if (getenv("HOST_VERBOSE")) fputs(text, stdout); }
+    void println() { print("\n"); }
+    void println(const String & text) { print(text); println(); }
+    void println(const char * text) { print(text); println(); }
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
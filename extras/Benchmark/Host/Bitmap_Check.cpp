@@ -0,0 +1,182 @@
+//
+// Bitmap_Check.cpp
+// Host check and benchmark of the monochrome bitmaps
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/Bitmap_Check.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Bitmap_Check
+//   ./Bitmap_Check
+//
+// The reference decodes each bit of the bitmap and draws it with point().
+//
+// For each orientation and format, draws NUMBER_CASES random bitmaps and reports one CSV line
+// * cases, number of bitmaps with random size, stride, position, colours, transparency and viewport
+// * errors, pixels different between drawBitmap() and the reference
+// * bitmap ns, processor time of drawBitmap()
+// * reference ns, processor time of the reference
+//
+// The positions include bitmaps across the edges of the screen and of a viewport with a clip rectangle.
+// Ends with the number of errors, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_CASES 200 ///< Bitmaps per orientation and format
+#define SIZE_MAX_BITMAP 72 ///< Maximum width and height
+
+typedef std::chrono::steady_clock timer;
+
+static uint8_t imageBitmap[(304 / 8) * 400]; // 4.17" screen, any orientation
+static uint8_t imageReference[(304 / 8) * 400];
+static uint8_t bitmap[(SIZE_MAX_BITMAP / 8 + 3) * SIZE_MAX_BITMAP];
+
+static const char * formats[] = { "row MSB", "row LSB", "column MSB", "column LSB" };
+
+///
+/// @brief Read a bit of the bitmap, as documented for drawBitmap()
+///
+static bool getBit(uint16_t i, uint16_t j, uint16_t stride, uint8_t format)
+{
+    bool flagColumn = ((format & BITMAP_COLUMN_MSB) == BITMAP_COLUMN_MSB);
+    bool flagLSB = ((format & BITMAP_ROW_LSB) == BITMAP_ROW_LSB);
+    uint16_t line = flagColumn ? i : j; // Major axis
+    uint16_t bit = flagColumn ? j : i; // Minor axis
+    uint8_t value = bitmap[(uint32_t)line * stride + bit / 8];
+
+    return flagLSB ? bitRead(value, bit % 8) : bitRead(value, 7 - (bit % 8));
+}
+
+///
+/// @brief Count the pixels set in one image and not in the other
+///
+static uint32_t difference(const uint8_t * image1, const uint8_t * image2, uint32_t size)
+{
+    uint32_t result = 0;
+
+    for (uint32_t index = 0; index < size; index += 1)
+    {
+        result += __builtin_popcount(image1[index] ^ image2[index]);
+    }
+
+    return result;
+}
+
+int main()
+{
+    uint32_t errors = 0;
+
+    Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(eScreen_EPD_417_PS_0D, boardRaspberryPiPico_RP2040);
+    screen->begin();
+    srand(821);
+
+    printf("orientation,format,cases,errors,bitmap ns,reference ns\n");
+
+    for (uint8_t orientation = 0; orientation < 4; orientation += 1)
+    {
+        screen->setOrientation(orientation);
+        int16_t sizeX = screen->screenSizeX();
+        int16_t sizeY = screen->screenSizeY();
+        uint32_t sizeImage = (uint32_t)(sizeX + 7) / 8 * sizeY;
+
+        for (uint8_t format = BITMAP_ROW_MSB; format <= BITMAP_COLUMN_LSB; format += 1)
+        {
+            uint32_t formatErrors = 0;
+            double bitmapNs = 0;
+            double referenceNs = 0;
+            bool flagColumn = ((format & BITMAP_COLUMN_MSB) == BITMAP_COLUMN_MSB);
+
+            for (uint16_t index = 0; index < NUMBER_CASES; index += 1)
+            {
+                uint16_t dx = 1 + rand() % SIZE_MAX_BITMAP;
+                uint16_t dy = 1 + rand() % SIZE_MAX_BITMAP;
+                uint16_t minimum = flagColumn ? (dy + 7) / 8 : (dx + 7) / 8;
+                uint16_t stride = minimum + rand() % 3; // Padded lines
+                uint16_t strideArgument = (stride == minimum) ? 0 : stride; // 0 = deduced
+                int16_t x0 = rand() % (sizeX + SIZE_MAX_BITMAP) - SIZE_MAX_BITMAP / 2;
+                int16_t y0 = rand() % (sizeY + SIZE_MAX_BITMAP) - SIZE_MAX_BITMAP / 2;
+                bool flagBlack = rand() % 2;
+                uint16_t frontColour = flagBlack ? myColours.black : myColours.white;
+                uint16_t backColour = flagBlack ? myColours.white : myColours.black;
+                uint16_t clearColour = (rand() % 2) ? myColours.black : myColours.white;
+                bool flagTransparent = rand() % 2;
+                bool flagViewport = (rand() % 4) == 0;
+                int16_t vx = rand() % (sizeX / 2);
+                int16_t vy = rand() % (sizeY / 2);
+
+                for (uint16_t k = 0; k < sizeof(bitmap); k += 1)
+                {
+                    bitmap[k] = rand() & 0xff;
+                }
+
+                for (uint8_t pass = 0; pass < 2; pass += 1)
+                {
+                    screen->clear(clearColour);
+                    if (flagViewport)
+                    {
+                        screen->pushViewport(vx, vy, sizeX / 2, sizeY / 2);
+                        screen->setClip(8, 8, sizeX / 2 - 24, sizeY / 2 - 24);
+                    }
+
+                    auto start = timer::now();
+                    if (pass == 0)
+                    {
+                        screen->drawBitmap(x0, y0, dx, dy, bitmap, strideArgument, frontColour, backColour, flagTransparent, format);
+                        bitmapNs += std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+                    }
+                    else
+                    {
+                        for (uint16_t j = 0; j < dy; j += 1)
+                        {
+                            for (uint16_t i = 0; i < dx; i += 1)
+                            {
+                                if (getBit(i, j, stride, format))
+                                {
+                                    screen->point(x0 + i, y0 + j, frontColour);
+                                }
+                                else if (not flagTransparent)
+                                {
+                                    screen->point(x0 + i, y0 + j, backColour);
+                                }
+                            }
+                        }
+                        referenceNs += std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+                    }
+
+                    if (flagViewport)
+                    {
+                        screen->popViewport();
+                    }
+                    screen->exportImage((pass == 0) ? imageBitmap : imageReference);
+                }
+
+                formatErrors += difference(imageBitmap, imageReference, sizeImage);
+            }
+
+            errors += (formatErrors > 0) ? 1 : 0;
+            printf("%i,%s,%u,%u,%.0f,%.0f\n", orientation, formats[format], NUMBER_CASES, formatErrors,
+                   bitmapNs / NUMBER_CASES, referenceNs / NUMBER_CASES);
+        }
+    }
+
+    delete screen;
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
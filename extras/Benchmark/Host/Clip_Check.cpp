@@ -0,0 +1,265 @@
+//
+// Clip_Check.cpp
+// Host check and benchmark of the clip rectangle and the viewports
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/Clip_Check.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Clip_Check
+//   ./Clip_Check
+//
+// The reference draws the primitive without viewport, then keeps only the pixels inside the clip rectangle.
+// The primitives lie inside the screen, so the reference is not trimmed.
+//
+// For each orientation and primitive, draws NUMBER_CASES random primitives and reports one CSV line
+// * cases, number of primitives with random coordinates, colours, viewport and clip rectangle
+// * errors, pixels different between the clipped primitive and the reference
+// * clipped ns, processor time of the primitive inside the viewport with the clip rectangle
+// * unclipped ns, processor time of the primitive without viewport
+//
+// The viewports may go beyond the screen and the clip rectangles beyond the viewports,
+// so the coordinates relative to the viewport may be negative.
+// Ends with the number of errors, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_CASES 200 ///< Primitives per orientation and kind
+#define RADIUS_MAX 60 ///< Maximum radius of the circles
+
+typedef std::chrono::steady_clock timer;
+
+static uint8_t imageClipped[(304 / 8) * 400]; // 4.17" screen, any orientation
+static uint8_t imageUnclipped[(304 / 8) * 400];
+static uint8_t imageClear[(304 / 8) * 400];
+
+enum primitive_e
+{
+    primitivePoint,
+    primitiveLine,
+    primitiveSpan,
+    primitiveRectangle,
+    primitiveCircle,
+    primitiveTriangle,
+    primitiveMax
+};
+
+static const char * primitives[] = { "point", "line", "span", "rectangle", "circle", "triangle" };
+
+///
+/// @brief Random coordinate inside the screen
+///
+static int16_t inside(int16_t size)
+{
+    return rand() % size;
+}
+
+///
+/// @brief Draw a primitive
+/// @param screen screen
+/// @param kind primitive
+/// @param x coordinates, x-axis, relative to the viewport
+/// @param y coordinates, y-axis, relative to the viewport
+/// @param radius radius of the circle
+/// @param colour colour
+///
+static void draw(Screen_EPD_EXT3_Fast * screen, uint8_t kind, const int16_t * x, const int16_t * y, uint16_t radius, uint16_t colour)
+{
+    switch (kind)
+    {
+        case primitivePoint:
+
+            screen->point(x[0], y[0], colour);
+            break;
+
+        case primitiveLine:
+
+            screen->line(x[0], y[0], x[1], y[1], colour);
+            break;
+
+        case primitiveSpan:
+
+            screen->line(x[0], y[0], x[1], y[0], colour);
+            screen->line(x[2], y[1], x[2], y[2], colour);
+            break;
+
+        case primitiveRectangle:
+
+            screen->rectangle(x[0], y[0], x[1], y[1], colour);
+            break;
+
+        case primitiveCircle:
+
+            screen->circle(x[0], y[0], radius, colour);
+            break;
+
+        case primitiveTriangle:
+
+            screen->triangle(x[0], y[0], x[1], y[1], x[2], y[2], colour);
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+///
+/// @brief Keep the pixels of the image inside the clip rectangle, the others from the cleared image
+/// @note The clip rectangle is in screen coordinates, bounds included
+///
+static void mask(uint8_t * image, uint16_t sizeX, uint16_t sizeY, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    uint16_t stride = (sizeX + 7) / 8;
+
+    for (uint16_t y = 0; y < sizeY; y += 1)
+    {
+        for (uint16_t x = 0; x < sizeX; x += 1)
+        {
+            if ((x < x1) or (x > x2) or (y < y1) or (y > y2))
+            {
+                uint32_t index = (uint32_t)y * stride + x / 8;
+                uint8_t bit = 0x80 >> (x % 8);
+                image[index] = (image[index] & ~bit) | (imageClear[index] & bit);
+            }
+        }
+    }
+}
+
+///
+/// @brief Count the pixels set in one image and not in the other
+///
+static uint32_t difference(const uint8_t * image1, const uint8_t * image2, uint32_t size)
+{
+    uint32_t result = 0;
+
+    for (uint32_t index = 0; index < size; index += 1)
+    {
+        result += __builtin_popcount(image1[index] ^ image2[index]);
+    }
+
+    return result;
+}
+
+int main()
+{
+    uint32_t errors = 0;
+
+    Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(eScreen_EPD_417_PS_0D, boardRaspberryPiPico_RP2040);
+    screen->begin();
+    srand(821);
+
+    printf("orientation,primitive,cases,errors,clipped ns,unclipped ns\n");
+
+    for (uint8_t orientation = 0; orientation < 4; orientation += 1)
+    {
+        screen->setOrientation(orientation);
+        int16_t sizeX = screen->screenSizeX();
+        int16_t sizeY = screen->screenSizeY();
+        uint32_t sizeImage = (uint32_t)(sizeX + 7) / 8 * sizeY;
+
+        for (uint8_t kind = 0; kind < primitiveMax; kind += 1)
+        {
+            uint32_t kindErrors = 0;
+            double clippedNs = 0;
+            double unclippedNs = 0;
+
+            for (uint16_t index = 0; index < NUMBER_CASES; index += 1)
+            {
+                // Primitive, screen coordinates
+                int16_t x[3];
+                int16_t y[3];
+                uint16_t radius = 0;
+
+                for (uint8_t k = 0; k < 3; k += 1)
+                {
+                    x[k] = inside(sizeX);
+                    y[k] = inside(sizeY);
+                }
+                if (kind == primitiveCircle)
+                {
+                    radius = rand() % RADIUS_MAX;
+                    x[0] = radius + inside(sizeX - 2 * radius);
+                    y[0] = radius + inside(sizeY - 2 * radius);
+                }
+
+                uint16_t colour = (rand() % 2) ? myColours.black : myColours.white;
+                uint16_t clearColour = (rand() % 2) ? myColours.black : myColours.white;
+                bool flagSolid = rand() % 2;
+
+                // Viewport, possibly beyond the screen
+                int16_t vx = inside(sizeX / 2);
+                int16_t vy = inside(sizeY / 2);
+                int16_t vdx = 1 + rand() % (sizeX - vx + 32);
+                int16_t vdy = 1 + rand() % (sizeY - vy + 32);
+
+                // Clip rectangle relative to the viewport, possibly beyond the viewport
+                int16_t cx = rand() % (vdx + 16) - 16;
+                int16_t cy = rand() % (vdy + 16) - 16;
+                int16_t cdx = 1 + rand() % (vdx + 16);
+                int16_t cdy = 1 + rand() % (vdy + 16);
+
+                // Reference, no viewport
+                screen->clear(clearColour);
+                screen->exportImage(imageClear);
+                screen->setPenSolid(flagSolid);
+                auto start = timer::now();
+                draw(screen, kind, x, y, radius, colour);
+                unclippedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+                screen->exportImage(imageUnclipped);
+
+                int32_t x1 = hV_HAL_max(vx + cx, vx);
+                int32_t y1 = hV_HAL_max(vy + cy, vy);
+                int32_t x2 = hV_HAL_min(hV_HAL_min(vx + cx + cdx - 1, vx + vdx - 1), sizeX - 1);
+                int32_t y2 = hV_HAL_min(hV_HAL_min(vy + cy + cdy - 1, vy + vdy - 1), sizeY - 1);
+                mask(imageUnclipped, sizeX, sizeY, x1, y1, x2, y2);
+
+                // Clipped, coordinates relative to the viewport
+                int16_t lx[3];
+                int16_t ly[3];
+                for (uint8_t k = 0; k < 3; k += 1)
+                {
+                    lx[k] = x[k] - vx;
+                    ly[k] = y[k] - vy;
+                }
+
+                screen->clear(clearColour);
+                screen->setPenSolid(flagSolid);
+                screen->pushViewport(vx, vy, vdx, vdy);
+                screen->setClip(cx, cy, cdx, cdy);
+                start = timer::now();
+                draw(screen, kind, lx, ly, radius, colour);
+                clippedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+                screen->popViewport();
+                screen->exportImage(imageClipped);
+
+                kindErrors += difference(imageClipped, imageUnclipped, sizeImage);
+            }
+
+            errors += (kindErrors > 0) ? 1 : 0;
+            printf("%i,%s,%u,%u,%.0f,%.0f\n", orientation, primitives[kind], NUMBER_CASES, kindErrors,
+                   clippedNs / NUMBER_CASES, unclippedNs / NUMBER_CASES);
+        }
+    }
+
+    delete screen;
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
@@ -0,0 +1,239 @@
+//
+// DisplayList_Check.cpp
+// Host check and benchmark of the display list
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/DisplayList_Check.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o DisplayList_Check
+//   ./DisplayList_Check
+//
+// For each orientation, records a scene of random primitives and reports one CSV line
+// * records and bytes, size of the display list
+// * record ns, replay ns, processor time per record
+// * band errors, pixels different between replay() and replayBand() per band of BAND_ROWS rows
+// * areas, areas found by compare() after a change of one text and one pen state
+// * area errors, changed pixels outside the areas found
+//
+// Ends with the number of errors, also returned as exit code.
+// The errors include compare() of identical lists with areas,
+// and compare() missing a change of the pen or font states before identical records.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "hV_Display_List.h"
+#include "Host_HAL.h"
+
+#define NUMBER_SHAPES 48 ///< Random primitives per scene
+#define BAND_ROWS 24 ///< Rows per band
+#define NUMBER_REPEAT 200 ///< Repeats for timing
+#define NUMBER_AREAS 32 ///< Size of the areas array
+
+typedef std::chrono::steady_clock timer;
+
+static uint8_t bufferNew[4096];
+static uint8_t bufferOld[4096];
+static uint8_t imageA[(304 / 8) * 400]; // 4.17" screen, any orientation
+static uint8_t imageB[(304 / 8) * 400];
+
+///
+/// @brief Record a scene of random primitives
+/// @param list display list
+/// @param orientation orientation
+/// @param sizeX size of the screen, x-axis
+/// @param sizeY size of the screen, y-axis
+/// @param seed seed for the random primitives
+/// @param flagChange true = one text and one pen state changed
+///
+static void record(hV_Display_List & list, uint8_t orientation, uint16_t sizeX, uint16_t sizeY, uint16_t seed, bool flagChange)
+{
+    char text[16];
+    bool flagFlip = flagChange; // Pen state to change once
+
+    srand(seed);
+    list.reset();
+    list.setOrientation(orientation);
+    list.clear(myColours.white);
+    list.setFontSolid(false);
+
+    for (uint8_t index = 0; index < NUMBER_SHAPES; index += 1)
+    {
+        uint16_t x1 = rand() % sizeX;
+        uint16_t y1 = rand() % sizeY;
+        uint16_t x2 = rand() % sizeX;
+        uint16_t y2 = rand() % sizeY;
+        uint16_t colour = (rand() % 2) ? myColours.black : myColours.white;
+
+        switch (rand() % 6)
+        {
+            case 0:
+
+                list.line(x1, y1, x2, y2, colour);
+                break;
+
+            case 1:
+            {
+                // Same bytes for the rectangle, pen state changed before
+                bool flagSolid = (rand() % 2);
+                if (flagFlip and (index >= NUMBER_SHAPES / 2))
+                {
+                    flagSolid = not flagSolid;
+                    flagFlip = false;
+                }
+                list.setPenSolid(flagSolid);
+                list.rectangle(x1, y1, x1 + x2 % 40, y1 + y2 % 30, colour);
+                break;
+            }
+
+            case 2:
+
+                list.circle(x1, y1, 1 + x2 % 20, colour);
+                break;
+
+            case 3:
+
+                list.triangle(x1, y1, x2, y2, (x1 + x2) / 2, (y1 + 3 * y2) / 4, colour);
+                break;
+
+            case 4:
+
+                list.selectFont(rand() % 4);
+                list.setFontSpaceX(rand() % 3);
+                snprintf(text, sizeof(text), "T%u", (flagChange and (index > NUMBER_SHAPES / 2)) ? 9999 - index : index);
+                list.gText(x1 % (sizeX / 2), y1 % (sizeY - 24), text, colour, myColours.white);
+                break;
+
+            default:
+
+                list.selectFont(rand() % 2);
+                snprintf(text, sizeof(text), "%u", index);
+                list.gTextLarge(x1 % (sizeX / 2), y1 % (sizeY - 48), text, colour, myColours.white);
+                break;
+        }
+    }
+}
+
+///
+/// @brief Count the pixels set in one image and not in the other
+///
+static uint32_t difference(const uint8_t * image1, const uint8_t * image2, uint32_t size)
+{
+    uint32_t result = 0;
+
+    for (uint32_t index = 0; index < size; index += 1)
+    {
+        result += __builtin_popcount(image1[index] ^ image2[index]);
+    }
+
+    return result;
+}
+
+int main()
+{
+    uint32_t errors = 0;
+
+    Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(eScreen_EPD_417_PS_0D, boardRaspberryPiPico_RP2040);
+    screen->begin();
+
+    hV_Display_List listNew;
+    hV_Display_List listOld;
+    listNew.begin(bufferNew, sizeof(bufferNew));
+    listOld.begin(bufferOld, sizeof(bufferOld));
+
+    printf("orientation,records,bytes,record ns,replay ns,band errors,areas,area errors\n");
+
+    for (uint8_t orientation = 0; orientation < 4; orientation += 1)
+    {
+        screen->setOrientation(orientation);
+        uint16_t sizeX = screen->screenSizeX();
+        uint16_t sizeY = screen->screenSizeY();
+        uint32_t sizeImage = (uint32_t)(sizeX + 7) / 8 * sizeY;
+
+        // Record
+        auto start = timer::now();
+        for (uint16_t repeat = 0; repeat < NUMBER_REPEAT; repeat += 1)
+        {
+            record(listOld, orientation, sizeX, sizeY, 821, false);
+        }
+        double recordNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count() / NUMBER_REPEAT / listOld.getCount();
+        errors += listOld.getOverflow() ? 1 : 0;
+
+        // Replay, reference
+        start = timer::now();
+        for (uint16_t repeat = 0; repeat < NUMBER_REPEAT; repeat += 1)
+        {
+            listOld.replay(screen);
+        }
+        double replayNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count() / NUMBER_REPEAT / listOld.getCount();
+        screen->exportImage(imageA);
+
+        // Replay per band, bands drawn previously not erased by clear()
+        screen->clear(myColours.black);
+        for (uint16_t y = 0; y < sizeY; y += BAND_ROWS)
+        {
+            listOld.replayBand(screen, y, y + BAND_ROWS - 1);
+        }
+        screen->exportImage(imageB);
+        uint32_t bandErrors = difference(imageA, imageB, sizeImage);
+        errors += (bandErrors > 0) ? 1 : 0;
+
+        // Identical lists
+        area_s areas[NUMBER_AREAS];
+        record(listNew, orientation, sizeX, sizeY, 821, false);
+        errors += (listNew.compare(listOld, areas, NUMBER_AREAS, screen) > 0) ? 1 : 0;
+
+        // Changed text and pen state
+        record(listNew, orientation, sizeX, sizeY, 821, true);
+        uint16_t number = listNew.compare(listOld, areas, NUMBER_AREAS, screen);
+        errors += (number == 0) ? 1 : 0;
+
+        listNew.replay(screen);
+        screen->exportImage(imageB);
+
+        // Changed pixels outside the areas
+        uint32_t areaErrors = 0;
+        for (uint16_t y = 0; y < sizeY; y += 1)
+        {
+            for (uint16_t x = 0; x < sizeX; x += 1)
+            {
+                uint32_t index = (uint32_t)y * ((sizeX + 7) / 8) + x / 8;
+                if (((imageA[index] ^ imageB[index]) & (0x80 >> (x % 8))) == 0)
+                {
+                    continue;
+                }
+
+                bool flagInside = false;
+                for (uint16_t area = 0; area < number; area += 1)
+                {
+                    flagInside = flagInside or ((x >= areas[area].x1) and (x <= areas[area].x2) and (y >= areas[area].y1) and (y <= areas[area].y2));
+                }
+                areaErrors += flagInside ? 0 : 1;
+            }
+        }
+        errors += (areaErrors > 0) ? 1 : 0;
+
+        printf("%i,%u,%u,%.1f,%.1f,%u,%u,%u\n", orientation, listOld.getCount(), listOld.getSize(),
+               recordNs, replayNs, bandErrors, number, areaErrors);
+    }
+
+    delete screen;
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
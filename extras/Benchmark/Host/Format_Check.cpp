@@ -0,0 +1,120 @@
+//
+// Format_Check.cpp
+// Host check and benchmark of the formatting and conversion utilities
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/Format_Check.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Format_Check
+//   ./Format_Check
+//
+// Checks the truncation of formatBuffer(), formatString() and utf2iso() with buffer,
+// one CSV line per case with the result, the expected result and the status.
+// Then reports the processor time per call of formatString() and formatBuffer().
+//
+// Ends with the number of errors, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_REPEAT 100000 ///< Calls for timing
+
+typedef std::chrono::steady_clock timer;
+
+static uint32_t errors = 0;
+
+///
+/// @brief Compare a result with the expected one
+/// @param name name of the case
+/// @param length length returned
+/// @param lengthExpected length expected
+/// @param text string written
+/// @param textExpected string expected
+///
+static void check(const char * name, size_t length, size_t lengthExpected, const char * text, const char * textExpected)
+{
+    bool flagOK = (length == lengthExpected) and (strcmp(text, textExpected) == 0);
+
+    errors += flagOK ? 0 : 1;
+    printf("%s,%u,%u,\"%s\",\"%s\",%s\n", name, (uint32_t)length, (uint32_t)lengthExpected, text, textExpected, flagOK ? "OK" : "ERROR");
+}
+
+int main()
+{
+    char buffer[16];
+    char large[200];
+
+    printf("case,length,expected length,text,expected text,status\n");
+
+    // formatBuffer()
+    memset(buffer, 'x', sizeof(buffer));
+    check("formatBuffer fit", formatBuffer(buffer, sizeof(buffer), "%i-%s", 42, "abc"), 6, buffer, "42-abc");
+
+    memset(buffer, 'x', sizeof(buffer));
+    check("formatBuffer exact", formatBuffer(buffer, 8, "%s", "1234567"), 7, buffer, "1234567");
+
+    memset(buffer, 'x', sizeof(buffer));
+    check("formatBuffer truncated", formatBuffer(buffer, 8, "%s", "123456789"), 9, buffer, "1234567");
+
+    memset(buffer, 'x', sizeof(buffer));
+    check("formatBuffer size 1", formatBuffer(buffer, 1, "%s", "abc"), 3, buffer, "");
+
+    buffer[0] = 'x';
+    buffer[1] = 0x00;
+    check("formatBuffer size 0", formatBuffer(buffer, 0, "%s", "abc"), 0, buffer, "x");
+
+    // formatString(), truncated to 127 characters
+    memset(large, 'a', sizeof(large));
+    large[150] = 0x00;
+    String result = formatString("%s", large);
+    large[127] = 0x00;
+    check("formatString truncated", result.length(), 127, result.c_str(), large);
+
+    // utf2iso(), into buffer
+    memset(buffer, 'x', sizeof(buffer));
+    check("utf2iso fit", utf2iso("caf\xc3\xa9 \xe2\x82\xac", buffer, sizeof(buffer)), 6, buffer, "caf\xe9 \x80");
+
+    memset(buffer, 'x', sizeof(buffer));
+    check("utf2iso truncated", utf2iso("\xc3\xa9t\xc3\xa9 \xc3\xa0", buffer, 4), 3, buffer, "\xe9t\xe9");
+
+    memset(buffer, 'x', sizeof(buffer));
+    check("utf2iso invalid", utf2iso("a\x80\xc3z", buffer, sizeof(buffer)), 2, buffer, "az");
+
+    // Throughput
+    volatile uint32_t sink = 0;
+    auto start = timer::now();
+    for (uint32_t repeat = 0; repeat < NUMBER_REPEAT; repeat += 1)
+    {
+        sink += formatString("T=%i.%i oC", repeat % 50, repeat % 10).length();
+    }
+    double stringNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count() / NUMBER_REPEAT;
+
+    start = timer::now();
+    for (uint32_t repeat = 0; repeat < NUMBER_REPEAT; repeat += 1)
+    {
+        sink += formatBuffer(buffer, sizeof(buffer), "T=%i.%i oC", repeat % 50, repeat % 10);
+    }
+    double bufferNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count() / NUMBER_REPEAT;
+
+    printf("# formatString ns, %.1f\n", stringNs);
+    printf("# formatBuffer ns, %.1f\n", bufferNs);
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+//
+// Group_Benchmark.cpp
+// Host benchmark of the group of screens, grouped against sequential flushes
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/Group_Benchmark.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Group_Benchmark
+//   ./Group_Benchmark
+//
+// Up to SCREEN_GROUP_MAX 2.71" screens share the SPI bus, each with its own panelCS and panelBusy pins.
+// The stand-in panels hold busy low for the refresh time after the Display Refresh command.
+//
+// For each refresh time and each number of screens, reports one CSV line
+// * upload ms, wall time of one flush() minus the refresh time, including the polling of the busy pin
+// * sequential ms, wall time of flush() for each screen in turn
+// * group ms, wall time of flush() for the group
+// * target ms, one refresh plus one upload per screen
+// * gain, sequential / group
+//
+// Wall time is the time counted by the stand-in hardware, delays and SPI transfers.
+// Ends with the number of errors, also returned as exit code.
+// An error is a group wall time greater than the target plus one polling period per screen,
+// or a different number of bytes sent.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_SCREENS 3 ///< Screens, up to SCREEN_GROUP_MAX
+#define POLLING_MS 32 ///< Polling period of the busy pin
+
+// Distinct panelCS and panelBusy pins, other pins shared
+static const uint8_t pinsCS[NUMBER_SCREENS] = { 20, 21, 22 };
+static const uint8_t pinsBusy[NUMBER_SCREENS] = { 23, 24, 25 };
+
+// Refresh times, ms
+static const uint16_t refreshes[] = { 300, 1000, 2000 };
+
+///
+/// @brief Wall time
+/// @return ms since hostReset()
+///
+static double wallTime()
+{
+    return (hostWaited() + hostBus()) / 1000.0;
+}
+
+int main()
+{
+    uint32_t errors = 0;
+    Screen_EPD_EXT3_Fast * screens[NUMBER_SCREENS];
+
+    for (uint8_t index = 0; index < NUMBER_SCREENS; index += 1)
+    {
+        pins_t board = boardRaspberryPiPico_RP2040;
+        board.panelCS = pinsCS[index];
+        board.panelBusy = pinsBusy[index];
+        screens[index] = new Screen_EPD_EXT3_Fast(eScreen_EPD_271_PS_09, board);
+    }
+    hostSetPins(boardRaspberryPiPico_RP2040.panelDC, pinsCS[0], NOT_CONNECTED);
+
+    printf("refresh ms,screens,upload ms,sequential ms,group ms,target ms,gain\n");
+
+    for (uint16_t refresh : refreshes)
+    {
+        for (uint8_t index = 0; index < NUMBER_SCREENS; index += 1)
+        {
+            hostSetRefresh(pinsCS[index], pinsBusy[index], (uint32_t)refresh * 1000);
+        }
+
+        for (uint8_t number = 1; number <= NUMBER_SCREENS; number += 1)
+        {
+            Screen_EPD_EXT3_Group group;
+            for (uint8_t index = 0; index < number; index += 1)
+            {
+                group.add(screens[index]);
+            }
+            group.begin();
+
+            // Upload, one screen
+            screens[0]->clear();
+            hostReset();
+            screens[0]->flush();
+            double upload = wallTime() - refresh;
+
+            // Sequential, same images
+            for (uint8_t index = 0; index < number; index += 1)
+            {
+                screens[index]->clear();
+                screens[index]->gText(8, 8 + 8 * index, "Group");
+            }
+            hostReset();
+            for (uint8_t index = 0; index < number; index += 1)
+            {
+                screens[index]->flush();
+            }
+            double sequential = wallTime();
+            uint32_t transfers = hostTransfers();
+
+            // Grouped, same images
+            for (uint8_t index = 0; index < number; index += 1)
+            {
+                screens[index]->clear();
+                screens[index]->gText(8, 8 + 8 * index, "Group");
+            }
+            hostReset();
+            group.flush();
+            double grouped = wallTime();
+
+            double target = refresh + number * upload;
+            errors += (grouped > target + number * POLLING_MS) ? 1 : 0;
+            errors += (hostTransfers() != transfers) ? 1 : 0;
+
+            printf("%u,%u,%.1f,%.1f,%.1f,%.1f,%.2f\n", refresh, number, upload, sequential, grouped, target, sequential / grouped);
+        }
+    }
+
+    for (uint8_t index = 0; index < NUMBER_SCREENS; index += 1)
+    {
+        delete screens[index];
+    }
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
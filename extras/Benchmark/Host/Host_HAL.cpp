@@ -0,0 +1,391 @@
+//
+// Host_HAL.cpp
+// Stand-in hardware for the host benchmark
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See Host_HAL.h for references
+//
+// Release 821: Initial release
+//
+
+#include <chrono>
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "Wire.h"
+#include "Host_HAL.h"
+
+HardwareSerial Serial;
+SPIClass SPI;
+TwoWire Wire;
+
+static uint8_t h_mode[256]; // pinMode()
+static uint8_t h_level[256]; // digitalWrite()
+static uint8_t h_busy = LOW;
+
+// 3-wire SPI, data on MOSI
+static uint8_t h_written = 0; // Bits written
+static uint8_t h_count = 0; // Number of bits written
+static int32_t h_read = -1; // Bits read since the last command
+static uint8_t h_first = 0x00; // First byte after dummy
+static uint8_t h_otp[128]; // Next bytes, hostSetOTP()
+
+static uint32_t h_transfers = 0;
+static uint32_t h_writes = 0;
+static uint32_t h_signature = 2166136261; // FNV-1a
+static uint8_t h_pinDC = 0xff;
+static uint8_t h_pinCS = 0xff;
+static uint8_t h_pinCSS = 0xff;
+static uint64_t h_waited = 0;
+static uint64_t h_bus = 0; // ns
+static uint64_t h_virtual = 0; // ns, time counted but not spent, never reset
+static uint32_t h_clock = 4000000; // Hz
+static uint32_t h_measures = 0;
+static uint8_t h_registers[256]; // First data byte after each command
+static uint8_t h_command = 0x00;
+static bool h_flagData = false; // First data byte after the command already recorded
+static bool h_flagSPI = false; // SPI.begin() without SPI.end()
+static uint8_t h_panels = 0; // hostSetRefresh()
+static uint8_t h_panelCS[4];
+static uint8_t h_panelBusy[4];
+static uint64_t h_panelRefresh[4]; // ns
+static uint64_t h_panelEnd[4]; // ns, virtual time of the end of refresh
+static const std::chrono::steady_clock::time_point h_start = std::chrono::steady_clock::now();
+
+void hostReset()
+{
+    h_transfers = 0;
+    h_writes = 0;
+    h_signature = 2166136261;
+    h_waited = 0;
+    h_bus = 0;
+    h_measures = 0;
+    memset(h_registers, 0x00, sizeof(h_registers));
+}
+
+uint32_t hostTransfers()
+{
+    return h_transfers;
+}
+
+uint32_t hostWaited()
+{
+    return (uint32_t)h_waited;
+}
+
+uint32_t hostBus()
+{
+    return (uint32_t)(h_bus / 1000);
+}
+
+uint32_t hostWrites()
+{
+    return h_writes;
+}
+
+void hostSetPins(uint8_t pinDC, uint8_t pinCS, uint8_t pinCSS)
+{
+    h_pinDC = pinDC;
+    h_pinCS = pinCS;
+    h_pinCSS = pinCSS;
+}
+
+uint32_t hostSignature()
+{
+    return h_signature;
+}
+
+void hostSetRefresh(uint8_t pinCS, uint8_t pinBusy, uint32_t refresh)
+{
+    for (uint8_t index = 0; index < h_panels; index += 1)
+    {
+        if (h_panelBusy[index] == pinBusy)
+        {
+            h_panelCS[index] = pinCS;
+            h_panelRefresh[index] = (uint64_t)refresh * 1000;
+            return;
+        }
+    }
+
+    if (h_panels < 4)
+    {
+        h_panelCS[h_panels] = pinCS;
+        h_panelBusy[h_panels] = pinBusy;
+        h_panelRefresh[h_panels] = (uint64_t)refresh * 1000;
+        h_panelEnd[h_panels] = 0;
+        h_panels += 1;
+    }
+}
+
+bool hostSPI()
+{
+    return h_flagSPI;
+}
+
+bool hostParked()
+{
+    return (h_flagSPI == false) and (h_mode[SCK] == OUTPUT) and (h_level[SCK] == LOW)
+           and (h_mode[MOSI] == OUTPUT) and (h_level[MOSI] == LOW) and (h_mode[MISO] == INPUT);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    h_mode[pin] = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+    if ((pin != SCK) and (pin != MOSI))
+    {
+        h_writes += 1;
+    }
+
+    // Rising edge of the 3-wire SPI clock
+    if ((pin == SCK) and (level == HIGH) and (h_level[SCK] == LOW))
+    {
+        if (h_mode[MOSI] == OUTPUT)
+        {
+            h_written = (h_written << 1) | h_level[MOSI];
+            h_count += 1;
+            if (h_count == 8)
+            {
+                // Read OTP commands, small and medium screens
+                if (h_written == 0xa2)
+                {
+                    h_first = 0xa5;
+                }
+                else if (h_written == 0xb9)
+                {
+                    h_first = 0x10;
+                }
+                h_read = -1;
+                h_count = 0;
+            }
+        }
+        else
+        {
+            h_read += 1;
+            h_count = 0;
+        }
+    }
+    h_level[pin] = level;
+}
+
+int digitalRead(uint8_t pin)
+{
+    if ((pin == MOSI) and (h_mode[MOSI] != OUTPUT))
+    {
+        // Dummy byte, first byte, then bytes set by hostSetOTP()
+        int16_t index = h_read / 8 - 1;
+        uint8_t value = 0x00;
+        if (index == 0)
+        {
+            value = h_first;
+        }
+        else if ((index > 0) and (index < 128))
+        {
+            value = h_otp[index];
+        }
+        return bitRead(value, 7 - (h_read & 0x07));
+    }
+
+    // Busy low during the refresh, hostSetRefresh()
+    for (uint8_t index = 0; index < h_panels; index += 1)
+    {
+        if (pin == h_panelBusy[index])
+        {
+            return (h_virtual < h_panelEnd[index]) ? LOW : HIGH;
+        }
+    }
+
+    // Busy toggles, so waits for either level end
+    h_busy = (h_busy == HIGH) ? LOW : HIGH;
+    return h_busy;
+}
+
+void delay(uint32_t ms)
+{
+    h_waited += (uint64_t)ms * 1000;
+    h_virtual += (uint64_t)ms * 1000000;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    h_waited += us;
+    h_virtual += (uint64_t)us * 1000;
+}
+
+uint32_t micros()
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - h_start).count();
+    return (uint32_t)(elapsed + h_virtual / 1000);
+}
+
+uint32_t millis()
+{
+    // As Arduino, millis() rolls over after 49 days, not with micros()
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - h_start).count();
+    return (uint32_t)((elapsed + h_virtual / 1000) / 1000);
+}
+
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh)
+{
+    return (value - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+}
+
+void SPIClass::begin()
+{
+    h_flagSPI = true;
+}
+
+void SPIClass::end()
+{
+    h_flagSPI = false;
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+    h_clock = settings.clock;
+}
+
+void SPIClass::endTransaction()
+{
+    ;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    h_transfers += 1;
+    h_bus += 8000000000ULL / h_clock;
+    h_virtual += 8000000000ULL / h_clock;
+
+    uint8_t levels = 0;
+    levels |= (h_pinDC != 0xff) ? h_level[h_pinDC] : LOW;
+    levels |= ((h_pinCS != 0xff) ? h_level[h_pinCS] : LOW) << 1;
+    levels |= ((h_pinCSS != 0xff) ? h_level[h_pinCSS] : HIGH) << 2;
+    h_signature = (h_signature ^ ((levels << 8) | data)) * 16777619;
+
+    if ((levels & 0x01) == LOW) // Command
+    {
+        h_command = data;
+        h_flagData = false;
+
+        // Display Refresh, small screens
+        for (uint8_t index = 0; index < h_panels; index += 1)
+        {
+            if ((data == 0x12) and (h_level[h_panelCS[index]] == LOW))
+            {
+                h_panelEnd[index] = h_virtual + h_panelRefresh[index];
+            }
+        }
+    }
+    else if (not h_flagData) // First data byte
+    {
+        h_registers[h_command] = data;
+        h_flagData = true;
+    }
+    return 0x00;
+}
+
+// HDC2080 sensor, registers 0x00 and 0x01 for temperature, register 0x0f for measurement
+static float h_temperature = 25.0;
+static uint8_t h_register[16];
+static uint8_t h_pointer = 0; // Register
+static bool h_device = false; // Address acknowledged
+static bool h_flagRegister = true; // First byte written is the register
+static size_t h_available = 0;
+
+void hostSetTemperature(float temperatureC)
+{
+    h_temperature = temperatureC;
+}
+
+void hostSetOTP(uint8_t offset, const uint8_t * data, uint8_t number)
+{
+    for (uint8_t index = 0; (index < number) and (offset + index < 128); index += 1)
+    {
+        h_otp[offset + index] = data[index];
+    }
+}
+
+uint8_t hostRegister(uint8_t command)
+{
+    return h_registers[command];
+}
+
+uint32_t hostMeasures()
+{
+    return h_measures;
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+    h_device = (address == 0x40);
+    h_flagRegister = true;
+}
+
+uint8_t TwoWire::endTransmission(bool flagStop)
+{
+    (void)flagStop; // No repeated start on the stand-in bus
+    return h_device ? 0 : 2; // 2 = address not acknowledged
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+    if (not h_device)
+    {
+        return 0;
+    }
+
+    if (h_flagRegister)
+    {
+        h_pointer = data & 0x0f;
+        h_flagRegister = false;
+        return 1;
+    }
+
+    h_register[h_pointer] = data;
+    if ((h_pointer == 0x0f) and (data & 0x01)) // Start
+    {
+        uint16_t raw = (uint16_t)((h_temperature + 40.0) * 65536.0 / 165.0);
+        h_register[0x00] = raw & 0xff;
+        h_register[0x01] = raw >> 8;
+        h_register[0x0f] &= 0xfe; // Done
+        h_measures += 1;
+    }
+    h_pointer = (h_pointer + 1) & 0x0f;
+    return 1;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, size_t number)
+{
+    h_available = (address == 0x40) ? number : 0;
+    return h_available;
+}
+
+int TwoWire::available()
+{
+    return h_available;
+}
+
+int TwoWire::read()
+{
+    if (h_available == 0)
+    {
+        return -1;
+    }
+
+    h_available -= 1;
+    uint8_t data = h_register[h_pointer];
+    h_pointer = (h_pointer + 1) & 0x0f;
+    return data;
+}
@@ -0,0 +1,128 @@
+///
+/// @file Host_HAL.h
+/// @brief Counters of the stand-in hardware, host benchmark only
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The stand-in hardware emulates
+/// * GPIO, with the busy signal toggling at each read so any wait ends,
+/// or held busy during the refresh of the panels set by hostSetRefresh(),
+/// * 4-wire SPI, with the bytes counted and signed with the levels of panelDC, panelCS and panelCSS,
+/// * 3-wire SPI, with the OTP memory answering the check of the first byte, then 0x00 or the bytes set by hostSetOTP(),
+/// * time, with delay() and SPI transfers at the set clock counted but not spent,
+/// * I2C, with a HDC2080 temperature sensor at 0x40 returning the temperature set by hostSetTemperature().
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+#include "Arduino.h"
+
+///
+/// @brief Reset the counters
+///
+void hostReset();
+
+///
+/// @brief Bytes sent or received on 4-wire SPI
+/// @return number of bytes since hostReset()
+///
+uint32_t hostTransfers();
+
+///
+/// @brief Time requested by delay() and delayMicroseconds()
+/// @return microseconds since hostReset()
+///
+uint32_t hostWaited();
+
+///
+/// @brief Time for the 4-wire SPI transfers at the SPI clock
+/// @return microseconds since hostReset()
+///
+uint32_t hostBus();
+
+///
+/// @brief Calls to digitalWrite(), except for 3-wire SPI
+/// @return number of calls since hostReset()
+///
+uint32_t hostWrites();
+
+///
+/// @brief Set the pins signed with each byte
+/// @param pinDC panelDC pin, data or command
+/// @param pinCS panelCS pin, first half of large screens or whole screen
+/// @param pinCSS panelCSS pin, second half of large screens, NOT_CONNECTED otherwise
+///
+void hostSetPins(uint8_t pinDC, uint8_t pinCS, uint8_t pinCSS);
+
+///
+/// @brief Signature of the bytes sent on 4-wire SPI
+/// @details Hash of each byte with the levels of panelDC, panelCS and panelCSS, in order
+/// @note Same signature means same commands and same data to the same panels,
+/// whatever the number of /CS toggles
+/// @return signature since hostReset()
+///
+uint32_t hostSignature();
+
+///
+/// @brief Set bytes of the OTP memory
+/// @param offset first byte, from 1 as byte 0 answers the check
+/// @param data bytes
+/// @param number number of bytes
+/// @note Same bytes for all the screens, read by begin()
+///
+void hostSetOTP(uint8_t offset, const uint8_t * data, uint8_t number);
+
+///
+/// @brief Last value of a register sent on 4-wire SPI
+/// @param command command, sent with panelDC low
+/// @return first data byte after the last occurrence of the command, since hostReset()
+///
+uint8_t hostRegister(uint8_t command);
+
+///
+/// @brief Set the temperature of the stand-in HDC2080 sensor
+/// @param temperatureC temperature in °C, from -40 to +125 °C
+/// @note As the sensor, a measurement samples the temperature when started
+///
+void hostSetTemperature(float temperatureC);
+
+///
+/// @brief Measurements started on the stand-in HDC2080 sensor
+/// @return number of measurements since hostReset()
+///
+uint32_t hostMeasures();
+
+///
+/// @brief State of the 4-wire SPI bus
+/// @return true if started by SPI.begin() and not ended by SPI.end()
+///
+bool hostSPI();
+
+///
+/// @brief State of the SPI pins
+/// @return true if the bus is off, with clock and data out as outputs low and data in as input
+///
+bool hostParked();
+
+///
+/// @brief Set a panel with a refresh time
+/// @param pinCS panelCS pin of the panel
+/// @param pinBusy panelBusy pin of the panel
+/// @param refresh refresh time in us
+/// @note The busy pin reads low during the refresh time after the Display Refresh command 0x12
+/// sent with the panelCS pin low, small screens only
+/// @note Up to 4 panels, the other busy pins toggle at each read
+///
+void hostSetRefresh(uint8_t pinCS, uint8_t pinBusy, uint32_t refresh);
+
+#endif // HOST_HAL_H
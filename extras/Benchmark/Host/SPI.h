@@ -0,0 +1,50 @@
+///
+/// @file SPI.h
+/// @brief Stand-in for the Arduino SPI library, host benchmark only
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+///
+/// @brief SPI settings
+///
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock = 4000000, uint8_t order = MSBFIRST, uint8_t mode = SPI_MODE0) : clock(clock), order(order), mode(mode) {}
+    uint32_t clock; ///< clock, Hz
+    uint8_t order; ///< bit order
+    uint8_t mode; ///< SPI mode
+};
+
+///
+/// @brief SPI bus, bytes counted by Host_HAL.cpp
+///
+class SPIClass
+{
+  public:
+    void begin();
+    void begin(int8_t pinClock, int8_t pinIn, int8_t pinOut) { (void)pinClock; (void)pinIn; (void)pinOut; begin(); }
+    void end();
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
@@ -0,0 +1,216 @@
+//
+// TextScaled_Check.cpp
+// Host check and benchmark of the scaled text
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/TextScaled_Check.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o TextScaled_Check
+//   ./TextScaled_Check
+//
+// The reference draws the text with gText() at scale 1, then copies each pixel of each glyph
+// as a block of scaleX x scaleY pixels with point().
+//
+// For each orientation and font, runs all the cases and reports one CSV line
+// * cases, number of combinations of scales, colours, solid or transparent, spaces and positions
+// * errors, pixels different between gTextScaled() and the reference
+// * scaled ns, processor time of gTextScaled()
+// * reference ns, processor time of the reference
+//
+// Some positions put the text across the edges of the screen, to check the clipping.
+// Ends with the number of errors, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+typedef std::chrono::steady_clock timer;
+
+static uint8_t imageScaled[(304 / 8) * 400]; // 4.17" screen, any orientation
+static uint8_t imageReference[(304 / 8) * 400];
+static uint8_t imageSmall[(304 / 8) * 400];
+
+static const char text[] = "Ag|8 ~\t\xe9";
+static const size_t length = sizeof(text) - 1;
+
+struct scale_s
+{
+    uint8_t x;
+    uint8_t y;
+};
+
+static const scale_s scales[] = { { 1, 1 }, { 2, 2 }, { 3, 2 }, { 2, 5 }, { 4, 4 } };
+
+struct colours_s
+{
+    uint16_t clear;
+    uint16_t text;
+    uint16_t back;
+};
+
+// Both colours different from the clear colour cannot be seen on a monochrome buffer,
+// so three combinations show the text, the background and the transparency
+static const colours_s colours[] =
+{
+    { myColours.white, myColours.black, myColours.white },
+    { myColours.black, myColours.white, myColours.white },
+    { myColours.white, myColours.black, myColours.black },
+};
+
+///
+/// @brief Read a pixel from an exported image
+///
+static bool getPixel(const uint8_t * image, uint16_t sizeX, uint16_t x, uint16_t y)
+{
+    uint32_t index = (uint32_t)y * ((sizeX + 7) / 8) + x / 8;
+    return (image[index] & (0x80 >> (x % 8))) != 0;
+}
+
+///
+/// @brief Count the pixels set in one image and not in the other
+///
+static uint32_t difference(const uint8_t * image1, const uint8_t * image2, uint32_t size)
+{
+    uint32_t result = 0;
+
+    for (uint32_t index = 0; index < size; index += 1)
+    {
+        result += __builtin_popcount(image1[index] ^ image2[index]);
+    }
+
+    return result;
+}
+
+int main()
+{
+    uint32_t errors = 0;
+
+    Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(eScreen_EPD_417_PS_0D, boardRaspberryPiPico_RP2040);
+    screen->begin();
+
+    printf("orientation,font,cases,errors,scaled ns,reference ns\n");
+
+    for (uint8_t orientation = 0; orientation < 4; orientation += 1)
+    {
+        screen->setOrientation(orientation);
+        uint16_t sizeX = screen->screenSizeX();
+        uint16_t sizeY = screen->screenSizeY();
+        uint32_t sizeImage = (uint32_t)(sizeX + 7) / 8 * sizeY;
+
+        // Level of black in the exported image
+        screen->clear(myColours.black);
+        screen->exportImage(imageSmall);
+        bool levelBlack = getPixel(imageSmall, sizeX, 0, 0);
+
+        for (uint8_t font = 0; font < screen->fontMax(); font += 1)
+        {
+            uint32_t cases = 0;
+            uint32_t fontErrors = 0;
+            double scaledNs = 0;
+            double referenceNs = 0;
+
+            // Width of the glyph, without the spaces between characters
+            screen->selectFont(font);
+            screen->setFontSpaceX(0);
+            uint16_t width = screen->characterSizeX();
+            uint16_t height = screen->characterSizeY();
+
+            for (const scale_s & scale : scales)
+            {
+                for (const colours_s & colour : colours)
+                {
+                    for (uint8_t solid = 0; solid < 2; solid += 1)
+                    {
+                        for (uint8_t spaceX = 0; spaceX < 3; spaceX += 2)
+                        {
+                            screen->setFontSolid(solid > 0);
+                            screen->setFontSpaceX(spaceX);
+                            uint16_t pitch = width + spaceX;
+
+                            // Inside, then across the right and bottom edges, then across the left and top edges
+                            int16_t positions[3][2] =
+                            {
+                                { 5, 7 },
+                                { (int16_t)(sizeX - pitch * scale.x * 3 - 1), (int16_t)(sizeY - height * scale.y / 2) },
+                                { (int16_t)(-(int16_t)width * scale.x - 1), (int16_t)(-(int16_t)height * scale.y / 2 - 1) },
+                            };
+
+                            for (uint8_t position = 0; position < 3; position += 1)
+                            {
+                                int16_t x0 = positions[position][0];
+                                int16_t y0 = positions[position][1];
+
+                                // Scaled
+                                screen->clear(colour.clear);
+                                auto start = timer::now();
+                                screen->gTextScaled(x0, y0, text, length, scale.x, scale.y, colour.text, colour.back);
+                                scaledNs += std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+                                screen->exportImage(imageScaled);
+
+                                // Reference, scale 1 then blocks per pixel of the glyphs
+                                screen->clear(colour.clear);
+                                screen->gText(0, 0, text, length, colour.text, colour.back);
+                                screen->exportImage(imageSmall);
+
+                                screen->clear(colour.clear);
+                                start = timer::now();
+                                for (size_t k = 0; k < length; k += 1)
+                                {
+                                    for (uint16_t i = 0; i < width; i += 1)
+                                    {
+                                        for (uint16_t j = 0; j < height; j += 1)
+                                        {
+                                            bool level = getPixel(imageSmall, sizeX, k * pitch + i, j);
+                                            uint16_t pixel = (level == levelBlack) ? myColours.black : myColours.white;
+
+                                            for (uint16_t u = 0; u < scale.x; u += 1)
+                                            {
+                                                for (uint16_t v = 0; v < scale.y; v += 1)
+                                                {
+                                                    int32_t x = x0 + (int32_t)(k * pitch + i) * scale.x + u;
+                                                    int32_t y = y0 + (int32_t)j * scale.y + v;
+                                                    if ((x >= 0) and (x < sizeX) and (y >= 0) and (y < sizeY))
+                                                    {
+                                                        screen->point(x, y, pixel);
+                                                    }
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                                referenceNs += std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+                                screen->exportImage(imageReference);
+
+                                fontErrors += difference(imageScaled, imageReference, sizeImage);
+                                cases += 1;
+                            }
+                        }
+                    }
+                }
+            }
+
+            errors += (fontErrors > 0) ? 1 : 0;
+            printf("%i,%i,%u,%u,%.0f,%.0f\n", orientation, font, cases, fontErrors, scaledNs / cases, referenceNs / cases);
+        }
+    }
+
+    delete screen;
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
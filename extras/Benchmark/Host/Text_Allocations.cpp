@@ -0,0 +1,157 @@
+//
+// Text_Allocations.cpp
+// Host check of the allocations of the text functions
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/Text_Allocations.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Text_Allocations
+//   ./Text_Allocations
+//
+// Replaces the global operator new to count the allocations.
+// For each text function and each type of text, reports one CSV line
+// * allocations, per call
+// * ns per character, processor time
+//
+// The text is longer than the small buffer of std::string, so String allocates on the host as on the boards.
+// Ends with the number of errors, also returned as exit code.
+// An error is an allocation by a function taking const char *, const char * and size_t, or std::string_view.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_REPEAT 1000 ///< Calls per function
+
+typedef std::chrono::steady_clock timer;
+
+static uint32_t allocations = 0;
+
+void * operator new(size_t size)
+{
+    allocations += 1;
+    void * result = malloc(size ? size : 1);
+    if (result == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return result;
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+// Not inlined, so the compiler does not pair malloc() and free() across new and delete
+__attribute__((noinline)) void operator delete(void * pointer) noexcept
+{
+    free(pointer);
+}
+
+__attribute__((noinline)) void operator delete[](void * pointer) noexcept
+{
+    free(pointer);
+}
+
+__attribute__((noinline)) void operator delete(void * pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+__attribute__((noinline)) void operator delete[](void * pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+static const char textConstant[] = "Temperature 21.5 oC, humidity 45 %";
+static const size_t length = sizeof(textConstant) - 1;
+
+// Read at each call, so the measures are not hoisted out of the loop
+static const char * volatile text = textConstant;
+
+static uint32_t errors = 0;
+
+///
+/// @brief Count the allocations and measure the time of a call
+/// @param name name of the function
+/// @param type type of the text
+/// @param flagFree true if no allocation is expected
+/// @param call function to check
+///
+template <typename F>
+static void check(const char * name, const char * type, bool flagFree, F call)
+{
+    uint32_t count = allocations;
+    auto start = timer::now();
+    for (uint16_t repeat = 0; repeat < NUMBER_REPEAT; repeat += 1)
+    {
+        call();
+    }
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count() / NUMBER_REPEAT / length;
+    double perCall = (double)(allocations - count) / NUMBER_REPEAT;
+
+    errors += (flagFree and (perCall > 0)) ? 1 : 0;
+    printf("%s,%s,%.2f,%.1f\n", name, type, perCall, ns);
+}
+
+int main()
+{
+    Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(eScreen_EPD_417_PS_0D, boardRaspberryPiPico_RP2040);
+    screen->begin();
+    screen->selectFont(Font_Terminal8x12);
+
+    const String textString = String(textConstant);
+    volatile uint32_t sink = 0;
+
+    printf("function,type,allocations,ns per character\n");
+
+    check("gText", "String", false, [&]() { screen->gText(0, 0, textString); });
+    check("gText", "const char *", true, [&]() { screen->gText(0, 0, text); });
+    check("gText", "const char * and size_t", true, [&]() { screen->gText(0, 0, text, length, myColours.black, myColours.white); });
+#if defined(hV_HAS_STRING_VIEW)
+    check("gText", "std::string_view", true, [&]() { screen->gText(0, 0, std::string_view(text, length)); });
+#endif // hV_HAS_STRING_VIEW
+
+    check("gTextLarge", "String", false, [&]() { screen->gTextLarge(0, 0, textString); });
+    check("gTextLarge", "const char *", true, [&]() { screen->gTextLarge(0, 0, text); });
+    check("gTextLarge", "const char * and size_t", true, [&]() { screen->gTextLarge(0, 0, text, length, myColours.black, myColours.white); });
+#if defined(hV_HAS_STRING_VIEW)
+    check("gTextLarge", "std::string_view", true, [&]() { screen->gTextLarge(0, 0, std::string_view(text, length)); });
+#endif // hV_HAS_STRING_VIEW
+
+    check("stringSizeX", "String", false, [&]() { sink += screen->stringSizeX(textString); });
+    check("stringSizeX", "const char *", true, [&]() { sink += screen->stringSizeX(text); });
+    check("stringSizeX", "const char * and size_t", true, [&]() { sink += screen->stringSizeX(text, length); });
+#if defined(hV_HAS_STRING_VIEW)
+    check("stringSizeX", "std::string_view", true, [&]() { sink += screen->stringSizeX(std::string_view(text, length)); });
+#endif // hV_HAS_STRING_VIEW
+
+    check("stringLengthToFitX", "String", false, [&]() { sink += screen->stringLengthToFitX(textString, 120); });
+    check("stringLengthToFitX", "const char *", true, [&]() { sink += screen->stringLengthToFitX(text, 120); });
+    check("stringLengthToFitX", "const char * and size_t", true, [&]() { sink += screen->stringLengthToFitX(text, length, 120); });
+#if defined(hV_HAS_STRING_VIEW)
+    check("stringLengthToFitX", "std::string_view", true, [&]() { sink += screen->stringLengthToFitX(std::string_view(text, length), 120); });
+#endif // hV_HAS_STRING_VIEW
+
+    delete screen;
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
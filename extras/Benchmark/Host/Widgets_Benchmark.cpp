@@ -0,0 +1,169 @@
+//
+// Widgets_Benchmark.cpp
+// Host check and benchmark of the retained widgets
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Host/Widgets_Benchmark.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Widgets_Benchmark
+//   ./Widgets_Benchmark
+//
+// Same widgets as the Fast_Widgets example, with the icon over the title.
+// For each step, changes some widgets as the example, hides the icon every other step
+// and moves the status label every third step, then reports one CSV line
+// * redrawn, number of widgets redrawn or restored by update()
+// * area pixels, pixels of the area returned by update()
+// * update ns, processor time of update()
+// * full ns, processor time of clear() and update() of all the widgets
+// * errors, pixels different between update() and the full redraw
+// * pen, 1 if the pen state set before update() is preserved
+//
+// Ends with the number of errors, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "hV_Widgets.h"
+#include "Host_HAL.h"
+
+#define NUMBER_STEPS 12 ///< Steps
+#define NUMBER_REPEAT 100 ///< Repeats for timing of the full redraw
+
+typedef std::chrono::steady_clock timer;
+
+static uint8_t imageUpdate[(264 / 8) * 176]; // 2.71" screen
+static uint8_t imageFull[(264 / 8) * 176];
+
+// 8x8 icon, sun
+static const uint8_t iconSun[8] = { 0x24, 0x00, 0x3c, 0xbd, 0x3c, 0x3c, 0x00, 0x24 };
+
+hV_Widget_Layer myLayer;
+hV_Widget_Frame myFrame;
+hV_Widget_Label myTitle;
+hV_Widget_Value myTemperature;
+hV_Widget_Bar myBar;
+hV_Widget_Icon myIcon;
+hV_Widget_Label myStatus;
+
+///
+/// @brief Count the pixels set in one image and not in the other
+///
+static uint32_t difference(const uint8_t * image1, const uint8_t * image2, uint32_t size)
+{
+    uint32_t result = 0;
+
+    for (uint32_t index = 0; index < size; index += 1)
+    {
+        result += __builtin_popcount(image1[index] ^ image2[index]);
+    }
+
+    return result;
+}
+
+int main()
+{
+    uint32_t errors = 0;
+    char text[16];
+
+    Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(eScreen_EPD_271_PS_09, boardRaspberryPiPico_RP2040);
+    screen->begin();
+    screen->setOrientation(ORIENTATION_LANDSCAPE);
+
+    uint16_t x = screen->screenSizeX();
+    uint16_t y = screen->screenSizeY();
+    uint32_t sizeImage = (uint32_t)(x + 7) / 8 * y;
+
+    myFrame.setArea(0, 0, x, y);
+    myFrame.setThickness(2);
+    myLayer.add(&myFrame);
+
+    myTitle.setArea(8, 8, x - 16, 16);
+    myTitle.setFont(Font_Terminal12x16);
+    myTitle.setText("Sensor on the left of the sun");
+    myLayer.add(&myTitle);
+
+    myIcon.setArea(x - 48, 8, 8, 8);
+    myIcon.setIcon(iconSun, 8, 8);
+    myLayer.add(&myIcon);
+
+    myTemperature.setArea(8, 32, x - 16, 24);
+    myTemperature.setFont(Font_Terminal16x24);
+    myTemperature.setFormat(1, "oC");
+    myLayer.add(&myTemperature);
+
+    myBar.setArea(8, 64, x - 16, 16);
+    myBar.setRange(0, 400);
+    myLayer.add(&myBar);
+
+    myStatus.setArea(8, y - 20, x - 16, 12);
+    myStatus.setFont(Font_Terminal8x12);
+    myLayer.add(&myStatus);
+
+    screen->clear();
+    myLayer.update(screen);
+
+    printf("step,redrawn,area pixels,update ns,full ns,errors,pen\n");
+
+    for (uint8_t step = 0; step < NUMBER_STEPS; step += 1)
+    {
+        int32_t value = 180 + step * 15;
+
+        myTemperature.setValue(value);
+        myBar.setValue(value);
+        snprintf(text, sizeof(text), "Step %u/%u", step + 1, NUMBER_STEPS);
+        myStatus.setText(text);
+        myIcon.setVisible((step % 2) == 1);
+        if ((step % 3) == 2)
+        {
+            myStatus.setArea(8 + 4 * step, y - 20 - 8 * (step % 2), x - 64, 12);
+        }
+
+        // Incremental, pen state set before
+        area_s area = { 0, 0, 0, 0 };
+        bool flagPen = (step % 2) == 0;
+        screen->setPenSolid(flagPen);
+
+        auto start = timer::now();
+        uint16_t count = myLayer.update(screen, &area);
+        double updateNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+
+        bool flagPenKept = (screen->getPenSolid() == flagPen);
+        errors += flagPenKept ? 0 : 1;
+        screen->exportImage(imageUpdate);
+
+        // Full redraw, reference
+        start = timer::now();
+        for (uint16_t repeat = 0; repeat < NUMBER_REPEAT; repeat += 1)
+        {
+            screen->clear();
+            myLayer.invalidate();
+            myLayer.update(screen);
+        }
+        double fullNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count() / NUMBER_REPEAT;
+        screen->exportImage(imageFull);
+
+        uint32_t stepErrors = difference(imageUpdate, imageFull, sizeImage);
+        errors += (stepErrors > 0) ? 1 : 0;
+
+        uint32_t pixels = (count > 0) ? (uint32_t)(area.x2 - area.x1 + 1) * (area.y2 - area.y1 + 1) : 0;
+        printf("%u,%u,%u,%.0f,%.0f,%u,%i\n", step, count, pixels, updateNs, fullNs, stepErrors, flagPenKept);
+    }
+
+    delete screen;
+
+    printf("# errors, %u\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
@@ -0,0 +1,41 @@
+///
+/// @file Wire.h
+/// @brief Stand-in for the Arduino Wire library, host benchmark only
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+///
+/// @brief I2C bus, with a stand-in HDC2080 sensor at 0x40 emulated by Host_HAL.cpp
+///
+class TwoWire
+{
+  public:
+    void begin() {}
+    void end() {}
+    void setClock(uint32_t clock) { (void)clock; }
+    void beginTransmission(uint8_t address);
+    uint8_t endTransmission(bool flagStop = true);
+    size_t write(uint8_t data);
+    uint8_t requestFrom(uint8_t address, size_t number);
+    int available();
+    int read();
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
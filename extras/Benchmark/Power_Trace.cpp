@@ -0,0 +1,147 @@
+//
+// Power_Trace.cpp
+// Host trace of the suspend and resume per power scope
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Power_Trace.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Power_Trace
+//   ./Power_Trace
+//   ./Power_Trace 343
+//
+// The optional argument selects the screens with the string in their name.
+//
+// For each screen and each power case, suspends, then flushes twice and reports one CSV line per flush
+// * wake us, wake-up before the first command from getFlushStatistics()
+// * reset us, resets of the panel from getFlushStatistics()
+// * GPIO writes, calls to digitalWrite() except for 3-wire SPI, whole flush
+// * waited ms, time requested by delay() and delayMicroseconds(), whole flush
+// * SPI on, 4-wire SPI bus started after the flush
+// * parked, SPI pins parked after the flush
+//
+// Power cases
+// * none, panelPower not connected, suspend() has nothing to power off
+// * auto-none, panelPower connected, POWER_MODE_AUTO with POWER_SCOPE_NONE
+// * auto-GPIO, panelPower connected, POWER_MODE_AUTO with POWER_SCOPE_GPIO_ONLY
+// * auto-bus, panelPower not connected, POWER_MODE_AUTO with POWER_SCOPE_BUS_GPIO
+// * auto-bus-GPIO, panelPower connected, POWER_MODE_AUTO with POWER_SCOPE_BUS_GPIO
+// * auto-bus-shared, as auto-bus-GPIO with another device on the SPI bus, the bus remains on
+// * auto-bus-flash, as auto-bus-GPIO with flashCS connected, the bus remains on
+//
+// Flash and SD-card are not connected, except for auto-bus-flash.
+// One screen per panel and per case, started by begin().
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define PIN_POWER 22 ///< Pin for panelPower, free on the board
+
+struct panel_s
+{
+    eScreen_EPD_t screen;
+    const char * name;
+};
+
+// Screens with embedded fast update, film P, one per family
+static const panel_s panels[] =
+{
+    { eScreen_EPD_271_PS_09, "271-PS-09" },
+    { eScreen_EPD_343_PS_0B, "343-PS-0B" },
+    { eScreen_EPD_969_PS_0B, "969-PS-0B" },
+};
+
+struct case_s
+{
+    const char * name;
+    bool flagPower; ///< panelPower connected
+    bool flagShared; ///< Another device on the SPI bus
+    bool flagFlash; ///< flashCS connected
+    uint8_t mode;
+    uint8_t scope;
+};
+
+static const case_s cases[] =
+{
+    { "none", false, false, false, POWER_MODE_MANUAL, POWER_SCOPE_GPIO_ONLY },
+    { "auto-none", true, false, false, POWER_MODE_AUTO, POWER_SCOPE_NONE },
+    { "auto-GPIO", true, false, false, POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY },
+    { "auto-bus", false, false, false, POWER_MODE_AUTO, POWER_SCOPE_BUS_GPIO },
+    { "auto-bus-GPIO", true, false, false, POWER_MODE_AUTO, POWER_SCOPE_BUS_GPIO },
+    { "auto-bus-shared", true, true, false, POWER_MODE_AUTO, POWER_SCOPE_BUS_GPIO },
+    { "auto-bus-flash", true, false, true, POWER_MODE_AUTO, POWER_SCOPE_BUS_GPIO },
+};
+
+int main(int argc, char ** argv)
+{
+    const char * filter = (argc > 1) ? argv[1] : "";
+
+    printf("panel,case,flush,wake us,reset us,GPIO writes,waited ms,SPI on,parked\n");
+
+    for (const panel_s & panel : panels)
+    {
+        if (strstr(panel.name, filter) == 0)
+        {
+            continue;
+        }
+
+        for (const case_s & power : cases)
+        {
+            pins_t board = boardRaspberryPiPico_RP2040;
+            board.flashCS = power.flagFlash ? board.flashCS : NOT_CONNECTED;
+            board.flashCSS = NOT_CONNECTED;
+            board.cardCS = NOT_CONNECTED;
+            board.panelPower = power.flagPower ? PIN_POWER : NOT_CONNECTED;
+
+            Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(panel.screen, board);
+            hostSetPins(board.panelDC, board.panelCS, board.panelCSS);
+            if (power.flagShared)
+            {
+                hV_HAL_SPI_begin(SPI_SPEED_DEFAULT, SPI_OWNER_OTHER);
+            }
+
+            screen->begin();
+            screen->setPowerProfile(power.mode, power.scope);
+            screen->suspend(power.scope);
+
+            for (uint8_t flush = 1; flush <= 2; flush += 1)
+            {
+                hostReset();
+                screen->flush();
+                flushStatistics_s statistics = screen->getFlushStatistics();
+                printf("%s,%s,%i,%u,%u,%u,%.3f,%i,%i\n", panel.name, power.name, flush,
+                       statistics.wake, statistics.reset, hostWrites(), hostWaited() / 1000.0,
+                       hostSPI(), hostParked());
+            }
+
+            // Release the bus for the next case, forced with Flash
+            screen->suspend(POWER_SCOPE_BUS_GPIO);
+            if (power.flagShared)
+            {
+                hV_HAL_SPI_end(SPI_OWNER_OTHER);
+            }
+            if (power.flagFlash)
+            {
+                hV_HAL_SPI_end(SPI_OWNER_NONE, true);
+            }
+
+            delete screen;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,230 @@
+//
+// Primitives_Benchmark.cpp
+// Host benchmark for the drawing primitives and the flush phases
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Primitives_Benchmark.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Primitives_Benchmark
+//   ./Primitives_Benchmark > results.csv
+//   ./Primitives_Benchmark 271 > results_271.csv
+//
+// The optional argument selects the screens with the string in their name.
+// The OTP memory is read by begin(), measured once per screen.
+//
+// Builds hV_Screen_Buffer and Screen_EPD_EXT3_Fast against the stand-in hardware of extras/Benchmark/Host.
+// For each screen and each orientation, reports one CSV line per operation
+// * ns/op, processor time per call
+// * pixels/s, pixels drawn per second of processor time, 0 when not applicable
+// * SPI bytes and waited ms, per call, as requested to the stand-in hardware
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_SHAPES 64 ///< Set of random shapes per primitive
+#define BUDGET_NS 20000000 ///< Minimum duration of a measure, 20 ms
+
+struct panel_s
+{
+    eScreen_EPD_t screen;
+    const char * name;
+};
+
+// Screens with embedded fast update, film P
+static const panel_s panels[] =
+{
+    { eScreen_EPD_154_PS_0C, "154-PS-0C" },
+    { eScreen_EPD_213_PS_0E, "213-PS-0E" },
+    { eScreen_EPD_266_PS_0C, "266-PS-0C" },
+    { eScreen_EPD_271_PS_09, "271-PS-09" },
+    { eScreen_EPD_287_PS_09, "287-PS-09" },
+    { eScreen_EPD_343_PS_0B, "343-PS-0B" },
+    { eScreen_EPD_370_PS_0C, "370-PS-0C" },
+    { eScreen_EPD_417_PS_0D, "417-PS-0D" },
+    { eScreen_EPD_437_PS_0C, "437-PS-0C" },
+    { eScreen_EPD_969_PS_0B, "969-PS-0B" },
+    { eScreen_EPD_B98_PS_0B, "B98-PS-0B" },
+};
+
+struct shape_s
+{
+    uint16_t x1, y1, x2, y2, x3, y3;
+};
+
+static shape_s shapes[NUMBER_SHAPES];
+
+typedef std::chrono::steady_clock timer;
+
+///
+/// @brief Measure an operation
+/// @param panel name of the screen
+/// @param orientation orientation
+/// @param operation name of the operation
+/// @param pixels pixels drawn per call, 0 if not applicable
+/// @param action call to measure, with index of the call
+///
+template <typename T>
+static void measure(const char * panel, uint8_t orientation, const char * operation, uint64_t pixels, T action)
+{
+    uint64_t calls = 0;
+    uint64_t elapsed = 0;
+    uint64_t total = 0; // Pixels
+
+    hostReset();
+    auto start = timer::now();
+    while (elapsed < BUDGET_NS)
+    {
+        for (uint8_t index = 0; index < NUMBER_SHAPES; index += 1)
+        {
+            total += action(index);
+        }
+        calls += NUMBER_SHAPES;
+        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+    }
+    if (pixels > 0)
+    {
+        total = pixels * calls;
+    }
+
+    printf("%s,%i,%s,%llu,%.1f,%.0f,%.1f,%.3f\n", panel, orientation, operation, (unsigned long long)calls,
+           (double)elapsed / calls, (double)total * 1e9 / elapsed,
+           (double)hostTransfers() / calls, (double)hostWaited() / 1000.0 / calls);
+}
+
+///
+/// @brief Random shapes within the screen
+///
+static void setShapes(uint16_t sizeX, uint16_t sizeY)
+{
+    for (uint8_t index = 0; index < NUMBER_SHAPES; index += 1)
+    {
+        shape_s & shape = shapes[index];
+        shape.x1 = rand() % sizeX;
+        shape.y1 = rand() % sizeY;
+        shape.x2 = rand() % sizeX;
+        shape.y2 = rand() % sizeY;
+        shape.x3 = rand() % sizeX;
+        shape.y3 = rand() % sizeY;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    const char * filter = (argc > 1) ? argv[1] : "";
+    const char * text = "PDLS 0123456789";
+
+    srand(821);
+    printf("panel,orientation,operation,calls,ns/op,pixels/s,SPI bytes/op,waited ms/op\n");
+
+    for (const panel_s & panel : panels)
+    {
+        if (strstr(panel.name, filter) == 0)
+        {
+            continue;
+        }
+
+        // Start, with OTP read, once per screen
+        Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(panel.screen, boardRaspberryPiPico_RP2040);
+        hostReset();
+        auto start = timer::now();
+        screen->begin();
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(timer::now() - start).count();
+        printf("%s,%i,%s,%i,%.1f,%i,%.1f,%.3f\n", panel.name, 0, "begin", 1, (double)elapsed, 0,
+               (double)hostTransfers(), (double)hostWaited() / 1000.0);
+
+        for (uint8_t orientation = 0; orientation < 4; orientation += 1)
+        {
+            screen->setOrientation(orientation);
+            uint16_t sizeX = screen->screenSizeX();
+            uint16_t sizeY = screen->screenSizeY();
+            uint64_t area = (uint64_t)sizeX * sizeY;
+
+            setShapes(sizeX, sizeY);
+            screen->setPenSolid(true);
+            screen->selectFont(Font_Terminal8x12);
+            screen->setFontSolid(true);
+
+            measure(panel.name, orientation, "point", 1, [&](uint8_t index)
+            {
+                screen->point(shapes[index].x1, shapes[index].y1, myColours.black);
+                return 1;
+            });
+
+            measure(panel.name, orientation, "line", 0, [&](uint8_t index)
+            {
+                shape_s & shape = shapes[index];
+                screen->line(shape.x1, shape.y1, shape.x2, shape.y2, myColours.black);
+                return hV_HAL_max(abs(shape.x2 - shape.x1), abs(shape.y2 - shape.y1)) + 1;
+            });
+
+            measure(panel.name, orientation, "rectangle", 0, [&](uint8_t index)
+            {
+                shape_s & shape = shapes[index];
+                screen->rectangle(shape.x1, shape.y1, shape.x2, shape.y2, myColours.black);
+                return (abs(shape.x2 - shape.x1) + 1) * (abs(shape.y2 - shape.y1) + 1);
+            });
+
+            measure(panel.name, orientation, "circle", 0, [&](uint8_t index)
+            {
+                shape_s & shape = shapes[index];
+                uint16_t radius = shape.x2 % (hV_HAL_min(sizeX, sizeY) / 4) + 1;
+                screen->circle(shape.x1, shape.y1, radius, myColours.black);
+                return (uint32_t)(3.1416 * radius * radius);
+            });
+
+            measure(panel.name, orientation, "triangle", 0, [&](uint8_t index)
+            {
+                shape_s & shape = shapes[index];
+                screen->triangle(shape.x1, shape.y1, shape.x2, shape.y2, shape.x3, shape.y3, myColours.black);
+                int32_t cross = (int32_t)(shape.x2 - shape.x1) * (shape.y3 - shape.y1) - (int32_t)(shape.x3 - shape.x1) * (shape.y2 - shape.y1);
+                return abs(cross) / 2;
+            });
+
+            uint32_t pixelsText = screen->stringSizeX(text) * screen->characterSizeY();
+            measure(panel.name, orientation, "gText", pixelsText, [&](uint8_t index)
+            {
+                screen->gText(shapes[index].x1 % (sizeX / 2), shapes[index].y1 % (sizeY / 2), text);
+                return 0;
+            });
+
+            measure(panel.name, orientation, "gTextLarge", pixelsText * 4, [&](uint8_t index)
+            {
+                screen->gTextLarge(shapes[index].x1 % (sizeX / 2), shapes[index].y1 % (sizeY / 2), text);
+                return 0;
+            });
+
+            measure(panel.name, orientation, "clear", area, [&](uint8_t index)
+            {
+                (void)index; // Same for all the shapes
+                screen->clear();
+                return 0;
+            });
+
+            measure(panel.name, orientation, "flush", area, [&](uint8_t index)
+            {
+                (void)index; // Same for all the shapes
+                screen->flush();
+                return 0;
+            });
+        }
+    }
+
+    return 0;
+}
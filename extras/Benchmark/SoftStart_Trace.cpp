@@ -0,0 +1,113 @@
+//
+// SoftStart_Trace.cpp
+// Host trace of the DC/DC soft-start, blocking and polled
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/SoftStart_Trace.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o SoftStart_Trace
+//   ./SoftStart_Trace
+//
+// The OTP memory of the stand-in hardware provides four soft-start stages, formats 1 and 2.
+// For each medium and large screen, reports one CSV line per soft-start mode,
+// polled with a fast and a slow application
+// * SPI bytes and signature, same for all modes
+// * soft-start us, from getFlushStatistics()
+// * overrun us, soft-start longer than blocking, as the delays between two steps wait for the next call to isBusy()
+// * polls, calls to isBusy() before the end of the soft-start and the refresh
+// * work us, time available to the application between the calls to isBusy()
+//
+// Ends with the number of screens with different commands between modes, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define WORK_US 200 ///< Work of the application between two calls to isBusy()
+#define WORK_SLOW_US 5000 ///< Work of a slow application between two calls to isBusy()
+
+struct panel_s
+{
+    eScreen_EPD_t screen;
+    const char * name;
+};
+
+// Medium and large screens with embedded fast update, film P
+static const panel_s panels[] =
+{
+    { eScreen_EPD_343_PS_0B, "343-PS-0B" },
+    { eScreen_EPD_969_PS_0B, "969-PS-0B" },
+    { eScreen_EPD_B98_PS_0B, "B98-PS-0B" },
+};
+
+// Soft-start stages at 0x28, 8 bytes per stage
+static const uint8_t stages[] =
+{
+    0x88, 0x10, 0x10, 0x02, 0x02, 0x7f, 0x7d, 0x81, // Format 1, 8 steps, PHL PHH +2, delay 1 ms
+    0x88, 0x20, 0x20, 0x04, 0x04, 0x7f, 0x7d, 0x0a, // Format 1, 8 steps, PHL PHH +4, delay 100 us
+    0x0a, 0x7f, 0x7d, 0x0a, 0x81, 0x00, 0x00, 0x00, // Format 2, 10 steps, delays 100 us and 1 ms
+    0x04, 0x7f, 0x7b, 0x82, 0x05, 0x00, 0x00, 0x00, // Format 2, 4 steps, delays 2 ms and 50 us
+};
+
+int main()
+{
+    uint16_t differences = 0;
+
+    hostSetOTP(0x28, stages, sizeof(stages));
+    printf("panel,mode,SPI bytes,signature,soft-start us,overrun us,polls,work us\n");
+
+    for (const panel_s & panel : panels)
+    {
+        Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(panel.screen, boardRaspberryPiPico_RP2040);
+        pins_t pins = screen->getBoardPins();
+        hostSetPins(pins.panelDC, pins.panelCS, pins.panelCSS);
+        screen->begin();
+
+        // Blocking
+        screen->setSoftStartMode(SOFT_START_BLOCKING);
+        hostReset();
+        screen->flush();
+        uint32_t signature = hostSignature();
+        uint32_t softStart = screen->getFlushStatistics().softStart;
+        printf("%s,blocking,%u,%08x,%u,%u,%u,%u\n", panel.name, hostTransfers(), hostSignature(),
+               softStart, 0, 0, 0);
+
+        // Polled, fast then slow application
+        screen->setSoftStartMode(SOFT_START_POLLED);
+        for (uint32_t work : { WORK_US, WORK_SLOW_US })
+        {
+            hostReset();
+            screen->flushStart();
+            uint32_t polls = 0;
+            while (screen->isBusy())
+            {
+                polls += 1;
+                delayMicroseconds(work); // Application
+            }
+            screen->flushEnd();
+            differences += (hostSignature() != signature) ? 1 : 0;
+            printf("%s,%s,%u,%08x,%u,%u,%u,%u\n", panel.name, (work == WORK_US) ? "polled" : "polled slow",
+                   hostTransfers(), hostSignature(), screen->getFlushStatistics().softStart,
+                   screen->getFlushStatistics().softStart - softStart, polls, polls * work);
+        }
+
+        delete screen;
+    }
+
+    printf("# differences, %i\n", differences);
+    return (differences > 0) ? 1 : 0;
+}
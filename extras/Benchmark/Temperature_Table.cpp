@@ -0,0 +1,96 @@
+//
+// Temperature_Table.cpp
+// Host check of the temperature compensation sent to the medium and large screens
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Temperature_Table.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Temperature_Table
+//   ./Temperature_Table > table.csv
+//
+// For each screen and each temperature with an update, from 0 to 50 °C,
+// flushes the screen and reports one CSV line
+// * register 0x45, value sent on SPI for the temperature compensation
+// * expected, value from the application notes
+//
+// Ends with the number of mismatches, also returned as exit code.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+struct panel_s
+{
+    eScreen_EPD_t screen;
+    const char * name;
+};
+
+// Medium and large screens with embedded fast update, film P
+static const panel_s panels[] =
+{
+    { eScreen_EPD_343_PS_0B, "343-PS-0B" },
+    { eScreen_EPD_969_PS_0B, "969-PS-0B" },
+    { eScreen_EPD_B98_PS_0B, "B98-PS-0B" },
+};
+
+///
+/// @brief Expected value for fast update
+/// @param screen screen
+/// @param temperature temperature, °C
+/// @return value of register 0x45
+///
+static uint8_t expected(eScreen_EPD_t screen, int8_t temperature)
+{
+    if (screen == eScreen_EPD_343_PS_0B)
+    {
+        return (temperature < 22) ? 0xc9 : 0xca;
+    }
+
+    return 0xa8 + temperature; // 0 to 50 °C
+}
+
+int main()
+{
+    uint16_t mismatches = 0;
+
+    printf("panel,temperature,register 0x45,expected\n");
+
+    for (const panel_s & panel : panels)
+    {
+        Screen_EPD_EXT3_Fast * screen = new Screen_EPD_EXT3_Fast(panel.screen, boardRaspberryPiPico_RP2040);
+        pins_t pins = screen->getBoardPins();
+        hostSetPins(pins.panelDC, pins.panelCS, pins.panelCSS);
+        screen->begin();
+
+        for (int8_t temperature = 0; temperature <= 50; temperature += 1)
+        {
+            screen->setTemperatureC(temperature);
+            hostReset();
+            screen->flush();
+
+            uint8_t value = hostRegister(0x45);
+            uint8_t reference = expected(panel.screen, temperature);
+            mismatches += (value != reference) ? 1 : 0;
+            printf("%s,%i,0x%02x,0x%02x\n", panel.name, temperature, value, reference);
+        }
+
+        delete screen;
+    }
+
+    printf("# mismatches, %i\n", mismatches);
+    return (mismatches > 0) ? 1 : 0;
+}
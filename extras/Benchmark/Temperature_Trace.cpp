@@ -0,0 +1,119 @@
+//
+// Temperature_Trace.cpp
+// Host trace of the temperature provider and of the update mode
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -std=gnu++17 -O2 -Wall -Wextra -Iextras/Benchmark/Host -Isrc extras/Benchmark/Temperature_Trace.cpp extras/Benchmark/Host/Host_HAL.cpp src/*.cpp -o Temperature_Trace
+//   ./Temperature_Trace > temperature.csv
+//   ./Temperature_Trace 2 > temperature_2.csv
+//
+// The optional argument sets the hysteresis, default = 2 °C.
+//
+// The temperature of a fake sensor drifts around 15 °C with noise, one step per minute.
+// For each step, reports one CSV line
+// * sensor, temperature of the fake sensor
+// * callback, cached temperature with a callback provider
+// * HDC2080, cached temperature with temperatureProviderHDC2080() and the stand-in sensor
+// * mode, update mode for UPDATE_FAST without hysteresis
+// * mode hysteresis, update mode for UPDATE_FAST with hysteresis
+//
+// Ends with the number of mode changes, and the number of I2C measurements during flush(), expected 0.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "PDLS_EXT3_Basic_Fast.h"
+#include "Host_HAL.h"
+
+#define NUMBER_STEPS 240 ///< Steps, one per minute
+#define STEP_MS 60000 ///< Time between steps, 1 minute
+
+static float temperatureSensor = 25.0;
+
+///
+/// @brief Callback provider, fake sensor
+///
+static bool fakeSensor(int8_t & temperatureC)
+{
+    temperatureC = (int8_t)lroundf(temperatureSensor);
+    return RESULT_SUCCESS;
+}
+
+int main(int argc, char ** argv)
+{
+    uint8_t hysteresis = (argc > 1) ? atoi(argv[1]) : 2;
+
+    Screen_EPD_EXT3_Fast * screenPlain = new Screen_EPD_EXT3_Fast(eScreen_EPD_271_PS_09, boardRaspberryPiPico_RP2040);
+    Screen_EPD_EXT3_Fast * screenBand = new Screen_EPD_EXT3_Fast(eScreen_EPD_271_PS_09, boardRaspberryPiPico_RP2040);
+    Screen_EPD_EXT3_Fast * screenSensor = new Screen_EPD_EXT3_Fast(eScreen_EPD_271_PS_09, boardRaspberryPiPico_RP2040);
+
+    screenPlain->begin();
+    screenBand->begin();
+    screenSensor->begin();
+
+    screenPlain->setTemperatureProvider(fakeSensor, STEP_MS);
+    screenBand->setTemperatureProvider(fakeSensor, STEP_MS);
+    screenBand->setTemperatureHysteresis(hysteresis);
+    screenSensor->setTemperatureProvider(temperatureProviderHDC2080, STEP_MS);
+
+    uint8_t modePlain = UPDATE_FAST;
+    uint8_t modeBand = UPDATE_FAST;
+    uint16_t changesPlain = 0;
+    uint16_t changesBand = 0;
+
+    srand(821);
+    printf("minute,sensor,callback,HDC2080,mode,mode hysteresis %i\n", hysteresis);
+
+    for (uint16_t step = 0; step < NUMBER_STEPS; step += 1)
+    {
+        float noise = (rand() % 1001 - 500) / 500.0 * 0.8;
+        temperatureSensor = 15.0 + 2.0 * sin(step / 20.0) + noise;
+        hostSetTemperature(temperatureSensor);
+
+        screenPlain->pollTemperature();
+        screenBand->pollTemperature();
+        screenSensor->pollTemperature();
+
+        uint8_t mode = screenPlain->checkTemperatureMode(UPDATE_FAST);
+        changesPlain += (mode != modePlain) ? 1 : 0;
+        modePlain = mode;
+
+        mode = screenBand->checkTemperatureMode(UPDATE_FAST);
+        changesBand += (mode != modeBand) ? 1 : 0;
+        modeBand = mode;
+
+        printf("%i,%.2f,%i,%i,%i,%i\n", step, temperatureSensor, screenPlain->getTemperatureC(), screenSensor->getTemperatureC(), modePlain, modeBand);
+
+        delay(STEP_MS);
+    }
+
+    // Flush with the provider set, no I2C access expected
+    hostReset();
+    screenSensor->flush();
+    uint32_t measuresFlush = hostMeasures();
+
+    printf("# mode changes, no hysteresis, %i\n", changesPlain);
+    printf("# mode changes, hysteresis %i, %i\n", hysteresis, changesBand);
+    printf("# I2C measurements during flush, %i\n", measuresFlush);
+
+    delete screenPlain;
+    delete screenBand;
+    delete screenSensor;
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+//
+// Terminal_Benchmark.cpp
+// Host benchmark for compressed Terminal fonts
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -O2 -Isrc extras/Fonts/Terminal_Benchmark.cpp -o Terminal_Benchmark
+//   ./Terminal_Benchmark
+//
+// Reports the flash saved and the decode cost per character,
+// compared with the direct access to the uncompressed glyph.
+// The decoder is the same as hV_Font_Terminal::f_decodeGlyph().
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "Terminal8x12e.h"
+#include "Terminal12x16e.h"
+#include "Terminal16x24e.h"
+#include "Terminal8x12c.h"
+#include "Terminal12x16c.h"
+#include "Terminal16x24c.h"
+
+struct benchmark_s
+{
+    const char * name;
+    uint8_t height;
+    uint8_t width;
+    const uint8_t * original;
+    uint32_t originalSize;
+    const uint8_t * table;
+    const uint16_t * offsets;
+    const uint8_t * dictionary;
+    uint32_t compressedSize;
+};
+
+static void decodeGlyph(const benchmark_s & font, uint8_t character, uint8_t * glyph)
+{
+    uint8_t rows = (font.height + 7) / 8;
+    const uint8_t * pointer = font.table + font.offsets[character];
+    const uint8_t * end = font.table + font.offsets[character + 1];
+
+    memset(glyph, 0x00, font.width * rows);
+
+    if (pointer == end)
+    {
+        return;
+    }
+
+    uint8_t column = pointer[0] >> 4;
+    uint8_t number = (pointer[0] & 0x0f) + 1;
+    pointer += 1;
+
+    for (uint8_t index = 0; index < number; index += 1)
+    {
+        if (pointer[0] == 0xff)
+        {
+            memcpy(glyph + (column + index) * rows, pointer + 1, rows);
+            pointer += 1 + rows;
+        }
+        else
+        {
+            memcpy(glyph + (column + index) * rows, font.dictionary + pointer[0] * rows, rows);
+            pointer += 1;
+        }
+    }
+}
+
+#define BENCHMARK_FONT(NAME, HEIGHT, WIDTH) \
+    { #NAME, HEIGHT, WIDTH, &NAME##e[0][0], sizeof(NAME##e), NAME##c, NAME##c_offsets, &NAME##c_dictionary[0][0], \
+      sizeof(NAME##c) + sizeof(NAME##c_offsets) + sizeof(NAME##c_dictionary) }
+
+int main()
+{
+    static const benchmark_s fonts[] =
+    {
+        BENCHMARK_FONT(Terminal8x12, 12, 8),
+        BENCHMARK_FONT(Terminal12x16, 16, 12),
+        BENCHMARK_FONT(Terminal16x24, 24, 16),
+    };
+    const uint32_t loops = 2000;
+    uint8_t glyph[48];
+    volatile uint32_t sink = 0;
+
+    printf("Font,Original,Compressed,Saved,Decode ns/char,Direct ns/char\n");
+    for (const benchmark_s & font : fonts)
+    {
+        uint8_t bytes = font.width * ((font.height + 7) / 8);
+
+        // Check
+        for (uint16_t character = 0; character < 224; character += 1)
+        {
+            decodeGlyph(font, character, glyph);
+            if (memcmp(glyph, font.original + character * bytes, bytes) != 0)
+            {
+                printf("%s: glyph %d differs\n", font.name, character);
+                return 1;
+            }
+        }
+
+        // Decode
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t loop = 0; loop < loops; loop += 1)
+        {
+            for (uint16_t character = 0; character < 224; character += 1)
+            {
+                decodeGlyph(font, character, glyph);
+                sink += glyph[bytes / 2];
+            }
+        }
+        double decode = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (loops * 224.0);
+
+        // Direct access, as a cache hit
+        start = std::chrono::steady_clock::now();
+        for (uint32_t loop = 0; loop < loops; loop += 1)
+        {
+            for (uint16_t character = 0; character < 224; character += 1)
+            {
+                memcpy(glyph, font.original + character * bytes, bytes);
+                sink += glyph[bytes / 2];
+            }
+        }
+        double direct = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (loops * 224.0);
+
+        printf("%s,%u,%u,%u,%.1f,%.1f\n", font.name, font.originalSize, font.compressedSize,
+               font.originalSize - font.compressedSize, decode, direct);
+    }
+
+    return (sink == 0xffffffff);
+}
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+#
+# Terminal_Compress.py
+# Offline generator for compressed Terminal fonts
+# ----------------------------------
+#
+# Project Pervasive Displays Library Suite
+# Based on highView technology
+#
+# Created by Rei Vilo, 19 Oct 2026
+#
+# Copyright (c) Rei Vilo, 2010-2025
+# Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+# For exclusive use with Pervasive Displays screens
+#
+# Release 821: Initial release
+#
+# Usage, from the root of the library
+#   python3 extras/Fonts/Terminal_Compress.py
+#
+# Reads src/Terminal<W>x<H>e.h and writes src/Terminal<W>x<H>c.h
+#
+# Compressed format, see hV_Font.h
+# * Dictionary of up to 255 columns, each column with roundUp(height, 8) bytes
+# * Offsets of the glyphs in the stream, number + 1 entries
+# * Stream with one record per glyph
+#   - Empty glyph: no record
+#   - Header byte: first column << 4 | (number of columns - 1), blank columns trimmed
+#   - Then one token per column: index in the dictionary, or 0xff followed by the raw column
+#
+
+import os
+import re
+import sys
+
+ESCAPE = 0xff
+DICTIONARY_MAX = 255
+
+FONTS = ["Terminal8x12", "Terminal12x16", "Terminal16x24"]
+
+HEADER = """///
+/// @file {name}c.h
+/// @brief Font {title}, compressed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Generated by extras/Fonts/Terminal_Compress.py from {name}e.h, do not edit
+///
+
+#ifndef {guard}
+///
+/// @brief Library release number
+///
+#define {guard} 821
+
+"""
+
+
+def readFont(path):
+    """Read the glyphs of an uncompressed Terminal font"""
+    with open(path, encoding="latin-1") as handle:
+        source = handle.read()
+
+    match = re.search(r"static const uint8_t (\w+)\[(\d+)\]\[(\d+)\]", source)
+    number, size = int(match.group(2)), int(match.group(3))
+    body = source[match.end():source.index("};", match.end())]
+    body = re.sub(r"//[^\n]*", "", body)
+
+    # Glyphs with or without inner braces
+    values = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+    assert len(values) == number * size, "Wrong table size in " + path
+    glyphs = [values[i:i + size] for i in range(0, len(values), size)]
+
+    return glyphs
+
+
+def splitColumns(glyph, rows):
+    return [tuple(glyph[i:i + rows]) for i in range(0, len(glyph), rows)]
+
+
+def trim(columns, rows):
+    """First column and used columns, blank columns on both sides removed"""
+    blank = tuple([0] * rows)
+    used = [i for i, column in enumerate(columns) if column != blank]
+    if not used:
+        return 0, []
+    return used[0], columns[used[0]:used[-1] + 1]
+
+
+def compress(glyphs, width, rows):
+    trimmed = [trim(splitColumns(glyph, rows), rows) for glyph in glyphs]
+
+    # Dictionary of the most frequent columns, only when used more than once
+    frequency = {}
+    for _, columns in trimmed:
+        for column in columns:
+            frequency[column] = frequency.get(column, 0) + 1
+    ranked = sorted(frequency, key=lambda column: (-frequency[column], column))
+    dictionary = [column for column in ranked if frequency[column] > 1][:DICTIONARY_MAX]
+    indexes = {column: index for index, column in enumerate(dictionary)}
+
+    offsets = []
+    stream = []
+    for start, columns in trimmed:
+        offsets.append(len(stream))
+        if not columns:
+            continue
+        assert start < 16 and len(columns) <= 16
+        stream.append((start << 4) | (len(columns) - 1))
+        for column in columns:
+            if column in indexes:
+                stream.append(indexes[column])
+            else:
+                stream.append(ESCAPE)
+                stream.extend(column)
+    offsets.append(len(stream))
+
+    assert len(stream) < 0x10000
+    return dictionary, offsets, stream
+
+
+def decompress(dictionary, offsets, stream, character, width, rows):
+    """Reference decoder, same as hV_Font_Terminal::f_decodeGlyph()"""
+    glyph = [0] * (width * rows)
+    pointer = offsets[character]
+    if pointer == offsets[character + 1]:
+        return glyph
+
+    header = stream[pointer]
+    pointer += 1
+    column = header >> 4
+    for _ in range((header & 0x0f) + 1):
+        token = stream[pointer]
+        pointer += 1
+        if token == ESCAPE:
+            values = stream[pointer:pointer + rows]
+            pointer += rows
+        else:
+            values = dictionary[token]
+        glyph[column * rows:(column + 1) * rows] = values
+        column += 1
+
+    return glyph
+
+
+def formatBytes(values, indent):
+    return indent + ", ".join("0x%02X" % value for value in values)
+
+
+def writeFont(path, name, dictionary, offsets, stream, rows):
+    title = name.replace("Terminal", "Terminal ").replace("x", " x ")
+    guard = name.upper().split("X")[0] + "C_FONT_RELEASE"
+
+    with open(path, "w", encoding="latin-1", newline="\n") as handle:
+        handle.write(HEADER.format(name=name, title=title, guard=guard))
+
+        handle.write("///\n/// @brief Dictionary of columns\n///\n")
+        handle.write("static const uint8_t %sc_dictionary[%d][%d] =\n{\n" % (name, len(dictionary), rows))
+        lines = ["    { " + ", ".join("0x%02X" % value for value in column) + " }" for column in dictionary]
+        handle.write(",\n".join(lines) + "\n};\n\n")
+
+        handle.write("///\n/// @brief Offsets of the glyphs in the stream\n///\n")
+        handle.write("static const uint16_t %sc_offsets[%d] =\n{\n" % (name, len(offsets)))
+        lines = ["    " + ", ".join("%d" % value for value in offsets[i:i + 16]) for i in range(0, len(offsets), 16)]
+        handle.write(",\n".join(lines) + "\n};\n\n")
+
+        handle.write("///\n/// @brief Stream of compressed glyphs\n///\n")
+        handle.write("static const uint8_t %sc[%d] =\n{\n" % (name, len(stream)))
+        lines = [formatBytes(stream[i:i + 16], "    ") for i in range(0, len(stream), 16)]
+        handle.write(",\n".join(lines) + "\n};\n\n")
+
+        handle.write("#endif // %s\n" % guard)
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "src")
+    total = 0
+    saved = 0
+
+    print("Font            Original  Compressed  Dictionary  Saved")
+    for name in FONTS:
+        width, height = [int(value) for value in name[len("Terminal"):].split("x")]
+        rows = (height + 7) // 8
+
+        glyphs = readFont(os.path.join(root, name + "e.h"))
+        dictionary, offsets, stream = compress(glyphs, width, rows)
+
+        # Check round-trip
+        for character, glyph in enumerate(glyphs):
+            if decompress(dictionary, offsets, stream, character, width, rows) != glyph:
+                sys.exit("Round-trip failed for %s, glyph %d" % (name, character))
+
+        writeFont(os.path.join(root, name + "c.h"), name, dictionary, offsets, stream, rows)
+
+        original = len(glyphs) * width * rows
+        compressed = len(dictionary) * rows + 2 * len(offsets) + len(stream)
+        total += original
+        saved += original - compressed
+        print("%-14s %9d %11d %11d %5d%%" % (name, original, compressed, len(dictionary),
+                                           100 * (original - compressed) // original))
+
+    print("Total %d bytes, saved %d bytes" % (total, saved))
+
+
+if __name__ == "__main__":
+    main()
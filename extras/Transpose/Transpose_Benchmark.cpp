@@ -0,0 +1,141 @@
+//
+// Transpose_Benchmark.cpp
+// Host benchmark for the transpose of 8x8 bit matrices
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// Release 821: Initial release
+//
+// Usage, from the root of the library
+//   c++ -O2 -Isrc extras/Transpose/Transpose_Benchmark.cpp src/hV_Transpose.cpp -o Transpose_Benchmark
+//   ./Transpose_Benchmark
+//
+// Add -DTRANSPOSE_MODE=0 to force the portable version.
+//
+// Reports the cost of converting a frame-buffer of 416 x 240 pixels,
+// 8 pixels per byte along the lines, into a row-major image,
+// with the naive per-bit loop, the portable SWAR version and the selected version.
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "hV_Transpose.h"
+
+// Same size as the 3.70" screen
+#define LINES 416 ///< Lines of the frame-buffer
+#define PIXELS 240 ///< Pixels per line
+
+static const uint16_t bytesLine = PIXELS / 8;
+static const uint16_t bytesRow = LINES / 8;
+
+static void convertNaive(const uint8_t * buffer, uint8_t * image)
+{
+    memset(image, 0x00, bytesRow * PIXELS);
+    for (uint16_t line = 0; line < LINES; line += 1)
+    {
+        for (uint16_t pixel = 0; pixel < PIXELS; pixel += 1)
+        {
+            if (buffer[line * bytesLine + pixel / 8] & (0x80 >> (pixel % 8)))
+            {
+                image[pixel * bytesRow + line / 8] |= 0x80 >> (line % 8);
+            }
+        }
+    }
+}
+
+static void convertSWAR(const uint8_t * buffer, uint8_t * image)
+{
+    for (uint16_t j = 0; j < bytesLine; j += 1)
+    {
+        for (uint16_t k = 0; k < bytesRow; k += 1)
+        {
+            uint64_t value = 0;
+            for (uint8_t row = 0; row < 8; row += 1)
+            {
+                value = (value << 8) | buffer[(k * 8 + row) * bytesLine + j];
+            }
+
+            value = transpose8x8(value);
+            for (uint8_t column = 0; column < 8; column += 1)
+            {
+                image[(j * 8 + column) * bytesRow + k] = (uint8_t)(value >> (56 - 8 * column));
+            }
+        }
+    }
+}
+
+static void convertSelected(const uint8_t * buffer, uint8_t * image)
+{
+    for (uint16_t j = 0; j < bytesLine; j += 1)
+    {
+        for (uint16_t k = 0; k < bytesRow; k += 1)
+        {
+            transpose8x8(buffer + k * 8 * bytesLine + j, bytesLine, image + j * 8 * bytesRow + k, bytesRow);
+        }
+    }
+}
+
+typedef void (*convert_t)(const uint8_t *, uint8_t *);
+
+static double measure(convert_t convert, const uint8_t * buffer, uint8_t * image, uint32_t loops)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < loops; loop += 1)
+    {
+        convert(buffer, image);
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / loops;
+}
+
+int main()
+{
+    static const char * modes[] = { "SWAR", "SSE2", "NEON" };
+    static uint8_t buffer[LINES * bytesLine];
+    static uint8_t reference[PIXELS * bytesRow];
+    static uint8_t image[PIXELS * bytesRow];
+    const uint32_t loops = 200;
+
+    srand(821);
+    for (uint32_t index = 0; index < sizeof(buffer); index += 1)
+    {
+        buffer[index] = rand();
+    }
+
+    // Check
+    convertNaive(buffer, reference);
+    convertSWAR(buffer, image);
+    if (memcmp(image, reference, sizeof(image)) != 0)
+    {
+        printf("SWAR differs\n");
+        return 1;
+    }
+    convertSelected(buffer, image);
+    if (memcmp(image, reference, sizeof(image)) != 0)
+    {
+        printf("%s differs\n", modes[TRANSPOSE_MODE]);
+        return 1;
+    }
+
+    double naive = measure(convertNaive, buffer, image, loops);
+    double swar = measure(convertSWAR, buffer, image, loops);
+    double selected = measure(convertSelected, buffer, image, loops);
+
+    printf("Version,us/frame,Speed-up\n");
+    printf("Naive,%.1f,1.0\n", naive);
+    printf("SWAR,%.1f,%.1f\n", swar, naive / swar);
+    printf("%s,%.1f,%.1f\n", modes[TRANSPOSE_MODE], selected, naive / selected);
+
+    return 0;
+}
@@ -39,6 +39,21 @@
 // Release 805: Improved stability
 // Release 806: New library for Wide temperature only
 // Release 808: Improved stability
+// Release 821: Added group of screens with overlapped refreshes
+// Release 821: Added rectangle fill by bytes
+// Release 821: Added monochrome bitmap by bytes
+// Release 821: Added image export, rotation and mirror with 8x8 transpose
+// Release 821: Added pattern fill and invert by bytes
+// Release 821: Added preferred bitmap format for canvases
+// Release 821: Added command scripts for COG sequences
+// Release 821: Added SPI speed and upload time statistics
+// Release 821: Added timing profile
+// Release 821: Added support for 969_PS_0B and B98_PS_0B
+// Release 821: Added temperature compensation tables for medium screens
+// Release 821: Added DC/DC soft-start stepper for medium screens
+// Release 821: Added warm resume and wake-up time statistics
+// Release 821: Added suspend of the SPI bus
+// Release 821: Added energy estimator and counters
 //
 
 // Library header
@@ -57,17 +72,88 @@
 //
 // --- Medium screens with P film
 //
+///
+/// @brief Temperature compensation, register 0x45, medium and large screens
+/// @note Linear interpolation between points, value of the first or last point beyond
+///
+static constexpr temperaturePoint_s temperature343_fast[] = { { 21, 0xc9 }, { 22, 0xca } };
+static constexpr temperaturePoint_s temperature343_global[] = { { 0, 0x50 }, { 50, 0xb4 } }; // 0x82@25C
+static constexpr temperaturePoint_s temperature581_fast[] = { { 0, 0xa8 }, { 50, 0xda } }; // 0xc1@25C
+static constexpr temperaturePoint_s temperature581_global[] = { { -15, 0x19 }, { 60, 0x64 } }; // 0x41@25C
+
+///
+/// @brief Script for initial COG, medium screens
+/// @note Reference = COG_data, value 0 = indexTemperature
+/// @note Application note § 3.1 Initial flow chart
+/// @note Burst off, one /CS per command as in the application note, not validated on the medium COGs
+///
+static const uint8_t scriptMediumP_update[] =
+{
+    SCRIPT_BURST, 0,
+    SCRIPT_COMMAND, 0x05, 1, 0x7d,
+    SCRIPT_DELAY, 50,
+    SCRIPT_COMMAND, 0x05, 1, 0x00,
+    SCRIPT_DELAY, 1,
+    SCRIPT_COMMAND_OTP, 0xd8, 1, 0x1c, // MS_SYNC
+    SCRIPT_COMMAND_OTP, 0xd6, 1, 0x1d, // BVSS
+
+    SCRIPT_COMMAND, 0xa7, 1, 0x10,
+    SCRIPT_DELAY, 2,
+    SCRIPT_COMMAND, 0xa7, 1, 0x00,
+    SCRIPT_DELAY, 10,
+
+    SCRIPT_COMMAND, 0x44, 1, 0x00,
+    SCRIPT_COMMAND, 0x45, 1, 0x80,
+
+    SCRIPT_COMMAND, 0xa7, 1, 0x10,
+    SCRIPT_DELAY, 2,
+    SCRIPT_COMMAND, 0xa7, 1, 0x00,
+    SCRIPT_DELAY, 10,
+
+    SCRIPT_COMMAND, 0x44, 1, 0x06,
+    SCRIPT_COMMAND_VALUE, 0x45, 0, // indexTemperature
+
+    SCRIPT_COMMAND, 0xa7, 1, 0x10,
+    SCRIPT_DELAY, 2,
+    SCRIPT_COMMAND, 0xa7, 1, 0x00,
+    SCRIPT_DELAY, 10,
+
+    SCRIPT_COMMAND_OTP, 0x60, 1, 0x0b, // TCON
+    SCRIPT_COMMAND_OTP, 0x61, 1, 0x1b, // STV_DIR
+    // No DCTL here
+    SCRIPT_COMMAND_OTP, 0x02, 1, 0x11, // VCOM
+    // Fast: no VCOM_CTRL here for Fast
+    SCRIPT_END
+};
+
+///
+/// @brief Script for DC/DC off, medium screens
+/// @note Application note § 5. Turn-off DC/DC
+/// @note Burst off, same as scriptMediumP_update
+///
+static const uint8_t scriptMediumP_powerOff[] =
+{
+    SCRIPT_WAIT_BUSY, HIGH,
+    SCRIPT_BURST, 0,
+    SCRIPT_COMMAND, 0x09, 1, 0x7b,
+    SCRIPT_COMMAND, 0x05, 1, 0x5d,
+    SCRIPT_COMMAND, 0x09, 1, 0x7a,
+    SCRIPT_DELAY, 15,
+    SCRIPT_COMMAND, 0x09, 1, 0x00,
+    SCRIPT_WAIT_BUSY, HIGH, // added
+    SCRIPT_END
+};
+
 void Screen_EPD_EXT3_Fast::COG_MediumP_reset()
 {
     // Application note § 2. Power on COG driver
-    b_reset(5, 2, 4, 20, 5); // Medium
+    s_statistics.reset += b_reset(); // Medium
 }
 
 void Screen_EPD_EXT3_Fast::COG_MediumP_getDataOTP()
 {
     // Read OTP
     uint16_t _readBytes = 0;
-    uint8_t ui8 = 0; // dummy
     u_flagOTP = false;
 
     COG_MediumP_reset();
@@ -98,7 +184,7 @@ void Screen_EPD_EXT3_Fast::COG_MediumP_getDataOTP()
     }
 
     digitalWrite(b_pin.panelDC, HIGH); // Data
-    ui8 = hV_HAL_SPI3_read(); // Dummy
+    hV_HAL_SPI3_read(); // Dummy
 
     // Populate COG_data
     for (uint16_t index = 0; index < _readBytes; index += 1)
@@ -116,6 +202,8 @@ void Screen_EPD_EXT3_Fast::COG_MediumP_getDataOTP()
         case eScreen_EPD_343_PS_0B:
         case eScreen_EPD_343_PS_0B_Touch:
         case eScreen_EPD_581_PS_0B:
+        case eScreen_EPD_969_PS_0B:
+        case eScreen_EPD_B98_PS_0B:
 
             _chipId = 0x10;
             u_flagOTP = (COG_data[0x00] == _chipId);
@@ -148,6 +236,7 @@ void Screen_EPD_EXT3_Fast::COG_MediumP_getDataOTP()
 
 void Screen_EPD_EXT3_Fast::COG_MediumP_initial(uint8_t updateMode)
 {
+    (void)updateMode; // Same for all modes
     uint8_t workDCTL[2];
     workDCTL[0] = COG_data[0x10]; // DCTL
     workDCTL[1] = 0x00;
@@ -195,102 +284,81 @@ void Screen_EPD_EXT3_Fast::COG_MediumP_sendImageData(uint8_t updateMode)
     memcpy(previousBuffer, nextBuffer, u_pageColourSize); // Copy displayed next to previous
 }
 
-void Screen_EPD_EXT3_Fast::COG_MediumP_update(uint8_t updateMode)
+void Screen_EPD_EXT3_Fast::s_fillTemperatureTable(uint8_t * table, const temperaturePoint_s * points, uint8_t number)
 {
-    // Initial COG
-    // Application note § 3.1 Initial flow chart
-    b_sendCommandData8(0x05, 0x7d);
-    delay(50);
-    b_sendCommandData8(0x05, 0x00);
-    delay(1);
-    b_sendCommandData8(0xd8, COG_data[0x1c]); // MS_SYNC
-    b_sendCommandData8(0xd6, COG_data[0x1d]); // BVSS
-
-    b_sendCommandData8(0xa7, 0x10);
-    delay(2);
-    b_sendCommandData8(0xa7, 0x00);
-    delay(10);
+    uint8_t point = 0;
 
-    b_sendCommandData8(0x44, 0x00);
-    b_sendCommandData8(0x45, 0x80);
+    for (int16_t temperature = TEMPERATURE_TABLE_LOW; temperature <= TEMPERATURE_TABLE_HIGH; temperature += 1)
+    {
+        while ((point < number - 1) and (temperature > points[point].temperature))
+        {
+            point += 1;
+        }
 
-    b_sendCommandData8(0xa7, 0x10);
-    delay(2);
-    b_sendCommandData8(0xa7, 0x00);
-    delay(10);
+        // points[point] is the first point at or above the temperature, or the last point
+        int16_t value = points[point].value;
+        if ((point > 0) and (temperature < points[point].temperature))
+        {
+            const temperaturePoint_s & low = points[point - 1];
+            const temperaturePoint_s & high = points[point];
+            value = low.value + (temperature - low.temperature) * (high.value - low.value) / (high.temperature - low.temperature);
+        }
 
-    uint8_t indexTemperature;
+        table[temperature - TEMPERATURE_TABLE_LOW] = value;
+    }
+}
+
+void Screen_EPD_EXT3_Fast::COG_MediumP_temperature()
+{
     switch (u_eScreen_EPD)
     {
         case eScreen_EPD_343_PS_0B:
         case eScreen_EPD_343_PS_0B_Touch:
 
-            switch (updateMode)
-            {
-                case UPDATE_FAST:
-
-                    indexTemperature = (u_temperature < 22) ? 0xc9 : 0xca;
-                    break;
-
-                case UPDATE_GLOBAL:
-
-                    indexTemperature = 2 * u_temperature + 0x50; // Temperature 0x82@25C
-                    // indexTemperature = (u_temperature > 50) ? 0xb4 : indexTemperature;
-                    indexTemperature = checkRange(indexTemperature, (uint8_t)0x50, (uint8_t)0xb4);
-                    break;
-
-                default:
-
-                    break;
-            }
-
-        case eScreen_EPD_581_PS_0B:
-            // case eScreen_EPD_741_PS_0B:
-
-            switch (updateMode)
-            {
-                case UPDATE_FAST:
-
-                    indexTemperature = (u_temperature + 0x28) + 0x80;
-                    // indexTemperature = (u_temperature > 50) ? 0xda : indexTemperature;
-                    // indexTemperature = (u_temperature < 0) ? 0xa8 : indexTemperature;
-                    indexTemperature = checkRange(indexTemperature, (uint8_t)0xa8, (uint8_t)0xda);
-                    break;
-
-                case UPDATE_GLOBAL:
-
-                    indexTemperature = u_temperature + 0x28; // Temperature 0x41@25C
-                    // indexTemperature = (u_temperature > 60) ? 0x64 : indexTemperature;
-                    // indexTemperature = (u_temperature < -15) ? 0x19 : indexTemperature;
-                    indexTemperature = checkRange(indexTemperature, (uint8_t)0x19, (uint8_t)0x64);
-                    break;
-
-                default:
-
-                    break;
-            }
+            s_fillTemperatureTable(s_temperatureTable[0], temperature343_fast, sizeof(temperature343_fast) / sizeof(temperaturePoint_s));
+            s_fillTemperatureTable(s_temperatureTable[1], temperature343_global, sizeof(temperature343_global) / sizeof(temperaturePoint_s));
             break;
 
-        default:
+        default: // eScreen_EPD_581_PS_0B, eScreen_EPD_969_PS_0B, eScreen_EPD_B98_PS_0B
 
+            s_fillTemperatureTable(s_temperatureTable[0], temperature581_fast, sizeof(temperature581_fast) / sizeof(temperaturePoint_s));
+            s_fillTemperatureTable(s_temperatureTable[1], temperature581_global, sizeof(temperature581_global) / sizeof(temperaturePoint_s));
             break;
     }
+}
 
-    b_sendCommandData8(0x44, 0x06);
-    b_sendCommandData8(0x45, indexTemperature);
-
-    b_sendCommandData8(0xa7, 0x10);
-    delay(2);
-    b_sendCommandData8(0xa7, 0x00);
-    delay(10);
+void Screen_EPD_EXT3_Fast::COG_MediumP_update(uint8_t updateMode)
+{
+    // Temperature compensation, tables selected by begin()
+    int8_t temperature = hV_HAL_min(hV_HAL_max(u_temperature, TEMPERATURE_TABLE_LOW), TEMPERATURE_TABLE_HIGH);
+    uint8_t indexTemperature = s_temperatureTable[(updateMode == UPDATE_FAST) ? 0 : 1][temperature - TEMPERATURE_TABLE_LOW];
 
-    b_sendCommandData8(0x60, COG_data[0x0b]); // TCON
-    b_sendCommandData8(0x61, COG_data[0x1b]); // STV_DIR
-    // No DCTL here
-    b_sendCommandData8(0x02, COG_data[0x11]); // VCOM
-    // Fast: no VCOM_CTRL here for Fast
+    // Initial COG
+    // Application note § 3.1 Initial flow chart
+    b_runScript(scriptMediumP_update, COG_data, &indexTemperature);
 
     // DC/DC Soft-start
+    // Application note § 3.3 DC/DC soft-start
+    // Stages compiled by begin()
+    s_softStartStage = 0;
+    s_softStartStep = 0;
+    s_flagSoftStartSecond = false;
+    memcpy(s_softStartPhase, s_softStartStages[0].phase, 2);
+    s_softStartWait = 0;
+    s_softStartStart = micros();
+    s_flagSoftStart = true;
+
+    // Display Refresh Start
+    // Application note § 4 Send updating command
+    // Sent by COG_MediumP_stepSoftStart() at the end of the soft-start
+    if (s_softStartMode == SOFT_START_BLOCKING)
+    {
+        COG_MediumP_stepSoftStart(true);
+    }
+}
+
+void Screen_EPD_EXT3_Fast::COG_MediumP_compileSoftStart()
+{
     // Application note § 3.3 DC/DC soft-start
     // DRIVER_B = 0x28, DRIVER_8 = 0x20
     uint8_t offsetFrame = 0x28;
@@ -316,107 +384,247 @@ void Screen_EPD_EXT3_Fast::COG_MediumP_update(uint8_t updateMode)
     {
         uint8_t offset = offsetFrame + 0x08 * stage;
         uint8_t FORMAT = COG_data[offset] & 0x80;
-        uint8_t REPEAT = COG_data[offset] & 0x7f;
+        softStartStage_s & compiled = s_softStartStages[stage];
+
+        compiled.repeat = COG_data[offset] & 0x7f;
 
         if (FORMAT > 0) // Format 1
         {
-            uint8_t PHL_PHH[2];
-            PHL_PHH[0] = COG_data[offset + 1]; // PHL_INI
-            PHL_PHH[1] = COG_data[offset + 2]; // PHH_INI
-            uint8_t PHL_VAR = COG_data[offset + 3];
-            uint8_t PHH_VAR = COG_data[offset + 4];
-            uint8_t BST_SW_a = COG_data[offset + 5] & _filter09;
-            uint8_t BST_SW_b = COG_data[offset + 6] & _filter09;
-            uint8_t DELAY_SCALE = COG_data[offset + 7] & 0x80;
-            uint16_t DELAY_VALUE = COG_data[offset + 7] & 0x7f;
-
-            for (uint8_t i = 0; i < REPEAT; i += 1)
-            {
-                b_sendCommandData8(0x09, BST_SW_a);
-                PHL_PHH[0] += PHL_VAR; // PHL
-                PHL_PHH[1] += PHH_VAR; // PHH
-                b_sendIndexData(0x51, PHL_PHH, 2);
-                b_sendCommandData8(0x09, BST_SW_b);
+            compiled.phase[0] = COG_data[offset + 1]; // PHL_INI
+            compiled.phase[1] = COG_data[offset + 2]; // PHH_INI
+            compiled.variation[0] = COG_data[offset + 3]; // PHL_VAR
+            compiled.variation[1] = COG_data[offset + 4]; // PHH_VAR
+            compiled.switchA = COG_data[offset + 5] & _filter09; // BST_SW_a
+            compiled.switchB = COG_data[offset + 6] & _filter09; // BST_SW_b
+            compiled.flagPhase = true;
+            compiled.delayA = 0;
+            compiled.delayB = (COG_data[offset + 7] & 0x7f) * ((COG_data[offset + 7] & 0x80) ? 1000 : 10); // DELAY_SCALE, DELAY_VALUE, ms or 10 us
+        }
+        else // Format 2
+        {
+            compiled.switchA = COG_data[offset + 1] & _filter09; // BST_SW_a
+            compiled.switchB = COG_data[offset + 2] & _filter09; // BST_SW_b
+            compiled.flagPhase = false;
+            compiled.delayA = (COG_data[offset + 3] & 0x7f) * ((COG_data[offset + 3] & 0x80) ? 1000 : 10); // DELAY_a, ms or 10 us
+            compiled.delayB = (COG_data[offset + 4] & 0x7f) * ((COG_data[offset + 4] & 0x80) ? 1000 : 10); // DELAY_b, ms or 10 us
+        }
+    }
+}
 
-                if (DELAY_SCALE > 0)
+bool Screen_EPD_EXT3_Fast::COG_MediumP_stepSoftStart(bool flagWait)
+{
+    if (s_flagSoftStart == false)
+    {
+        return false;
+    }
+
+    while (s_softStartStage < 4)
+    {
+        // Delay after the last write
+        if (s_softStartWait > 0)
+        {
+            if (flagWait)
+            {
+                if (s_softStartWait % 1000 == 0)
                 {
-                    delay(DELAY_VALUE); // ms
+                    delay(s_softStartWait / 1000); // ms
                 }
                 else
                 {
-                    delayMicroseconds(10 * DELAY_VALUE); //10 us
+                    delayMicroseconds(s_softStartWait); // 10 us
                 }
             }
-        }
-        else // Format 2
-        {
-            uint8_t BST_SW_a = COG_data[offset + 1] & _filter09;
-            uint8_t BST_SW_b = COG_data[offset + 2] & _filter09;
-            uint8_t DELAY_a_SCALE = COG_data[offset + 3] & 0x80;
-            uint16_t DELAY_a_VALUE = COG_data[offset + 3] & 0x7f;
-            uint8_t DELAY_b_SCALE = COG_data[offset + 4] & 0x80;
-            uint16_t DELAY_b_VALUE = COG_data[offset + 4] & 0x7f;
-
-            for (uint8_t i = 0; i < REPEAT; i += 1)
+            else
             {
-                b_sendCommandData8(0x09, BST_SW_a);
+                uint32_t elapsed = micros() - s_softStartChrono;
 
-                if (DELAY_a_SCALE > 0)
-                {
-                    delay(DELAY_a_VALUE); // ms
-                }
-                else
+                if (elapsed < s_softStartWait)
                 {
-                    delayMicroseconds(10 * DELAY_a_VALUE); // 10 us
+                    // Timing-critical, blocking: within a step, or below 1 ms
+                    if (s_flagSoftStartSecond or (s_softStartWait < 1000))
+                    {
+                        uint32_t remaining = s_softStartWait - elapsed;
+                        delay(remaining / 1000); // ms
+                        delayMicroseconds(remaining % 1000); // us
+                    }
+                    else
+                    {
+                        return true; // Not elapsed, between two steps
+                    }
                 }
+            }
+            s_softStartWait = 0;
+        }
 
-                b_sendCommandData8(0x09, BST_SW_b);
+        const softStartStage_s & stage = s_softStartStages[s_softStartStage];
 
-                if (DELAY_b_SCALE > 0)
-                {
-                    delay(DELAY_b_VALUE); // ms
-                }
-                else
-                {
-                    delayMicroseconds(10 * DELAY_b_VALUE); // 10 us
-                }
+        // Next stage
+        if (s_softStartStep >= stage.repeat)
+        {
+            s_softStartStage += 1;
+            s_softStartStep = 0;
+            if (s_softStartStage < 4)
+            {
+                memcpy(s_softStartPhase, s_softStartStages[s_softStartStage].phase, 2);
+            }
+            continue;
+        }
+
+        if (s_flagSoftStartSecond == false)
+        {
+            b_sendCommandData8(0x09, stage.switchA);
+            if (stage.flagPhase)
+            {
+                s_softStartPhase[0] += stage.variation[0]; // PHL
+                s_softStartPhase[1] += stage.variation[1]; // PHH
+                b_sendIndexData(0x51, s_softStartPhase, 2);
             }
+            s_softStartWait = stage.delayA;
+            s_flagSoftStartSecond = true;
         }
+        else
+        {
+            b_sendCommandData8(0x09, stage.switchB);
+            s_softStartWait = stage.delayB;
+            s_flagSoftStartSecond = false;
+            s_softStartStep += 1;
+        }
+        s_softStartChrono = micros();
+    }
+
+    // End of the soft-start, once
+    if (s_softStartStage == 4)
+    {
+        s_statistics.softStart = micros() - s_softStartStart;
+        s_softStartStage += 1;
     }
 
     // Display Refresh Start
     // Application note § 4 Send updating command
-    b_waitBusy();
+    if (flagWait)
+    {
+        b_waitBusy();
+    }
+    else if (b_checkBusy())
+    {
+        return true; // Not ready
+    }
     b_sendCommandData8(0x15, 0x3c);
+    s_energyRefresh = micros();
+    s_flagSoftStart = false;
+
+    return false;
 }
 
 void Screen_EPD_EXT3_Fast::COG_MediumP_powerOff()
 {
     // Application note § 5. Turn-off DC/DC
+    // FILM_P already checked
+    b_runScript(scriptMediumP_powerOff);
+}
+//
+// --- End of Medium screens with P film
+//
+
+//
+// --- Large screens with P film
+//
+// Same as medium screens, with two COGs, one per half of the screen
+// * Reset, OTP, initial, update and power off as medium screens,
+//   with commands sent to both halves by hV_Board for FAMILY_LARGE
+// * Image data, first half to master and second half to slave
+//
+void Screen_EPD_EXT3_Fast::COG_LargeP_sendImageData(uint8_t updateMode)
+{
+    // Application note § 3.2 Input image to the EPD
+    FRAMEBUFFER_TYPE nextBuffer = s_newImage;
+    FRAMEBUFFER_TYPE previousBuffer = s_newImage + u_pageColourSize;
+    uint32_t halfSize = u_pageColourSize >> 1; // Same as s_getZ()
 
-    // DC-DC off
-    b_waitBusy();
+    // Send image data, settings to both halves
+    b_sendIndexDataSelect(0x13, &COG_data[0x15], 6, PANEL_CS_BOTH); // DUW
+    b_sendIndexDataSelect(0x90, &COG_data[0x0c], 4, PANEL_CS_BOTH); // DRFW
 
-    // FILM_P already checked
-    b_sendCommandData8(0x09, 0x7b);
-    b_sendCommandData8(0x05, 0x5d);
-    b_sendCommandData8(0x09, 0x7a);
-    delay(15);
-    b_sendCommandData8(0x09, 0x00);
+    // Next frame
+    b_sendIndexDataSelect(0x12, &COG_data[0x12], 3, PANEL_CS_BOTH); // RAM_RW
+    b_sendIndexDataSelect(0x10, nextBuffer, halfSize, PANEL_CS_MASTER); // Next frame, first half
+    b_sendIndexDataSelect(0x10, nextBuffer + halfSize, halfSize, PANEL_CS_SLAVE); // Next frame, second half
+
+    b_sendIndexDataSelect(0x12, &COG_data[0x12], 3, PANEL_CS_BOTH); // RAM_RW
+    switch (updateMode)
+    {
+        case UPDATE_GLOBAL:
+
+            // Previous frame = dummy, same for both halves
+            b_sendIndexFixedSelect(0x11, 0x00, halfSize, PANEL_CS_BOTH);
+            break;
+
+        case UPDATE_FAST:
+
+            // Previous frame
+            b_sendIndexDataSelect(0x11, previousBuffer, halfSize, PANEL_CS_MASTER); // Previous frame, first half
+            b_sendIndexDataSelect(0x11, previousBuffer + halfSize, halfSize, PANEL_CS_SLAVE); // Previous frame, second half
+            break;
+
+        default:
+
+            break;
+    }
 
-    b_waitBusy(HIGH); // added
+    // Copy next frame to previous frame
+    memcpy(previousBuffer, nextBuffer, u_pageColourSize); // Copy displayed next to previous
 }
 //
-// --- End of Medium screens with P film
+// --- End of Large screens with P film
 //
 
 //
 // --- Small screens with P film
 //
+///
+/// @brief Script for soft-reset and temperature, small screens
+/// @note Value 0 = indexTemperature
+/// @note Application note § 4. Input initial command
+///
+static const uint8_t scriptSmallP_initial[] =
+{
+    SCRIPT_COMMAND, 0x00, 1, 0x0e, // Soft-reset
+    SCRIPT_WAIT_BUSY, HIGH,
+    SCRIPT_COMMAND_VALUE, 0xe5, 0, // Input Temperature
+    SCRIPT_COMMAND, 0xe0, 1, 0x02, // Activate Temperature
+    SCRIPT_END
+};
+
+///
+/// @brief Script for update, small screens
+/// @note Application note § 6. Send updating command
+///
+static const uint8_t scriptSmallP_update[] =
+{
+    SCRIPT_WAIT_BUSY, HIGH,
+    SCRIPT_COMMAND, 0x04, 0, // Power on
+    SCRIPT_WAIT_BUSY, HIGH,
+    SCRIPT_COMMAND, 0x12, 0, // Display Refresh
+    // Wait for end of refresh moved to COG_SmallP_powerOff()
+    SCRIPT_END
+};
+
+///
+/// @brief Script for DC/DC off, small screens
+/// @note Application note § 7. Turn-off DC/DC
+///
+static const uint8_t scriptSmallP_powerOff[] =
+{
+    SCRIPT_WAIT_BUSY, HIGH, // Wait for end of refresh
+    SCRIPT_COMMAND, 0x02, 0, // Turn off DC/DC
+    SCRIPT_WAIT_BUSY, HIGH,
+    SCRIPT_END
+};
+
 void Screen_EPD_EXT3_Fast::COG_SmallP_reset()
 {
     // Application note § 2. Power on COG driver
-    b_reset(5, 5, 10, 5, 5); // Small
+    s_statistics.reset += b_reset(); // Small
 
     // Check after reset
     // No check
@@ -675,11 +883,7 @@ void Screen_EPD_EXT3_Fast::COG_SmallP_initial(uint8_t updateMode)
             } // u_codeExtra updateMode
 
             // New algorithm
-            b_sendCommandData8(0x00, 0x0e); // Soft-reset
-            b_waitBusy();
-
-            b_sendCommandData8(0xe5, indexTemperature); // Input Temperature
-            b_sendCommandData8(0xe0, 0x02); // Activate Temperature
+            b_runScript(scriptSmallP_initial, 0, &indexTemperature);
 
             if (u_codeSize == SIZE_290) // No PSR
             {
@@ -703,6 +907,7 @@ void Screen_EPD_EXT3_Fast::COG_SmallP_initial(uint8_t updateMode)
 
 void Screen_EPD_EXT3_Fast::COG_SmallP_sendImageData(uint8_t updateMode)
 {
+    (void)updateMode; // Same for all modes
     // Application note § 5. Input image to the EPD
     FRAMEBUFFER_TYPE nextBuffer = s_newImage;
     FRAMEBUFFER_TYPE previousBuffer = s_newImage + u_pageColourSize;
@@ -729,6 +934,7 @@ void Screen_EPD_EXT3_Fast::COG_SmallP_sendImageData(uint8_t updateMode)
 
 void Screen_EPD_EXT3_Fast::COG_SmallP_update(uint8_t updateMode)
 {
+    (void)updateMode; // Same for all modes
     // Application note § 6. Send updating command
     switch (u_eScreen_EPD)
     {
@@ -738,18 +944,12 @@ void Screen_EPD_EXT3_Fast::COG_SmallP_update(uint8_t updateMode)
             b_waitBusy(LOW); // 152 specific
             b_sendCommand8(0x20); // Display Refresh
             digitalWrite(b_pin.panelCS, HIGH); // CS# = 1
-            b_waitBusy(LOW); // 152 specific
+            // Wait for end of refresh moved to COG_SmallP_powerOff()
             break;
 
         default:
 
-            b_waitBusy();
-
-            b_sendCommand8(0x04); // Power on
-            b_waitBusy();
-
-            b_sendCommand8(0x12); // Display Refresh
-            b_waitBusy();
+            b_runScript(scriptSmallP_update);
             break;
     }
 }
@@ -762,12 +962,12 @@ void Screen_EPD_EXT3_Fast::COG_SmallP_powerOff()
         case eScreen_EPD_150_KS_0J:
         case eScreen_EPD_152_KS_0J:
 
+            b_waitBusy(LOW); // 152 specific
             break;
 
         default:
 
-            b_sendCommand8(0x02); // Turn off DC/DC
-            b_waitBusy();
+            b_runScript(scriptSmallP_powerOff);
             break;
     }
 }
@@ -779,6 +979,100 @@ void Screen_EPD_EXT3_Fast::COG_SmallP_powerOff()
 // === End of COG section
 //
 
+//
+// === Energy section
+//
+///
+/// @brief Default current models, per family
+/// @note Placeholders at 3.3 V, not measured, to be replaced by measures on the actual board
+///
+static constexpr energyModel_s energyModelSmall = { 3300, 1500, 0, 3000, 10 }; // DC/DC within the refresh
+static constexpr energyModel_s energyModelMedium = { 3300, 2000, 8000, 6000, 20 };
+static constexpr energyModel_s energyModelLarge = { 3300, 4000, 16000, 12000, 40 }; // Two COGs
+
+void Screen_EPD_EXT3_Fast::s_energyAdd(uint64_t charge)
+{
+    s_energyCharge_pC += charge;
+    s_energyWork_nJ += charge * s_energyModel.voltage / 1000000; // pC x mV = fJ, / 1000000 = nJ
+}
+
+void Screen_EPD_EXT3_Fast::s_energyStartIdle()
+{
+    if ((s_flagEnergyIdle == false) and ((b_fsmPowerScreen & FSM_GPIO_MASK) == FSM_GPIO_MASK))
+    {
+        s_energyIdleChrono = millis();
+        s_flagEnergyIdle = true;
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_energyStopIdle()
+{
+    if (s_flagEnergyIdle)
+    {
+        uint32_t idle = millis() - s_energyIdleChrono; // ms, for long periods
+        uint64_t charge = (uint64_t)idle * 1000 * s_energyModel.idle; // us x uA = pC
+
+        s_energyCounters.idle += idle;
+        s_energyPending += charge;
+        s_energyAdd(charge);
+        s_flagEnergyIdle = false;
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_energyUpdate()
+{
+    // Small screens turn the DC/DC on with the refresh
+    uint32_t chronoDCDC = (b_family == FAMILY_SMALL) ? s_energyRefresh : s_softStartStart;
+
+    uint64_t charge = (uint64_t)s_statistics.wake * s_energyModel.idle; // us x uA = pC
+    charge += (uint64_t)(chronoDCDC - s_energyCommand) * s_energyModel.command;
+    charge += (uint64_t)(s_energyRefresh - chronoDCDC) * s_energyModel.dcdc;
+    charge += (uint64_t)s_statistics.refresh * s_energyModel.refresh;
+    s_energyAdd(charge);
+    s_energyCounters.updates += 1;
+
+    // Powered idle since the previous update included
+    charge += s_energyPending;
+    s_energyPending = 0;
+    s_statistics.charge = charge / 1000; // nC
+    s_statistics.energy = charge * s_energyModel.voltage / 1000000000; // pC x mV = fJ, / 1000000000 = uJ
+}
+
+void Screen_EPD_EXT3_Fast::setEnergyModel(energyModel_s model)
+{
+    s_energyModel = model;
+}
+
+energyModel_s Screen_EPD_EXT3_Fast::getEnergyModel()
+{
+    return s_energyModel;
+}
+
+energyCounters_s Screen_EPD_EXT3_Fast::getEnergyCounters()
+{
+    // Powered idle up to now
+    if (s_flagEnergyIdle)
+    {
+        s_energyStopIdle();
+        s_energyStartIdle();
+    }
+
+    energyCounters_s counters = s_energyCounters;
+    counters.charge = s_energyCharge_pC / 1000; // pC / 1000 = nC
+    counters.energy = s_energyWork_nJ / 1000; // nJ / 1000 = uJ
+    return counters;
+}
+
+void Screen_EPD_EXT3_Fast::resetEnergyCounters()
+{
+    s_energyCounters = { 0, 0, 0, 0 };
+    s_energyCharge_pC = 0;
+    s_energyWork_nJ = 0;
+}
+//
+// === End of Energy section
+//
+
 //
 // === Class section
 //
@@ -788,6 +1082,9 @@ Screen_EPD_EXT3_Fast::Screen_EPD_EXT3_Fast(eScreen_EPD_t eScreen_EPD_EXT3, pins_
     b_pin = board;
     s_newImage = 0; // nullptr
     COG_data[0] = 0;
+    s_statistics = {};
+    s_energyPending = 0;
+    resetEnergyCounters();
 }
 
 void Screen_EPD_EXT3_Fast::begin()
@@ -841,18 +1138,21 @@ void Screen_EPD_EXT3_Fast::begin()
         case SIZE_581: // 5.81"
         case SIZE_741: // 7.41"
 
-            b_begin(b_pin, FAMILY_MEDIUM, 0);
+            b_begin(b_pin, FAMILY_MEDIUM);
+            s_energyModel = energyModelMedium;
             break;
 
         case SIZE_969: // 9.69"
         case SIZE_1198: // 11.98"
 
-            b_begin(b_pin, FAMILY_LARGE, 50);
+            b_begin(b_pin, FAMILY_LARGE);
+            s_energyModel = energyModelLarge;
             break;
 
         default:
 
-            b_begin(b_pin, FAMILY_SMALL, 0);
+            b_begin(b_pin, FAMILY_SMALL);
+            s_energyModel = energyModelSmall;
             break;
     }
 
@@ -946,6 +1246,18 @@ void Screen_EPD_EXT3_Fast::begin()
             v_screenSizeH = 176; // horizontal = small size
             break;
 
+        case SIZE_969: // 9.69", two COGs
+
+            v_screenSizeV = 672; // v = wide size
+            v_screenSizeH = 960; // Actually, 960 = 480 x 2, h = small size
+            break;
+
+        case SIZE_1198: // 11.98", two COGs
+
+            v_screenSizeV = 768; // v = wide size
+            v_screenSizeH = 960; // Actually, 960 = 480 x 2, h = small size
+            break;
+
         // Those screens are not available with embedded fast update or wide temperature
         //         case SIZE_565: // 5.65"
         //
@@ -964,18 +1276,6 @@ void Screen_EPD_EXT3_Fast::begin()
         //             v_screenSizeV = 800; // v = wide size
         //             v_screenSizeH = 480; // h = small size
         //             break;
-        //
-        //         case SIZE_969: // 9.69"
-        //
-        //             v_screenSizeV = 672; // v = wide size
-        //             v_screenSizeH = 960; // Actually, 960 = 480 x 2, h = small size
-        //             break;
-        //
-        //         case SIZE_1198: // 11.98"
-        //
-        //             v_screenSizeV = 768; // v = wide size
-        //             v_screenSizeH = 960; // Actually, 960 = 480 x 2, h = small size
-        //             break;
 
         default:
 
@@ -1023,6 +1323,12 @@ void Screen_EPD_EXT3_Fast::begin()
 
     memset(s_newImage, 0x00, u_pageColourSize * u_bufferDepth);
 
+    // Temperature compensation tables
+    if ((b_family == FAMILY_MEDIUM) or (b_family == FAMILY_LARGE))
+    {
+        COG_MediumP_temperature();
+    }
+
     setTemperatureC(25); // 25 Celsius = 77 Fahrenheit
     b_fsmPowerScreen = FSM_OFF;
     if (b_pin.panelPower != NOT_CONNECTED)
@@ -1034,6 +1340,15 @@ void Screen_EPD_EXT3_Fast::begin()
     // Reset panel and get tables
     resume();
 
+    // DC/DC soft-start stages, from OTP
+    if ((b_family == FAMILY_MEDIUM) or (b_family == FAMILY_LARGE))
+    {
+        COG_MediumP_compileSoftStart();
+    }
+
+    // Powered idle until the first update
+    s_energyStartIdle();
+
     // Fonts
     hV_Screen_Buffer::begin(); // Standard
 
@@ -1068,29 +1383,39 @@ STRING_TYPE Screen_EPD_EXT3_Fast::WhoAmI()
 
 void Screen_EPD_EXT3_Fast::suspend(uint8_t suspendScope)
 {
-    if (((suspendScope & FSM_GPIO_MASK) == FSM_GPIO_MASK) and (b_pin.panelPower != NOT_CONNECTED))
+    // Power, only if panelPower is connected
+    if ((suspendScope & FSM_GPIO_MASK) == FSM_GPIO_MASK)
     {
-        if ((b_fsmPowerScreen & FSM_GPIO_MASK) == FSM_GPIO_MASK)
-        {
-            b_suspend();
-        }
+        b_suspend();
+    }
+
+    // Powered idle ends with the power
+    if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
+    {
+        s_energyStopIdle();
+    }
+
+    // SPI bus
+    if ((suspendScope & FSM_BUS_MASK) == FSM_BUS_MASK)
+    {
+        b_suspendBus();
     }
 }
 
 void Screen_EPD_EXT3_Fast::resume()
 {
     // Target   FSM_ON
-    // Source   FSM_OFF
-    //          FSM_SLEEP
-    if (b_fsmPowerScreen != FSM_ON)
+    // Source   FSM_OFF, power off, GPIOs not configured, SPI off
+    //          FSM_SLEEP, power off, GPIOs configured, SPI on
+    //          GPIO and power on, SPI off: warm, no reset
+    if ((b_fsmPowerScreen & FSM_ON) != FSM_ON)
     {
+        // Power off or first start
         if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
         {
-            b_resume(); // GPIO
+            b_resume(); // Power and GPIO
 
             s_reset(); // Reset
-
-            b_fsmPowerScreen |= FSM_GPIO_MASK;
         }
 
         // Check type and get tables
@@ -1102,7 +1427,11 @@ void Screen_EPD_EXT3_Fast::resume()
         }
 
         // Start SPI, with unicity check
-        hV_HAL_SPI_begin(); // Standard 8 MHz
+        if ((b_fsmPowerScreen & FSM_BUS_MASK) != FSM_BUS_MASK)
+        {
+            hV_HAL_SPI_begin(b_speedSPI, b_busOwner); // Standard 8 MHz, or as set by setSpeedSPI()
+            b_fsmPowerScreen |= FSM_BUS_MASK;
+        }
     }
 }
 
@@ -1111,6 +1440,7 @@ void Screen_EPD_EXT3_Fast::s_reset()
     switch (b_family)
     {
         case FAMILY_MEDIUM:
+        case FAMILY_LARGE:
 
             COG_MediumP_reset();
             break;
@@ -1128,7 +1458,8 @@ void Screen_EPD_EXT3_Fast::s_reset()
 
 void Screen_EPD_EXT3_Fast::s_getDataOTP()
 {
-    hV_HAL_SPI_end(); // With unicity check
+    hV_HAL_SPI_end(b_busOwner, true); // Forced, SPI pins used for 3-wire SPI
+    b_fsmPowerScreen &= ~FSM_BUS_MASK;
 
     hV_HAL_SPI3_begin(); // Define 3-wire SPI pins
 
@@ -1136,6 +1467,7 @@ void Screen_EPD_EXT3_Fast::s_getDataOTP()
     switch (b_family)
     {
         case FAMILY_MEDIUM:
+        case FAMILY_LARGE:
 
             COG_MediumP_getDataOTP();
             break;
@@ -1153,27 +1485,84 @@ void Screen_EPD_EXT3_Fast::s_getDataOTP()
 
 void Screen_EPD_EXT3_Fast::s_flush(uint8_t updateMode)
 {
+    s_flushStart(updateMode);
+    s_flushEnd();
+}
+
+void Screen_EPD_EXT3_Fast::s_flushStart(uint8_t updateMode)
+{
+    // Powered idle since the previous update
+    s_energyStopIdle();
+
     // Resume
-    if (b_fsmPowerScreen != FSM_ON)
+    s_statistics.reset = 0;
+    s_statistics.softStart = 0;
+    s_statistics.wake = 0;
+    if ((b_fsmPowerScreen & FSM_ON) != FSM_ON)
     {
+        uint32_t chronoWake = micros();
         resume();
+        s_statistics.wake = micros() - chronoWake;
     }
+    b_applySpeedSPI(); // Shared SPI bus
+    s_energyCommand = micros();
+
+    uint32_t chrono;
+    s_statistics.speedSPI = b_speedSPI;
+    s_statistics.bytes = 2 * u_pageColourSize; // Next and previous frames
 
     switch (b_family)
     {
         case FAMILY_MEDIUM:
 
             COG_MediumP_initial(updateMode); // Initialise
+            chrono = micros();
             COG_MediumP_sendImageData(updateMode); // Send image data
+            s_statistics.upload = micros() - chrono;
+            COG_MediumP_update(updateMode); // Update
+            break;
+
+        case FAMILY_LARGE:
+
+            COG_MediumP_initial(updateMode); // Initialise
+            chrono = micros();
+            COG_LargeP_sendImageData(updateMode); // Send image data
+            s_statistics.upload = micros() - chrono;
             COG_MediumP_update(updateMode); // Update
-            COG_MediumP_powerOff(); // Power off
             break;
 
         case FAMILY_SMALL:
 
             COG_SmallP_initial(updateMode); // Initialise
+            chrono = micros();
             COG_SmallP_sendImageData(updateMode); // Send image data
+            s_statistics.upload = micros() - chrono;
             COG_SmallP_update(updateMode); // Update
+            s_energyRefresh = micros();
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_flushEnd()
+{
+    // Complete the soft-start, SOFT_START_POLLED
+    COG_MediumP_stepSoftStart(true);
+
+    // Wait for end of refresh
+    switch (b_family)
+    {
+        case FAMILY_MEDIUM:
+        case FAMILY_LARGE:
+
+            COG_MediumP_powerOff(); // Power off
+            break;
+
+        case FAMILY_SMALL:
+
             COG_SmallP_powerOff(); // Power off
             break;
 
@@ -1181,12 +1570,17 @@ void Screen_EPD_EXT3_Fast::s_flush(uint8_t updateMode)
 
             break;
     }
+    s_statistics.refresh = micros() - s_energyRefresh;
+    s_energyUpdate();
 
     // Suspend
     if (u_suspendMode == POWER_MODE_AUTO)
     {
         suspend(u_suspendScope);
     }
+
+    // Powered idle until the next update, if not suspended
+    s_energyStartIdle();
 }
 
 uint8_t Screen_EPD_EXT3_Fast::flushMode(uint8_t updateMode)
@@ -1216,18 +1610,83 @@ void Screen_EPD_EXT3_Fast::flush()
     flushMode(UPDATE_FAST);
 }
 
-void Screen_EPD_EXT3_Fast::clear(uint16_t colour)
+uint8_t Screen_EPD_EXT3_Fast::flushStart(uint8_t updateMode)
 {
-    if (colour == myColours.grey)
+    updateMode = checkTemperatureMode(updateMode);
+
+    switch (updateMode)
     {
-        // black = 0-1, white = 0-0
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
-        {
-            uint8_t pattern = (i % 2) ? 0b10101010 : 0b01010101;
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
+        case UPDATE_FAST:
+        case UPDATE_GLOBAL:
+
+            s_flushStart(UPDATE_FAST);
+            break;
+
+        default:
+
+            mySerial.println();
+            mySerial.println("hV ! PDLS - UPDATE_NONE invoked");
+            break;
+    }
+
+    return updateMode;
+}
+
+bool Screen_EPD_EXT3_Fast::isBusy()
+{
+    bool result = false;
+
+    // Soft-start and refresh, SOFT_START_POLLED
+    if (s_flagSoftStart)
+    {
+        COG_MediumP_stepSoftStart(false);
+        return true;
+    }
+
+    switch (u_eScreen_EPD)
+    {
+        case eScreen_EPD_150_KS_0J:
+        case eScreen_EPD_152_KS_0J:
+
+            result = b_checkBusy(LOW); // 152 specific
+            break;
+
+        default:
+
+            result = b_checkBusy();
+            break;
+    }
+
+    return result;
+}
+
+void Screen_EPD_EXT3_Fast::flushEnd()
+{
+    s_flushEnd();
+}
+
+flushStatistics_s Screen_EPD_EXT3_Fast::getFlushStatistics()
+{
+    return s_statistics;
+}
+
+void Screen_EPD_EXT3_Fast::setSoftStartMode(uint8_t mode)
+{
+    s_softStartMode = mode;
+}
+
+void Screen_EPD_EXT3_Fast::clear(uint16_t colour)
+{
+    if (colour == myColours.grey)
+    {
+        // black = 0-1, white = 0-0
+        for (uint16_t i = 0; i < u_bufferSizeV; i++)
+        {
+            uint8_t pattern = (i % 2) ? 0b10101010 : 0b01010101;
+            for (uint16_t j = 0; j < u_bufferSizeH; j++)
+            {
+                s_newImage[i * u_bufferSizeH + j] = pattern;
+            }
         }
     }
     else if ((colour == myColours.white) xor u_invert)
@@ -1244,6 +1703,7 @@ void Screen_EPD_EXT3_Fast::clear(uint16_t colour)
 
 void Screen_EPD_EXT3_Fast::regenerate(uint8_t mode)
 {
+    (void)mode; // Fast update only
     clear(myColours.black);
     flush();
     delay(100);
@@ -1293,6 +1753,612 @@ void Screen_EPD_EXT3_Fast::s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
     }
 }
 
+///
+/// @brief Action on the frame-buffer for a colour
+/// @param colour 16-bit colour
+/// @param flagInvert inverted colours
+/// @return 0 = none, 1 = clear bit, 2 = set bit
+/// @note Same as s_setPoint()
+///
+static uint8_t bitmapAction(uint16_t colour, bool flagInvert)
+{
+    if ((colour == myColours.white) xor flagInvert)
+    {
+        return 1;
+    }
+    else if ((colour == myColours.black) xor flagInvert)
+    {
+        return 2;
+    }
+    return 0;
+}
+
+///
+/// @brief Get 8 bits of a line of a bitmap
+/// @param source line of the bitmap
+/// @param start index of the first bit, may be negative
+/// @param number number of bytes of the line
+/// @param flagLSB true = least significant bit first
+/// @return bits start..start+7, first bit as MSB, 0 outside the line
+///
+static uint8_t bitmapFetch(const uint8_t * source, int32_t start, int32_t number, bool flagLSB)
+{
+    int32_t index = (start >= 0) ? (start >> 3) : -((7 - start) >> 3); // Floor
+    uint8_t shift = start - index * 8;
+    uint8_t result = 0;
+
+    if ((index >= 0) and (index < number))
+    {
+        result = (flagLSB ? reverseBits(source[index]) : source[index]) << shift;
+    }
+    index += 1;
+    if ((shift > 0) and (index >= 0) and (index < number))
+    {
+        result |= (flagLSB ? reverseBits(source[index]) : source[index]) >> (8 - shift);
+    }
+    return result;
+}
+
+///
+/// @brief Write 8 bits of a bitmap into a byte of the frame-buffer
+/// @param target byte of the frame-buffer
+/// @param bits bits of the bitmap
+/// @param mask bits to be written
+/// @param actionFront action for the bits set, from bitmapAction(), or 3 = invert bit
+/// @param actionBack action for the bits clear, from bitmapAction()
+///
+static void bitmapWrite(uint8_t & target, uint8_t bits, uint8_t mask, uint8_t actionFront, uint8_t actionBack)
+{
+    if (actionFront == 2)
+    {
+        target |= bits & mask;
+    }
+    else if (actionFront == 1)
+    {
+        target &= ~(bits & mask);
+    }
+    else if (actionFront == 3)
+    {
+        target ^= bits & mask;
+    }
+
+    if (actionBack == 2)
+    {
+        target |= ~bits & mask;
+    }
+    else if (actionBack == 1)
+    {
+        target &= ~(~bits & mask);
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_fillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    // Split frame-buffers point by point
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        hV_Screen_Buffer::s_fillRectangle(x1, y1, x2, y2, colour);
+        return;
+    }
+
+    uint8_t masks[8];
+    if (colour == myColours.grey)
+    {
+        // Same as s_setPoint(), black for even sum of physical coordinates
+        for (uint8_t line = 0; line < 8; line += 1)
+        {
+            masks[line] = (line % 2 == 0) ? 0xaa : 0x55;
+        }
+        s_fillMasks(x1, y1, x2, y2, masks, bitmapAction(myColours.black, u_invert), bitmapAction(myColours.white, u_invert));
+    }
+    else
+    {
+        memset(masks, 0xff, 8);
+        s_fillMasks(x1, y1, x2, y2, masks, bitmapAction(colour, u_invert), 0);
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_fillPattern(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                         uint64_t pattern, uint16_t frontColour, uint16_t backColour,
+                                         bool flagTransparent)
+{
+    // Combined colours and split frame-buffers point by point
+    if ((frontColour == myColours.grey) or (backColour == myColours.grey) or (u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        hV_Screen_Buffer::s_fillPattern(x1, y1, x2, y2, pattern, frontColour, backColour, flagTransparent);
+        return;
+    }
+
+    uint8_t masks[8];
+    s_patternMasks(pattern, masks);
+    s_fillMasks(x1, y1, x2, y2, masks, bitmapAction(frontColour, u_invert), flagTransparent ? 0 : bitmapAction(backColour, u_invert));
+}
+
+void Screen_EPD_EXT3_Fast::s_invertRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint64_t pattern)
+{
+    uint8_t masks[8];
+    s_patternMasks(pattern, masks);
+
+    // Split frame-buffers point by point
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        for (uint16_t x = x1; x <= x2; x += 1)
+        {
+            for (uint16_t y = y1; y <= y2; y += 1)
+            {
+                uint16_t x0 = x;
+                uint16_t y0 = y;
+                if ((s_orientCoordinates(x0, y0) == RESULT_SUCCESS) and bitRead(masks[x0 % 8], s_getB(x0, y0)))
+                {
+                    s_newImage[s_getZ(x0, y0)] ^= (1 << s_getB(x0, y0));
+                }
+            }
+        }
+        return;
+    }
+
+    s_fillMasks(x1, y1, x2, y2, masks, 3, 0);
+}
+
+void Screen_EPD_EXT3_Fast::s_patternMasks(uint64_t pattern, uint8_t * masks)
+{
+    // Rows of the pattern along the lines for orientations 0 and 2, columns for 1 and 3
+    uint64_t work = (v_orientation % 2 == 0) ? pattern : transpose8x8(pattern);
+
+    for (uint8_t line = 0; line < 8; line += 1)
+    {
+        // Row or column of the pattern for the line, reversed when the line runs backwards
+        uint8_t index = ((v_orientation == 0) or (v_orientation == 1)) ? line : (v_screenSizeV - 1 - line) % 8;
+        uint8_t value = (uint8_t)(work >> (56 - 8 * index));
+
+        masks[line] = ((v_orientation == 0) or (v_orientation == 3)) ? value : reverseBits(value);
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_fillMasks(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                       const uint8_t * masks, uint8_t actionFront, uint8_t actionBack)
+{
+    // Clip and orient corners
+    x2 = hV_HAL_min(x2, screenSizeX() - 1);
+    y2 = hV_HAL_min(y2, screenSizeY() - 1);
+    if ((x1 > x2) or (y1 > y2))
+    {
+        return;
+    }
+    s_orientCoordinates(x1, y1);
+    s_orientCoordinates(x2, y2);
+    if (x1 > x2)
+    {
+        hV_HAL_swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        hV_HAL_swap(y1, y2);
+    }
+
+    // Bytes along y, from MSB = first pixel
+    uint16_t z1 = y1 >> 3;
+    uint16_t z2 = y2 >> 3;
+    uint8_t mask1 = 0xff >> (y1 & 0x07);
+    uint8_t mask2 = 0xff << (7 - (y2 & 0x07));
+    if (z1 == z2)
+    {
+        mask1 &= mask2;
+    }
+
+    // Plain colour, full bytes set at once
+    bool flagPlain = (actionBack == 0) and ((actionFront == 1) or (actionFront == 2));
+
+    for (uint16_t x = x1; x <= x2; x += 1)
+    {
+        uint8_t * line = s_newImage + (uint32_t)x * u_bufferSizeH;
+        uint8_t bits = masks[x % 8];
+
+        bitmapWrite(line[z1], bits, mask1, actionFront, actionBack);
+        if (z2 > z1)
+        {
+            if (flagPlain and (bits == 0xff))
+            {
+                memset(line + z1 + 1, (actionFront == 2) ? 0xff : 0x00, z2 - z1 - 1);
+            }
+            else
+            {
+                for (uint16_t z = z1 + 1; z < z2; z += 1)
+                {
+                    bitmapWrite(line[z], bits, 0xff, actionFront, actionBack);
+                }
+            }
+            bitmapWrite(line[z2], bits, mask2, actionFront, actionBack);
+        }
+    }
+}
+
+uint8_t Screen_EPD_EXT3_Fast::bitmapFormat()
+{
+    return (v_orientation % 2 == 0) ? BITMAP_ROW_MSB : BITMAP_COLUMN_MSB;
+}
+
+void Screen_EPD_EXT3_Fast::s_drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                        const uint8_t * bitmap, uint16_t stride, uint16_t offset,
+                                        uint16_t frontColour, uint16_t backColour,
+                                        bool flagTransparent, uint8_t format)
+{
+    bool flagColumn = ((format & BITMAP_COLUMN_MSB) == BITMAP_COLUMN_MSB);
+    bool flagLSB = ((format & BITMAP_ROW_LSB) == BITMAP_ROW_LSB);
+
+    // Rows along the lines of the frame-buffer for orientations 0 and 2, columns for 1 and 3
+    bool flagMatch = flagColumn xor (v_orientation % 2 == 0);
+
+    // Combined colours and split frame-buffers point by point
+    if ((frontColour == myColours.grey) or (backColour == myColours.grey) or (u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        hV_Screen_Buffer::s_drawBitmap(x0, y0, dx, dy, bitmap, stride, offset, frontColour, backColour, flagTransparent, format);
+        return;
+    }
+
+    // Other orientations by blocks of 8 x 8 pixels
+    if (flagMatch == false)
+    {
+        s_drawBitmapTransposed(x0, y0, dx, dy, bitmap, stride, offset, frontColour, backColour, flagTransparent, format);
+        return;
+    }
+
+    uint8_t actionFront = bitmapAction(frontColour, u_invert);
+    uint8_t actionBack = flagTransparent ? 0 : bitmapAction(backColour, u_invert);
+
+    // Major axis across the lines, minor axis along the lines
+    uint16_t numberMajor = flagColumn ? dx : dy;
+    uint16_t numberMinor = flagColumn ? dy : dx;
+    uint16_t startMajor = flagColumn ? x0 : y0;
+    uint16_t startMinor = flagColumn ? y0 : x0;
+    uint16_t limitMajor = flagColumn ? screenSizeX() : screenSizeY();
+    uint16_t limitMinor = flagColumn ? screenSizeY() : screenSizeX();
+
+    if ((startMinor >= limitMinor) or (startMajor >= limitMajor))
+    {
+        return;
+    }
+    numberMajor = hV_HAL_min(numberMajor, limitMajor - startMajor);
+    uint16_t length = hV_HAL_min(numberMinor, limitMinor - startMinor); // Visible pixels per line
+    int32_t bytes = (offset + length + 7) / 8; // Visible bytes per line of the bitmap
+
+    // Direct copy for opaque black on white, from a full byte
+    bool flagCopy = (flagLSB == false) and (actionFront == 2) and (actionBack == 1) and ((offset & 0x07) == 0);
+
+    for (uint16_t major = 0; major < numberMajor; major += 1)
+    {
+        // First and last pixels, oriented
+        uint16_t xa = flagColumn ? x0 + major : x0;
+        uint16_t ya = flagColumn ? y0 : y0 + major;
+        uint16_t xb = flagColumn ? xa : x0 + length - 1;
+        uint16_t yb = flagColumn ? y0 + length - 1 : ya;
+        s_orientCoordinates(xa, ya);
+        s_orientCoordinates(xb, yb);
+
+        bool flagForward = (yb >= ya);
+        uint16_t low = hV_HAL_min(ya, yb);
+        uint16_t high = hV_HAL_max(ya, yb);
+        uint8_t * line = s_newImage + (uint32_t)xa * u_bufferSizeH;
+        const uint8_t * source = bitmap + (uint32_t)major * stride;
+        uint16_t z = low >> 3;
+
+        // Same packing, full bytes copied
+        if (flagCopy and flagForward and ((low & 0x07) == 0))
+        {
+            memcpy(line + z, source + (offset >> 3), length >> 3);
+            z += length >> 3;
+        }
+
+        // Shift and mask
+        for (; z <= (high >> 3); z += 1)
+        {
+            uint8_t mask = 0xff;
+            if (z == (low >> 3))
+            {
+                mask &= 0xff >> (low & 0x07);
+            }
+            if (z == (high >> 3))
+            {
+                mask &= 0xff << (7 - (high & 0x07));
+            }
+
+            uint8_t bits;
+            if (flagForward)
+            {
+                bits = bitmapFetch(source, (int32_t)z * 8 - low + offset, bytes, flagLSB);
+            }
+            else
+            {
+                bits = reverseBits(bitmapFetch(source, (int32_t)high - z * 8 - 7 + offset, bytes, flagLSB));
+            }
+
+            bitmapWrite(line[z], bits, mask, actionFront, actionBack);
+        }
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_drawBitmapTransposed(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                                  const uint8_t * bitmap, uint16_t stride, uint16_t offset,
+                                                  uint16_t frontColour, uint16_t backColour,
+                                                  bool flagTransparent, uint8_t format)
+{
+    bool flagColumn = ((format & BITMAP_COLUMN_MSB) == BITMAP_COLUMN_MSB);
+    bool flagLSB = ((format & BITMAP_ROW_LSB) == BITMAP_ROW_LSB);
+
+    uint8_t actionFront = bitmapAction(frontColour, u_invert);
+    uint8_t actionBack = flagTransparent ? 0 : bitmapAction(backColour, u_invert);
+
+    // Major axis along the lines, minor axis across the lines
+    uint16_t numberMajor = flagColumn ? dx : dy;
+    uint16_t numberMinor = flagColumn ? dy : dx;
+    uint16_t startMajor = flagColumn ? x0 : y0;
+    uint16_t startMinor = flagColumn ? y0 : x0;
+    uint16_t limitMajor = flagColumn ? screenSizeX() : screenSizeY();
+    uint16_t limitMinor = flagColumn ? screenSizeY() : screenSizeX();
+
+    if ((startMinor >= limitMinor) or (startMajor >= limitMajor))
+    {
+        return;
+    }
+    numberMajor = hV_HAL_min(numberMajor, limitMajor - startMajor);
+    uint16_t length = hV_HAL_min(numberMinor, limitMinor - startMinor); // Visible pixels per line of the bitmap
+    int32_t bytes = (offset + length + 7) / 8; // Visible bytes per line of the bitmap
+
+    // First and last pixels, oriented
+    uint16_t xa = x0;
+    uint16_t ya = y0;
+    uint16_t xb = flagColumn ? x0 + numberMajor - 1 : x0 + length - 1;
+    uint16_t yb = flagColumn ? y0 + length - 1 : y0 + numberMajor - 1;
+    s_orientCoordinates(xa, ya);
+    s_orientCoordinates(xb, yb);
+
+    // Minor axis to lines, major axis to positions along a line
+    int8_t stepLine = (xb >= xa) ? 1 : -1;
+    bool flagForward = (yb >= ya);
+    uint8_t block[8];
+
+    for (uint16_t major = 0; major < numberMajor; major += 8)
+    {
+        uint8_t count = hV_HAL_min(numberMajor - major, 8);
+        uint8_t valid = 0xff << (8 - count);
+
+        // Lowest position of the 8 pixels, may be negative when reversed
+        int32_t low = flagForward ? (int32_t)ya + major : (int32_t)ya - major - 7;
+        int32_t z = ((low + 8) >> 3) - 1;
+        uint8_t shift = (low + 8) & 0x07;
+
+        for (uint16_t minor = 0; minor < length; minor += 8)
+        {
+            // 8 lines of the bitmap, 8 pixels each
+            for (uint8_t index = 0; index < 8; index += 1)
+            {
+                block[index] = (index < count) ? bitmapFetch(bitmap + (uint32_t)(major + index) * stride, minor + offset, bytes, flagLSB) : 0x00;
+            }
+            transpose8x8(block, 1, block, 1);
+
+            uint8_t columns = hV_HAL_min(length - minor, 8);
+            for (uint8_t column = 0; column < columns; column += 1)
+            {
+                uint8_t bits = block[column];
+                uint8_t mask = valid;
+                if (flagForward == false)
+                {
+                    bits = reverseBits(bits);
+                    mask = reverseBits(mask);
+                }
+
+                // Across two bytes when not aligned
+                uint16_t bits16 = (uint16_t)bits << (8 - shift);
+                uint16_t mask16 = (uint16_t)mask << (8 - shift);
+                uint8_t * line = s_newImage + (uint32_t)(xa + stepLine * (int32_t)(minor + column)) * u_bufferSizeH;
+
+                if ((z >= 0) and ((mask16 >> 8) != 0))
+                {
+                    bitmapWrite(line[z], bits16 >> 8, mask16 >> 8, actionFront, actionBack);
+                }
+                if ((z + 1 < u_bufferSizeH) and ((mask16 & 0xff) != 0))
+                {
+                    bitmapWrite(line[z + 1], bits16 & 0xff, mask16 & 0xff, actionFront, actionBack);
+                }
+            }
+        }
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_reverseLine(uint8_t * line)
+{
+    // Bytes and bits reversed
+    for (uint16_t index = 0; index < u_bufferSizeH / 2; index += 1)
+    {
+        uint8_t value = line[index];
+        line[index] = reverseBits(line[u_bufferSizeH - 1 - index]);
+        line[u_bufferSizeH - 1 - index] = reverseBits(value);
+    }
+    if (u_bufferSizeH % 2 == 1)
+    {
+        line[u_bufferSizeH / 2] = reverseBits(line[u_bufferSizeH / 2]);
+    }
+}
+
+void Screen_EPD_EXT3_Fast::s_swapLines(uint16_t line1, uint16_t line2)
+{
+    uint8_t * pointer1 = s_newImage + (uint32_t)line1 * u_bufferSizeH;
+    uint8_t * pointer2 = s_newImage + (uint32_t)line2 * u_bufferSizeH;
+
+    for (uint16_t index = 0; index < u_bufferSizeH; index += 1)
+    {
+        hV_HAL_swap(pointer1[index], pointer2[index]);
+    }
+}
+
+bool Screen_EPD_EXT3_Fast::exportImage(uint8_t * image)
+{
+    // Split frame-buffers not supported
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    uint16_t sizeX = screenSizeX();
+    uint16_t sizeY = screenSizeY();
+    uint16_t stride = (sizeX + 7) / 8;
+
+    if (v_orientation % 2 == 0)
+    {
+        // Rows along the lines
+        for (uint16_t y = 0; y < sizeY; y += 1)
+        {
+            uint8_t * row = image + (uint32_t)y * stride;
+            uint16_t line = (v_orientation == 0) ? y : v_screenSizeV - 1 - y;
+
+            memcpy(row, s_newImage + (uint32_t)line * u_bufferSizeH, stride);
+            if (v_orientation == 2)
+            {
+                s_reverseLine(row);
+            }
+        }
+    }
+    else
+    {
+        // Rows across the lines, blocks of 8 x 8 pixels
+        uint8_t block[8];
+        for (uint16_t j = 0; j < sizeY / 8; j += 1)
+        {
+            // Byte along the line for rows 8j..8j+7
+            uint16_t z = (v_orientation == 1) ? u_bufferSizeH - 1 - j : j;
+
+            for (uint16_t k = 0; k < stride; k += 1)
+            {
+                for (uint8_t index = 0; index < 8; index += 1)
+                {
+                    uint16_t x = k * 8 + index;
+                    if (x < sizeX)
+                    {
+                        uint16_t line = (v_orientation == 1) ? x : v_screenSizeV - 1 - x;
+                        uint8_t value = s_newImage[(uint32_t)line * u_bufferSizeH + z];
+                        block[index] = (v_orientation == 1) ? reverseBits(value) : value;
+                    }
+                    else
+                    {
+                        block[index] = 0x00;
+                    }
+                }
+                transpose8x8(block, 1, image + (uint32_t)j * 8 * stride + k, stride);
+            }
+        }
+    }
+
+    // 1 = black, padding bits cleared
+    uint8_t padding = 0xff << ((stride * 8 - sizeX) % 8);
+    for (uint16_t y = 0; y < sizeY; y += 1)
+    {
+        uint8_t * row = image + (uint32_t)y * stride;
+        if (u_invert)
+        {
+            for (uint16_t k = 0; k < stride; k += 1)
+            {
+                row[k] = ~row[k];
+            }
+        }
+        row[stride - 1] &= padding;
+    }
+
+    return RESULT_SUCCESS;
+}
+
+void Screen_EPD_EXT3_Fast::importImage(const uint8_t * image)
+{
+    // Full screen, regardless of viewport and clip rectangle
+    s_drawBitmap(0, 0, screenSizeX(), screenSizeY(), image, (screenSizeX() + 7) / 8, 0, myColours.black, myColours.white, false, BITMAP_ROW_MSB);
+}
+
+bool Screen_EPD_EXT3_Fast::rotate90()
+{
+    // Square screens only
+    if ((v_screenSizeV != v_screenSizeH) or (u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    // Transpose, block (A, B) with block (B, A)
+    uint16_t blocks = v_screenSizeH / 8;
+    uint16_t strideLine = u_bufferSizeH;
+    uint8_t block[8];
+
+    for (uint16_t a = 0; a < blocks; a += 1)
+    {
+        uint8_t * diagonal = s_newImage + (uint32_t)a * 8 * strideLine + a;
+        transpose8x8(diagonal, strideLine, diagonal, strideLine);
+
+        for (uint16_t b = a + 1; b < blocks; b += 1)
+        {
+            uint8_t * blockAB = s_newImage + (uint32_t)a * 8 * strideLine + b;
+            uint8_t * blockBA = s_newImage + (uint32_t)b * 8 * strideLine + a;
+
+            transpose8x8(blockAB, strideLine, block, 1);
+            transpose8x8(blockBA, strideLine, blockAB, strideLine);
+            for (uint8_t index = 0; index < 8; index += 1)
+            {
+                blockBA[index * strideLine] = block[index];
+            }
+        }
+    }
+
+    // Transpose and mirror, same for all orientations
+    for (uint16_t line = 0; line < v_screenSizeV; line += 1)
+    {
+        s_reverseLine(s_newImage + (uint32_t)line * u_bufferSizeH);
+    }
+
+    return RESULT_SUCCESS;
+}
+
+bool Screen_EPD_EXT3_Fast::rotate180()
+{
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    // Lines in reverse order, pixels in reverse order
+    for (uint16_t line = 0; line < v_screenSizeV / 2; line += 1)
+    {
+        s_swapLines(line, v_screenSizeV - 1 - line);
+    }
+    for (uint16_t line = 0; line < v_screenSizeV; line += 1)
+    {
+        s_reverseLine(s_newImage + (uint32_t)line * u_bufferSizeH);
+    }
+
+    return RESULT_SUCCESS;
+}
+
+bool Screen_EPD_EXT3_Fast::mirror(bool flagHorizontal)
+{
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    // Logical x-axis along the lines for orientations 0 and 2
+    if (flagHorizontal xor (v_orientation % 2 == 1))
+    {
+        for (uint16_t line = 0; line < v_screenSizeV; line += 1)
+        {
+            s_reverseLine(s_newImage + (uint32_t)line * u_bufferSizeH);
+        }
+    }
+    else
+    {
+        for (uint16_t line = 0; line < v_screenSizeV / 2; line += 1)
+        {
+            s_swapLines(line, v_screenSizeV - 1 - line);
+        }
+    }
+
+    return RESULT_SUCCESS;
+}
+
 void Screen_EPD_EXT3_Fast::s_setOrientation(uint8_t orientation)
 {
     v_orientation = orientation % 4;
@@ -1373,6 +2439,7 @@ uint32_t Screen_EPD_EXT3_Fast::s_getZ(uint16_t x1, uint16_t y1)
 
 uint16_t Screen_EPD_EXT3_Fast::s_getB(uint16_t x1, uint16_t y1)
 {
+    (void)x1; // Bit along the y-axis only
     uint16_t b1 = 0;
 
     b1 = 7 - (y1 % 8);
@@ -1382,12 +2449,99 @@ uint16_t Screen_EPD_EXT3_Fast::s_getB(uint16_t x1, uint16_t y1)
 
 uint16_t Screen_EPD_EXT3_Fast::s_getPoint(uint16_t x1, uint16_t y1)
 {
+    (void)x1; // Not implemented
+    (void)y1;
     return 0x0000;
 }
 //
 // === End of Class section
 //
 
+//
+// === Group section
+//
+Screen_EPD_EXT3_Group::Screen_EPD_EXT3_Group()
+{
+    g_number = 0;
+    g_periodPoll = 32;
+}
+
+bool Screen_EPD_EXT3_Group::add(Screen_EPD_EXT3_Fast * screen)
+{
+    if (g_number >= SCREEN_GROUP_MAX)
+    {
+        return RESULT_ERROR;
+    }
+
+    g_screen[g_number] = screen;
+    g_number += 1;
+    return RESULT_SUCCESS;
+}
+
+uint8_t Screen_EPD_EXT3_Group::getNumber()
+{
+    return g_number;
+}
+
+void Screen_EPD_EXT3_Group::begin()
+{
+    for (uint8_t index = 0; index < g_number; index += 1)
+    {
+        g_screen[index]->begin();
+    }
+}
+
+void Screen_EPD_EXT3_Group::setPeriodPoll(uint16_t period)
+{
+    g_periodPoll = period;
+}
+
+void Screen_EPD_EXT3_Group::flush()
+{
+    flushCount(UPDATE_FAST);
+}
+
+uint8_t Screen_EPD_EXT3_Group::flushCount(uint8_t updateMode)
+{
+    bool flagPending[SCREEN_GROUP_MAX];
+    uint8_t countPending = 0;
+
+    // Uploads, serialised on the SPI bus
+    // Each screen starts its refresh as soon as its upload is done
+    for (uint8_t index = 0; index < g_number; index += 1)
+    {
+        flagPending[index] = (g_screen[index]->flushStart(updateMode) != UPDATE_NONE);
+        countPending += flagPending[index] ? 1 : 0;
+    }
+
+    uint8_t result = countPending;
+
+    // Refreshes, overlapped
+    // Each screen is completed as soon as its refresh is done
+    while (countPending > 0)
+    {
+        for (uint8_t index = 0; index < g_number; index += 1)
+        {
+            if (flagPending[index] and (g_screen[index]->isBusy() == false))
+            {
+                g_screen[index]->flushEnd();
+                flagPending[index] = false;
+                countPending -= 1;
+            }
+        }
+
+        if (countPending > 0)
+        {
+            delay(g_periodPoll); // Blocking, between two polls
+        }
+    }
+
+    return result;
+}
+//
+// === End of Group section
+//
+
 //
 // === Touch section
 //
@@ -1395,4 +2549,3 @@ uint16_t Screen_EPD_EXT3_Fast::s_getPoint(uint16_t x1, uint16_t y1)
 //
 // === End of Touch section
 //
-
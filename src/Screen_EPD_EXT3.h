@@ -68,6 +68,9 @@
 // PDLS utilities
 #include "hV_Utilities_PDLS.h"
 
+// Transpose
+#include "hV_Transpose.h"
+
 // Checks
 #if (hV_HAL_PERIPHERALS_RELEASE < 812)
 #error Required hV_HAL_PERIPHERALS_RELEASE 812
@@ -85,6 +88,10 @@
 #error Required hV_BOARD_RELEASE 812
 #endif // hV_BOARD_RELEASE
 
+#if (hV_TRANSPOSE_RELEASE < 821)
+#error Required hV_TRANSPOSE_RELEASE 821
+#endif // hV_TRANSPOSE_RELEASE
+
 #ifndef SCREEN_EPD_EXT3_RELEASE
 ///
 /// @brief Library release number
@@ -103,6 +110,96 @@
 #define WITH_FAST_FRIENDS ///< File and serial access
 /// @}
 
+///
+/// @brief Statistics of the last update
+///
+struct flushStatistics_s
+{
+    uint32_t speedSPI; ///< SPI speed, Hz
+    uint32_t bytes; ///< Image data sent, bytes
+    uint32_t upload; ///< Upload of the image data, us
+    uint32_t reset; ///< Resets of the panel before the update, us, 0 if none
+    uint32_t softStart; ///< DC/DC soft-start, us, 0 if none
+    uint32_t wake; ///< Wake-up before the first command, power, reset and SPI, us, 0 if already awake
+    uint32_t refresh; ///< Refresh until the end of the DC/DC power off, us
+    uint32_t charge; ///< Estimated charge, powered idle since the previous update included, nC
+    uint32_t energy; ///< Estimated energy, powered idle since the previous update included, uJ
+};
+
+///
+/// @name DC/DC soft-start modes
+/// @note Medium and large screens only
+/// @{
+#define SOFT_START_BLOCKING 0x00 ///< Soft-start completed by flushStart(), default
+#define SOFT_START_POLLED 0x01 ///< Soft-start stepped by isBusy() after flushStart()
+/// @}
+
+///
+/// @brief Stage of the DC/DC soft-start, compiled from the OTP memory
+/// @details Each step writes switchA to register 0x09, then the phases to register 0x51 if flagPhase,
+/// waits delayA, writes switchB to register 0x09 and waits delayB
+///
+struct softStartStage_s
+{
+    uint8_t repeat; ///< Number of steps
+    uint8_t switchA; ///< Register 0x09, first value
+    uint8_t switchB; ///< Register 0x09, second value
+    bool flagPhase; ///< Register 0x51 written, format 1
+    uint8_t phase[2]; ///< Register 0x51, initial PHL and PHH
+    uint8_t variation[2]; ///< Register 0x51, PHL and PHH increments per step
+    uint32_t delayA; ///< Delay after the first value, us
+    uint32_t delayB; ///< Delay after the second value, us
+};
+
+///
+/// @brief Current model of the panel, for the energy estimator
+/// @details Each phase of an update is counted at its current
+/// * command, initial commands and upload of the image data
+/// * DC/DC, soft-start until the refresh starts
+/// * refresh, refresh until the end of the DC/DC power off
+/// * idle, wake-up and powered idle between updates, panel powered and DC/DC off
+/// @warning Default values per family are placeholders, not measures,
+/// so the estimates are only relative until setEnergyModel() sets currents measured on the actual board
+///
+struct energyModel_s
+{
+    uint16_t voltage; ///< Supply voltage, mV
+    uint32_t command; ///< Current during commands and upload, uA
+    uint32_t dcdc; ///< Current during the DC/DC soft-start, uA
+    uint32_t refresh; ///< Current during the refresh, uA
+    uint32_t idle; ///< Current while powered and idle, uA
+};
+
+///
+/// @brief Energy counters since boot or since resetEnergyCounters()
+///
+struct energyCounters_s
+{
+    uint32_t updates; ///< Number of updates
+    uint64_t charge; ///< Estimated charge, nC
+    uint64_t energy; ///< Estimated energy, uJ
+    uint64_t idle; ///< Powered idle between updates, ms
+};
+
+///
+/// @brief Point of a temperature compensation table
+/// @details Linear interpolation between points, value of the first or last point beyond
+///
+struct temperaturePoint_s
+{
+    int8_t temperature; ///< Temperature, °C
+    uint8_t value; ///< Value of the register
+};
+
+///
+/// @name Temperature compensation table
+/// @details Range of the table filled by begin(), temperatures beyond read the first or last value
+/// @{
+#define TEMPERATURE_TABLE_LOW -15 ///< Lowest temperature, °C
+#define TEMPERATURE_TABLE_HIGH 60 ///< Highest temperature, °C
+#define TEMPERATURE_TABLE_SIZE (TEMPERATURE_TABLE_HIGH - TEMPERATURE_TABLE_LOW + 1) ///< Entries per mode
+/// @}
+
 // Objects
 //
 ///
@@ -136,15 +233,21 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
 
     ///
     /// @brief Suspend
-    /// @param suspendScope default = POWER_SCOPE_GPIO_ONLY, otherwise POWER_SCOPE_NONE
-    /// @details Power off and set all GPIOs low
+    /// @param suspendScope default = POWER_SCOPE_GPIO_ONLY, otherwise POWER_SCOPE_NONE or POWER_SCOPE_BUS_GPIO
+    /// @details Power off and set all GPIOs low, with POWER_SCOPE_BUS_GPIO release the SPI bus and park its pins
     /// @note If panelPower is NOT_CONNECTED, POWER_SCOPE_GPIO_ONLY defaults to POWER_SCOPE_NONE
+    /// @note The SPI bus remains on while another device has registered on it
+    /// @note The SPI bus also remains on if flashCS or cardCS is connected, as these devices do not register
     ///
     void suspend(uint8_t suspendScope = POWER_SCOPE_GPIO_ONLY);
 
     ///
     /// @brief Resume after suspend()
-    /// @details Turn SPI on and set all GPIOs levels
+    /// @details Restore only what was suspended
+    /// * after power off, turn power on and reset the panel,
+    /// * configure the GPIOs the first time only,
+    /// * start SPI if not started.
+    /// @note The OTP memory is read once
     ///
     void resume();
 
@@ -186,6 +289,121 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     uint8_t flushMode(uint8_t updateMode = UPDATE_FAST);
 
+    ///
+    /// @brief Start the update of the display
+    /// @details Send next frame-buffer to the screen and start the refresh, without waiting for the end of the refresh
+    /// @param updateMode expected update mode, default = UPDATE_FAST
+    /// @return uint8_t recommended mode
+    /// @note Mode checked with checkTemperatureMode()
+    /// @warning flushEnd() is required to complete the update
+    ///
+    uint8_t flushStart(uint8_t updateMode = UPDATE_FAST);
+
+    ///
+    /// @brief Check whether the refresh is still on-going
+    /// @return true if busy, false if ready
+    /// @note Non-blocking
+    ///
+    bool isBusy();
+
+    ///
+    /// @brief Complete the update of the display
+    /// @details Wait for the end of the refresh and turn off DC/DC
+    /// @note Blocking until the end of the refresh, check isBusy() before to avoid waiting
+    ///
+    void flushEnd();
+
+    ///
+    /// @brief Get the statistics of the last update
+    /// @return statistics
+    /// @note Upload time includes the delays for /CS
+    ///
+    flushStatistics_s getFlushStatistics();
+
+    ///
+    /// @brief Set the DC/DC soft-start mode
+    /// @param mode default = SOFT_START_BLOCKING, otherwise SOFT_START_POLLED
+    /// @details With SOFT_START_POLLED, flushStart() returns after the upload,
+    /// each call to isBusy() performs the steps due, then starts the refresh.
+    /// @note Medium and large screens only, as small screens have no soft-start
+    /// @note Only the delays of 1 ms and more between two steps are left to the application,
+    /// the delays within a step and below 1 ms are blocking, as timing-critical
+    /// @note Each call to isBusy() performs all the steps overdue at once,
+    /// but each delay left to the application is extended until the next call:
+    /// call isBusy() at least every 1 ms to keep the soft-start within the delays of the OTP memory
+    /// @note flush() and flushEnd() complete the soft-start if required
+    /// @note Keep SOFT_START_BLOCKING for the screens of a group, as the group polls every 32 ms by default, see setPeriodPoll()
+    ///
+    void setSoftStartMode(uint8_t mode = SOFT_START_BLOCKING);
+
+    ///
+    /// @brief Set the current model for the energy estimator
+    /// @param model supply voltage and current per phase
+    /// @note begin() sets the default model of the family, call setEnergyModel() after begin()
+    ///
+    void setEnergyModel(energyModel_s model);
+
+    ///
+    /// @brief Get the current model for the energy estimator
+    /// @return model
+    ///
+    energyModel_s getEnergyModel();
+
+    ///
+    /// @brief Get the energy counters
+    /// @return counters since boot or since resetEnergyCounters(), powered idle up to now included
+    /// @note Estimates, from the durations of the phases and the current model
+    ///
+    energyCounters_s getEnergyCounters();
+
+    ///
+    /// @brief Reset the energy counters
+    ///
+    void resetEnergyCounters();
+
+    ///
+    /// @brief Copy the frame-buffer into a monochrome image
+    /// @param[out] image row-major image, (screenSizeX() + 7) / 8 bytes per row, screenSizeY() rows
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note Same format as drawBitmap() with BITMAP_ROW_MSB, 1 = black, for the current orientation
+    /// @note Lines copied for orientations 0 and 2, blocks of 8 x 8 pixels transposed for orientations 1 and 3
+    ///
+    bool exportImage(uint8_t * image);
+
+    ///
+    /// @brief Copy a monochrome image into the frame-buffer
+    /// @param image row-major image, same format as exportImage()
+    /// @note Full screen, regardless of the viewport and the clip rectangle
+    ///
+    void importImage(const uint8_t * image);
+
+    ///
+    /// @brief Rotate the content of the frame-buffer by 90 degrees clockwise
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note Square screens only, eg. 1.52" and 1.54"
+    ///
+    bool rotate90();
+
+    ///
+    /// @brief Rotate the content of the frame-buffer by 180 degrees
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    ///
+    bool rotate180();
+
+    ///
+    /// @brief Mirror the content of the frame-buffer
+    /// @param flagHorizontal true = left-right, false = top-bottom, for the current orientation
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    ///
+    bool mirror(bool flagHorizontal = true);
+
+    ///
+    /// @brief Best format for drawBitmap()
+    /// @return BITMAP_ROW_MSB for orientations 0 and 2, BITMAP_COLUMN_MSB for orientations 1 and 3
+    /// @note Bitmaps with this format are written by bytes along the lines of the frame-buffer
+    ///
+    uint8_t bitmapFormat();
+
   protected:
     /// @cond
 
@@ -213,6 +431,88 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     void s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour);
 
+    ///
+    /// @brief Fill a rectangle
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Bytes of the frame-buffer written at once, grey included
+    ///
+    void s_fillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Fill a rectangle with a pattern
+    /// @note Same parameters as hV_Screen_Buffer::s_fillPattern()
+    /// @note Bytes of the frame-buffer written at once, except for grey
+    ///
+    void s_fillPattern(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                       uint64_t pattern, uint16_t frontColour, uint16_t backColour,
+                       bool flagTransparent);
+
+    ///
+    /// @brief Invert the pixels of a rectangle
+    /// @note Same parameters as hV_Screen_Buffer::s_invertRectangle()
+    ///
+    void s_invertRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint64_t pattern);
+
+    ///
+    /// @brief Convert a pattern into masks for the lines of the frame-buffer
+    /// @param pattern 8 x 8 pattern, logical coordinates
+    /// @param[out] masks 8 bytes, mask for physical line modulo 8, first pixel as MSB
+    /// @note Rows or columns, reversed or not, according to the orientation
+    ///
+    void s_patternMasks(uint64_t pattern, uint8_t * masks);
+
+    ///
+    /// @brief Write masks into a rectangle of the frame-buffer
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param masks 8 bytes, mask for physical line modulo 8
+    /// @param actionFront action for the bits set: 0 = none, 1 = clear, 2 = set, 3 = invert
+    /// @param actionBack action for the bits cleared: 0 = none, 1 = clear, 2 = set
+    /// @note Logical coordinates, single frame-buffer only
+    ///
+    void s_fillMasks(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                     const uint8_t * masks, uint8_t actionFront, uint8_t actionBack);
+
+    ///
+    /// @brief Draw a monochrome bitmap
+    /// @note Same parameters as drawBitmap(), with stride provided
+    /// @note Bytes of the frame-buffer written at once when the rows or columns of the bitmap
+    /// follow the lines of the frame-buffer for the orientation, with s_drawBitmapTransposed() otherwise
+    ///
+    void s_drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                      const uint8_t * bitmap, uint16_t stride, uint16_t offset,
+                      uint16_t frontColour, uint16_t backColour,
+                      bool flagTransparent, uint8_t format);
+
+    ///
+    /// @brief Draw a monochrome bitmap across the lines of the frame-buffer
+    /// @note Same parameters as drawBitmap(), with stride provided
+    /// @note Blocks of 8 x 8 pixels transposed, for the rows of the bitmap across the lines of the frame-buffer
+    ///
+    void s_drawBitmapTransposed(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                const uint8_t * bitmap, uint16_t stride, uint16_t offset,
+                                uint16_t frontColour, uint16_t backColour,
+                                bool flagTransparent, uint8_t format);
+
+    ///
+    /// @brief Reverse the order of the pixels of a line of the frame-buffer
+    /// @param line first byte of the line, u_bufferSizeH bytes
+    ///
+    void s_reverseLine(uint8_t * line);
+
+    ///
+    /// @brief Swap two lines of the frame-buffer
+    /// @param line1 first line
+    /// @param line2 second line
+    ///
+    void s_swapLines(uint16_t line1, uint16_t line2);
+
     /// @brief Get point
     /// @param x1 x coordinate
     /// @param y1 y coordinate
@@ -237,6 +537,17 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     void s_flush(uint8_t updateMode = UPDATE_FAST);
 
+    ///
+    /// @brief Start the update of the screen, up to the refresh command
+    /// @param updateMode update mode, default = UPDATE_FAST
+    ///
+    void s_flushStart(uint8_t updateMode = UPDATE_FAST);
+
+    ///
+    /// @brief Complete the update of the screen, from the end of the refresh
+    ///
+    void s_flushEnd();
+
     // Position
     ///
     /// @brief Convert
@@ -257,7 +568,36 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     //
     // === Energy section
     //
+    energyModel_s s_energyModel; // Current model
+    energyCounters_s s_energyCounters; // Since boot, updates and powered idle
+    uint64_t s_energyCharge_pC; // Since boot, pC
+    uint64_t s_energyWork_nJ; // Since boot, nJ
+    uint32_t s_energyCommand; // Start of the commands, us
+    uint32_t s_energyRefresh; // Start of the refresh, us
+    uint64_t s_energyPending; // Charge of the powered idle not yet reported by an update, pC
+    uint32_t s_energyIdleChrono; // Start of the powered idle, ms
+    bool s_flagEnergyIdle = false; // Powered idle running
+
+    ///
+    /// @brief Add a charge to the counters since boot
+    /// @param charge charge, pC
+    ///
+    void s_energyAdd(uint64_t charge);
+
+    ///
+    /// @brief Start the powered idle, if the panel is still powered
+    ///
+    void s_energyStartIdle();
 
+    ///
+    /// @brief Stop the powered idle and count its charge
+    ///
+    void s_energyStopIdle();
+
+    ///
+    /// @brief Count the charge of the update and fill the statistics
+    ///
+    void s_energyUpdate();
     //
     // === End of Energy section
     //
@@ -272,6 +612,36 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     void COG_MediumP_update(uint8_t updateMode);
     void COG_MediumP_powerOff();
 
+    ///
+    /// @brief Select the temperature compensation tables of the screen
+    /// @note Called once by begin()
+    ///
+    void COG_MediumP_temperature();
+
+    ///
+    /// @brief Fill a temperature compensation table
+    /// @param[out] table TEMPERATURE_TABLE_SIZE values, from TEMPERATURE_TABLE_LOW
+    /// @param points points, by increasing temperature
+    /// @param number number of points
+    ///
+    void s_fillTemperatureTable(uint8_t * table, const temperaturePoint_s * points, uint8_t number);
+
+    ///
+    /// @brief Compile the DC/DC soft-start stages from the OTP memory
+    /// @note Called once by begin(), after the OTP memory is read
+    ///
+    void COG_MediumP_compileSoftStart();
+
+    ///
+    /// @brief Perform the DC/DC soft-start steps due, then start the refresh
+    /// @param flagWait true = wait for the delays until completion,
+    /// false = return at the first delay of 1 ms or more between two steps not elapsed, the other delays are blocking
+    /// @return true if the soft-start is still running, false otherwise
+    ///
+    bool COG_MediumP_stepSoftStart(bool flagWait);
+
+    void COG_LargeP_sendImageData(uint8_t updateMode);
+
     void COG_SmallP_reset();
     void COG_SmallP_getDataOTP();
     void COG_SmallP_initial(uint8_t updateMode);
@@ -280,6 +650,20 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     void COG_SmallP_powerOff();
 
     bool s_flag50; // Register 0x50
+    uint8_t s_temperatureTable[2][TEMPERATURE_TABLE_SIZE]; // Register 0x45, fast then global
+
+    // DC/DC soft-start
+    softStartStage_s s_softStartStages[4]; // Compiled from OTP
+    uint8_t s_softStartMode = SOFT_START_BLOCKING;
+    bool s_flagSoftStart = false; // Running
+    uint8_t s_softStartStage; // Current stage
+    uint8_t s_softStartStep; // Current step of the stage
+    bool s_flagSoftStartSecond; // Second value of the step next
+    uint8_t s_softStartPhase[2]; // Current PHL and PHH
+    uint32_t s_softStartChrono; // Last write, us
+    uint32_t s_softStartWait; // Delay after the last write, us
+    uint32_t s_softStartStart; // Start, us
+    flushStatistics_s s_statistics; // Last update
 
     //
     // === Touch section
@@ -292,5 +676,90 @@ class Screen_EPD_EXT3_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     /// @endcond
 };
 
+///
+/// @brief Maximum number of screens in a group
+///
+#define SCREEN_GROUP_MAX 4
+
+///
+/// @brief Class for a group of screens sharing the same SPI bus
+/// @details The screens are updated together
+/// * the uploads of the frame-buffers are serialised on the SPI bus,
+/// * the refreshes of the panels overlap.
+///
+/// @note Each screen requires its own panelCS and panelBusy pins,
+/// while the SPI signals are shared.
+///
+/// @code {.cpp}
+/// Screen_EPD_EXT3_Fast myScreenA(eScreen_EPD_271_PS_09, boardA);
+/// Screen_EPD_EXT3_Fast myScreenB(eScreen_EPD_271_PS_09, boardB);
+/// Screen_EPD_EXT3_Group myGroup;
+///
+/// myGroup.add(&myScreenA);
+/// myGroup.add(&myScreenB);
+/// myGroup.begin();
+/// ...
+/// myGroup.flush();
+/// @endcode
+///
+class Screen_EPD_EXT3_Group
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    Screen_EPD_EXT3_Group();
+
+    ///
+    /// @brief Add a screen to the group
+    /// @param screen screen
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note Up to SCREEN_GROUP_MAX screens
+    ///
+    bool add(Screen_EPD_EXT3_Fast * screen);
+
+    ///
+    /// @brief Get the number of screens
+    /// @return number of screens
+    ///
+    uint8_t getNumber();
+
+    ///
+    /// @brief Initialisation of all the screens
+    ///
+    void begin();
+
+    ///
+    /// @brief Update all the screens
+    ///
+    void flush();
+
+    ///
+    /// @brief Update all the screens
+    /// @param updateMode expected update mode, default = UPDATE_FAST
+    /// @return number of screens updated
+    /// @note Mode checked with checkTemperatureMode() for each screen
+    /// @note Unlike flushMode() of a screen, returns a number of screens, not an update mode
+    ///
+    uint8_t flushCount(uint8_t updateMode = UPDATE_FAST);
+
+    ///
+    /// @brief Set the period for polling the busy pins
+    /// @param period period, ms, default = 32 ms
+    /// @note flush() and flushCount() block until all the refreshes are done,
+    /// with a delay of period between two polls
+    ///
+    void setPeriodPoll(uint16_t period = 32);
+
+  protected:
+    /// @cond
+
+    Screen_EPD_EXT3_Fast * g_screen[SCREEN_GROUP_MAX];
+    uint8_t g_number;
+    uint16_t g_periodPoll; // ms
+
+    /// @endcond
+};
+
 #endif // SCREEN_EPD_EXT3_RELEASE
 
@@ -0,0 +1,483 @@
+///
+/// @file Terminal12x16c.h
+/// @brief Font Terminal 12 x 16, compressed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Generated by extras/Fonts/Terminal_Compress.py from Terminal12x16e.h, do not edit
+///
+
+#ifndef TERMINAL12C_FONT_RELEASE
+///
+/// @brief Library release number
+///
+#define TERMINAL12C_FONT_RELEASE 821
+
+///
+/// @brief Dictionary of columns
+///
+static const uint8_t Terminal12x16c_dictionary[247][2] =
+{
+    { 0xFF, 0x3F },
+    { 0x00, 0x30 },
+    { 0x03, 0x30 },
+    { 0x00, 0x38 },
+    { 0xC0, 0x00 },
+    { 0x60, 0x33 },
+    { 0x80, 0x01 },
+    { 0xC3, 0x30 },
+    { 0x80, 0x0F },
+    { 0x60, 0x30 },
+    { 0xE0, 0x3F },
+    { 0xC0, 0x1F },
+    { 0x60, 0x00 },
+    { 0x0C, 0x00 },
+    { 0xC0, 0x3F },
+    { 0xE0, 0x38 },
+    { 0xF0, 0x03 },
+    { 0x00, 0x3E },
+    { 0x03, 0x00 },
+    { 0x18, 0x30 },
+    { 0x07, 0x38 },
+    { 0xE0, 0x0F },
+    { 0x0E, 0x1C },
+    { 0x00, 0x1C },
+    { 0x6C, 0x33 },
+    { 0x1B, 0x30 },
+    { 0xF8, 0x3F },
+    { 0xFE, 0x3F },
+    { 0xC0, 0x01 },
+    { 0xFC, 0x0F },
+    { 0x00, 0xC0 },
+    { 0x00, 0x00 },
+    { 0x06, 0x30 },
+    { 0x18, 0x00 },
+    { 0x60, 0x06 },
+    { 0x66, 0x33 },
+    { 0x68, 0x33 },
+    { 0xF8, 0x07 },
+    { 0x0C, 0x30 },
+    { 0x80, 0x00 },
+    { 0xE0, 0x01 },
+    { 0xF0, 0x1F },
+    { 0x7E, 0x00 },
+    { 0xE0, 0x00 },
+    { 0xF8, 0x1F },
+    { 0x00, 0x07 },
+    { 0x3E, 0x00 },
+    { 0x40, 0x3E },
+    { 0x60, 0x18 },
+    { 0x80, 0x07 },
+    { 0x9B, 0x31 },
+    { 0xC0, 0x18 },
+    { 0xC3, 0x00 },
+    { 0xE0, 0x1F },
+    { 0xFE, 0x1F },
+    { 0x02, 0x00 },
+    { 0x0C, 0x0C },
+    { 0x0E, 0x00 },
+    { 0x30, 0x00 },
+    { 0x30, 0x06 },
+    { 0x3C, 0x00 },
+    { 0x66, 0x30 },
+    { 0x6C, 0x30 },
+    { 0x7C, 0x00 },
+    { 0x80, 0x03 },
+    { 0x83, 0x01 },
+    { 0xE0, 0x03 },
+    { 0xF8, 0x0F },
+    { 0x00, 0x0E },
+    { 0x00, 0x0F },
+    { 0x00, 0x1E },
+    { 0x03, 0x60 },
+    { 0x04, 0x00 },
+    { 0x10, 0x00 },
+    { 0x1C, 0x00 },
+    { 0x1C, 0x30 },
+    { 0x1E, 0x00 },
+    { 0x1E, 0x30 },
+    { 0x20, 0x02 },
+    { 0x38, 0x00 },
+    { 0x38, 0x38 },
+    { 0x3F, 0x00 },
+    { 0x60, 0x03 },
+    { 0x63, 0x30 },
+    { 0x70, 0x00 },
+    { 0x98, 0x31 },
+    { 0xC0, 0x0F },
+    { 0xC0, 0x13 },
+    { 0xDB, 0x06 },
+    { 0xE0, 0x07 },
+    { 0xF0, 0x07 },
+    { 0xFC, 0x3F },
+    { 0x00, 0x03 },
+    { 0x00, 0x18 },
+    { 0x00, 0x7E },
+    { 0x08, 0x00 },
+    { 0x08, 0x30 },
+    { 0x1C, 0x0E },
+    { 0x1C, 0x1C },
+    { 0x83, 0x0F },
+    { 0x9E, 0x31 },
+    { 0xE0, 0xFF },
+    { 0x00, 0x1F },
+    { 0x01, 0x20 },
+    { 0x07, 0x00 },
+    { 0x18, 0x06 },
+    { 0x1F, 0x00 },
+    { 0x22, 0x11 },
+    { 0x33, 0x00 },
+    { 0x38, 0x0E },
+    { 0x4E, 0x00 },
+    { 0x60, 0x0C },
+    { 0x60, 0xCC },
+    { 0x62, 0x33 },
+    { 0x68, 0x30 },
+    { 0x72, 0x00 },
+    { 0x73, 0x0C },
+    { 0x80, 0x3F },
+    { 0x9C, 0x31 },
+    { 0xE6, 0x3F },
+    { 0xE7, 0x30 },
+    { 0xEC, 0x1B },
+    { 0xEC, 0x3F },
+    { 0x00, 0x06 },
+    { 0x00, 0x0C },
+    { 0x00, 0x3F },
+    { 0x00, 0x4E },
+    { 0x02, 0x30 },
+    { 0x0F, 0x00 },
+    { 0x11, 0x00 },
+    { 0x15, 0x00 },
+    { 0x18, 0x38 },
+    { 0x19, 0x30 },
+    { 0x1B, 0x36 },
+    { 0x1F, 0x06 },
+    { 0x38, 0x07 },
+    { 0x3B, 0x38 },
+    { 0x60, 0x38 },
+    { 0x62, 0x30 },
+    { 0x63, 0x00 },
+    { 0x64, 0x33 },
+    { 0x70, 0x1C },
+    { 0x7C, 0x06 },
+    { 0x80, 0x08 },
+    { 0xBC, 0x1F },
+    { 0xC0, 0x03 },
+    { 0xE0, 0x1C },
+    { 0xE0, 0x30 },
+    { 0xE0, 0x3B },
+    { 0xE2, 0x0D },
+    { 0xE3, 0x0D },
+    { 0xE8, 0x38 },
+    { 0xF0, 0x00 },
+    { 0xF8, 0x01 },
+    { 0xFB, 0x37 },
+    { 0xFC, 0x06 },
+    { 0xFC, 0x1F },
+    { 0xFE, 0x39 },
+    { 0xFF, 0x07 },
+    { 0xFF, 0x1F },
+    { 0x00, 0x20 },
+    { 0x01, 0x38 },
+    { 0x03, 0x33 },
+    { 0x03, 0x38 },
+    { 0x03, 0x3C },
+    { 0x03, 0x3E },
+    { 0x03, 0xF0 },
+    { 0x04, 0x30 },
+    { 0x04, 0x38 },
+    { 0x07, 0x3C },
+    { 0x07, 0x70 },
+    { 0x0F, 0x0A },
+    { 0x0F, 0x3C },
+    { 0x10, 0x1F },
+    { 0x10, 0x21 },
+    { 0x20, 0x30 },
+    { 0x30, 0x03 },
+    { 0x30, 0x04 },
+    { 0x30, 0x0C },
+    { 0x33, 0x30 },
+    { 0x38, 0x1C },
+    { 0x39, 0x38 },
+    { 0x3C, 0x0A },
+    { 0x3C, 0x38 },
+    { 0x3F, 0x3F },
+    { 0x40, 0x00 },
+    { 0x40, 0x03 },
+    { 0x40, 0x10 },
+    { 0x40, 0x1E },
+    { 0x48, 0x00 },
+    { 0x60, 0x07 },
+    { 0x60, 0x3C },
+    { 0x60, 0x3F },
+    { 0x60, 0xF0 },
+    { 0x64, 0x30 },
+    { 0x6C, 0x00 },
+    { 0x6E, 0x30 },
+    { 0x6E, 0x33 },
+    { 0x75, 0x0C },
+    { 0x76, 0x0C },
+    { 0x78, 0x00 },
+    { 0x78, 0x0C },
+    { 0x7C, 0x04 },
+    { 0x7C, 0x30 },
+    { 0x7E, 0x02 },
+    { 0x7E, 0x3F },
+    { 0x80, 0x0D },
+    { 0x80, 0xE7 },
+    { 0x83, 0x03 },
+    { 0x84, 0x0F },
+    { 0x8C, 0x07 },
+    { 0x8F, 0x31 },
+    { 0x90, 0x1F },
+    { 0x98, 0x0C },
+    { 0x99, 0x31 },
+    { 0xB0, 0x0D },
+    { 0xB8, 0x0E },
+    { 0xBF, 0x3F },
+    { 0xC0, 0x06 },
+    { 0xC0, 0x07 },
+    { 0xC0, 0x0C },
+    { 0xC0, 0x11 },
+    { 0xC0, 0x1D },
+    { 0xC0, 0x30 },
+    { 0xC3, 0x31 },
+    { 0xC4, 0x3F },
+    { 0xC6, 0x3F },
+    { 0xCC, 0x0C },
+    { 0xCC, 0xFF },
+    { 0xE0, 0x31 },
+    { 0xE0, 0x33 },
+    { 0xE0, 0x81 },
+    { 0xE1, 0x0D },
+    { 0xE3, 0x00 },
+    { 0xE3, 0x30 },
+    { 0xE4, 0x0D },
+    { 0xE6, 0x0D },
+    { 0xE6, 0x38 },
+    { 0xF0, 0x0A },
+    { 0xF0, 0x0F },
+    { 0xF0, 0x1B },
+    { 0xF0, 0xFF },
+    { 0xF6, 0x1B },
+    { 0xFB, 0x3F },
+    { 0xFE, 0x00 },
+    { 0xFE, 0x03 },
+    { 0xFF, 0x33 }
+};
+
+///
+/// @brief Offsets of the glyphs in the stream
+///
+static const uint16_t Terminal12x16c_offsets[225] =
+{
+    0, 0, 5, 12, 30, 47, 61, 85, 91, 98, 105, 114, 123, 133, 142, 146,
+    158, 176, 187, 209, 227, 249, 271, 295, 313, 325, 347, 351, 361, 370, 380, 389,
+    406, 424, 435, 446, 457, 468, 479, 490, 503, 514, 521, 532, 543, 554, 565, 576,
+    587, 600, 617, 634, 657, 666, 677, 688, 699, 710, 721, 736, 743, 755, 762, 774,
+    786, 790, 801, 812, 823, 834, 845, 856, 875, 885, 892, 909, 918, 925, 936, 946,
+    957, 968, 979, 989, 998, 1007, 1018, 1029, 1040, 1050, 1059, 1071, 1080, 1083, 1092, 1103,
+    1114, 1139, 1139, 1143, 1165, 1173, 1185, 1194, 1203, 1210, 1224, 1251, 1256, 1267, 1267, 1288,
+    1288, 1288, 1292, 1296, 1304, 1312, 1318, 1325, 1336, 1344, 1355, 1364, 1369, 1381, 1381, 1395,
+    1406, 1406, 1411, 1422, 1444, 1455, 1466, 1469, 1486, 1493, 1513, 1528, 1538, 1547, 1554, 1570,
+    1581, 1588, 1595, 1609, 1617, 1622, 1632, 1647, 1652, 1657, 1661, 1666, 1676, 1687, 1706, 1723,
+    1742, 1753, 1764, 1775, 1794, 1805, 1816, 1827, 1840, 1851, 1862, 1873, 1884, 1891, 1898, 1905,
+    1912, 1923, 1942, 1953, 1964, 1975, 1992, 2003, 2012, 2035, 2046, 2057, 2068, 2079, 2092, 2103,
+    2120, 2131, 2142, 2153, 2166, 2177, 2190, 2203, 2216, 2227, 2238, 2251, 2264, 2271, 2278, 2285,
+    2292, 2309, 2327, 2338, 2349, 2360, 2375, 2386, 2395, 2415, 2426, 2437, 2452, 2467, 2482, 2491,
+    2506
+};
+
+///
+/// @brief Stream of compressed glyphs
+///
+static const uint8_t Terminal12x16c[2506] =
+{
+    0x43, 0x3F, 0xF6, 0xF6, 0x3F, 0x35, 0x3C, 0x3C, 0x1F, 0x1F, 0x3C, 0x3C, 0x1A, 0xFF, 0x00, 0x02,
+    0xFF, 0x10, 0x1E, 0xD4, 0x10, 0xCC, 0xFF, 0x1E, 0x1E, 0xD4, 0x10, 0xCC, 0x4C, 0x49, 0x27, 0xFF,
+    0x78, 0x04, 0xFF, 0xFC, 0x0C, 0xE3, 0x00, 0x00, 0xE3, 0xFF, 0xCC, 0x0F, 0xFF, 0x88, 0x07, 0x1A,
+    0x01, 0x50, 0xB4, 0x6D, 0x2D, 0x40, 0x1C, 0x0F, 0xFF, 0x70, 0x38, 0x50, 0x21, 0x28, 0x66, 0xFF,
+    0xB8, 0x3F, 0xFF, 0xFC, 0x31, 0xFF, 0xC6, 0x21, 0xFF, 0xE2, 0x37, 0xFF, 0x3E, 0x1E, 0x62, 0xFF,
+    0x00, 0x36, 0xFF, 0x00, 0x22, 0x42, 0xFF, 0x27, 0x00, 0x51, 0x6A, 0x35, 0x10, 0x1D, 0x36, 0x14,
+    0x67, 0x67, 0x35, 0x67, 0x67, 0x14, 0x36, 0x1D, 0x10, 0x27, 0xD5, 0xD8, 0x42, 0x43, 0x43, 0x42,
+    0xD8, 0xD5, 0x27, 0x06, 0x06, 0x06, 0xEF, 0xEF, 0x06, 0x06, 0x06, 0x42, 0xFF, 0x00, 0xB8, 0xFF,
+    0x00, 0xF8, 0xFF, 0x00, 0x78, 0x27, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x42, 0x03,
+    0x03, 0x03, 0x1A, 0x5D, 0x17, 0x44, 0x2D, 0x40, 0x1C, 0x2B, 0x54, 0x4F, 0x4A, 0x39, 0x1A, 0x25,
+    0x36, 0xFF, 0x06, 0x1E, 0xA2, 0xFF, 0x83, 0x31, 0x07, 0x53, 0xB3, 0xFF, 0x1E, 0x18, 0x36, 0x25,
+    0x37, 0x26, 0x26, 0xFF, 0x0E, 0x30, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1A, 0x4B, 0xFF, 0x1E, 0x38,
+    0xA9, 0xA5, 0xFF, 0x03, 0x37, 0xFF, 0x83, 0x33, 0xE0, 0xEA, 0xFF, 0x77, 0x30, 0xFF, 0x3E, 0x30,
+    0x4B, 0x1A, 0x38, 0x16, 0x14, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xE7, 0x39, 0xFF, 0x7E, 0x1F,
+    0xFF, 0x3C, 0x0E, 0x1A, 0x91, 0x42, 0xFF, 0x70, 0x03, 0xFF, 0x38, 0x03, 0xFF, 0x1C, 0x03, 0xFF,
+    0x0E, 0x03, 0xFF, 0x07, 0x03, 0x00, 0x00, 0x5C, 0x5C, 0x1A, 0xFF, 0x3F, 0x0C, 0xFF, 0x7F, 0x1C,
+    0xFF, 0x63, 0x38, 0x53, 0x53, 0x53, 0x53, 0x53, 0xFF, 0xE3, 0x38, 0xFF, 0xC3, 0x1F, 0x63, 0x1A,
+    0x56, 0x29, 0xFF, 0xF8, 0x39, 0xFF, 0xDC, 0x30, 0xFF, 0xCE, 0x30, 0xFF, 0xC7, 0x30, 0x07, 0x07,
+    0xFF, 0xC3, 0x39, 0xFF, 0x80, 0x1F, 0x45, 0x1A, 0x12, 0x12, 0x12, 0x02, 0xA4, 0xFF, 0x03, 0x0F,
+    0xFF, 0xC3, 0x03, 0xFF, 0xF3, 0x00, 0x51, 0x80, 0x12, 0x1A, 0x45, 0x90, 0x9D, 0x78, 0x07, 0x07,
+    0x07, 0x78, 0x9D, 0x90, 0x45, 0x1A, 0x3C, 0x2A, 0x78, 0x07, 0x07, 0xFF, 0xC3, 0x38, 0xFF, 0xC3,
+    0x1C, 0xFF, 0xC3, 0x0E, 0xFF, 0xE7, 0x07, 0xF5, 0xFF, 0xFC, 0x00, 0x42, 0x8D, 0x8D, 0x8D, 0x42,
+    0xFF, 0x70, 0x9C, 0xFF, 0x70, 0xFC, 0xFF, 0x70, 0x7C, 0x27, 0x04, 0x28, 0x10, 0x87, 0x61, 0x16,
+    0x14, 0x02, 0x28, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x02, 0x14, 0x16,
+    0x61, 0x87, 0x10, 0x28, 0x04, 0x19, 0x4A, 0x4C, 0x68, 0x12, 0xFF, 0x83, 0x37, 0xFF, 0xC3, 0x37,
+    0xE9, 0xFF, 0x77, 0x00, 0x2E, 0x4A, 0x1A, 0x43, 0x36, 0xFF, 0x07, 0x18, 0xFF, 0xF3, 0x33, 0x9A,
+    0x85, 0x9A, 0x9A, 0xFF, 0x07, 0x36, 0xF5, 0x99, 0x19, 0x03, 0x7D, 0x59, 0x9B, 0x86, 0x86, 0x9B,
+    0x59, 0x7D, 0x03, 0x19, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x78, 0x9D, 0x90, 0x45, 0x19, 0x10,
+    0x1D, 0x16, 0x14, 0x02, 0x02, 0x02, 0x14, 0x16, 0x38, 0x19, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+    0x14, 0x16, 0x1D, 0x10, 0x19, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x02, 0x02, 0x19,
+    0x00, 0x00, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x12, 0x12, 0x19, 0x10, 0x1D, 0x16, 0x14, 0x02,
+    0x07, 0x07, 0x07, 0xFF, 0xC7, 0x3F, 0xE2, 0x19, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x35, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x19, 0x44, 0x46, 0x03, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x9F, 0x9E, 0x19, 0x00, 0x00, 0x04, 0x28, 0x10, 0x87, 0x61, 0x16, 0x14, 0x02, 0x19,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x19, 0x00, 0x00, 0x4C, 0xC8, 0x28,
+    0x28, 0xC8, 0x4C, 0x00, 0x00, 0x19, 0x00, 0x00, 0x39, 0x4F, 0x98, 0x91, 0x2D, 0x17, 0x00, 0x00,
+    0x19, 0x10, 0x1D, 0x16, 0x14, 0x02, 0x02, 0x14, 0x16, 0x1D, 0x10, 0x19, 0x00, 0x00, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0xFF, 0xC7, 0x01, 0xF4, 0x3F, 0x19, 0x10, 0x1D, 0x16, 0x14, 0x02, 0xFF, 0x03,
+    0x36, 0xFF, 0x07, 0x3E, 0x16, 0x5B, 0xFF, 0xF0, 0x33, 0x19, 0x00, 0x00, 0x41, 0x41, 0xD0, 0xFF,
+    0x83, 0x07, 0x63, 0xFF, 0xC7, 0x1D, 0xFF, 0xFE, 0x38, 0xCB, 0x19, 0xFF, 0x3C, 0x0C, 0xFF, 0x7E,
+    0x1C, 0xFF, 0xE7, 0x38, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xC7, 0x39, 0xFF, 0x8E, 0x1F, 0xFF, 0x0C,
+    0x0F, 0x27, 0x12, 0x12, 0x12, 0x00, 0x00, 0x12, 0x12, 0x12, 0x19, 0x9E, 0x9F, 0x03, 0x01, 0x01,
+    0x01, 0x01, 0x03, 0x9F, 0x9E, 0x19, 0x68, 0x51, 0x99, 0x56, 0x11, 0x11, 0x56, 0x99, 0x51, 0x68,
+    0x19, 0x00, 0x00, 0x17, 0x7B, 0x40, 0x40, 0x7B, 0x17, 0x00, 0x00, 0x19, 0x02, 0xAC, 0x61, 0xB0,
+    0x28, 0x28, 0xB0, 0x61, 0xAC, 0x02, 0x19, 0x12, 0x80, 0x3C, 0x98, 0x0E, 0x0E, 0x98, 0x3C, 0x80,
+    0x12, 0x19, 0x02, 0xA4, 0xA5, 0xA2, 0xE0, 0xEA, 0xB3, 0xFF, 0x1F, 0x30, 0xFF, 0x0F, 0x30, 0x02,
+    0x35, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x1A, 0x39, 0x4A, 0x4F, 0x54, 0x2B, 0x1C, 0x40, 0x2D,
+    0x44, 0x17, 0x5D, 0x35, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x1A, 0x0C, 0x54, 0x4F, 0x4A, 0x39,
+    0x68, 0x39, 0x4A, 0x4F, 0x54, 0x0C, 0x1A, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x52, 0x2E, 0x2A, 0x6E, 0x19, 0x17, 0x2F, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0A,
+    0x0E, 0x19, 0x00, 0x00, 0xDF, 0x09, 0x09, 0x09, 0x09, 0x0F, 0x0B, 0x08, 0x19, 0x08, 0x0B, 0x0F,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x33, 0x8F, 0x19, 0x08, 0x0B, 0x0F, 0x09, 0x09, 0x09, 0x93, 0xDF,
+    0x00, 0x00, 0x19, 0x08, 0x0B, 0x94, 0x05, 0x05, 0x05, 0x05, 0x05, 0x57, 0x06, 0x17, 0x04, 0x04,
+    0x5B, 0x1B, 0xFF, 0xC7, 0x00, 0x34, 0x34, 0x12, 0x19, 0x40, 0xFF, 0xC0, 0xC7, 0xFF, 0xE0, 0xCE,
+    0x70, 0x70, 0x70, 0x70, 0xFF, 0x60, 0xE6, 0xFF, 0xE0, 0x7F, 0x0A, 0x18, 0x00, 0x00, 0x04, 0x0C,
+    0x0C, 0x0C, 0x2B, 0x0E, 0x75, 0x35, 0x01, 0x09, 0x7A, 0x7A, 0x01, 0x01, 0x35, 0xFF, 0x00, 0x60,
+    0xFF, 0x00, 0xE0, 0x1E, 0xFF, 0x60, 0xC0, 0xFF, 0xEC, 0xFF, 0xFF, 0xEC, 0x7F, 0x27, 0x00, 0x00,
+    0x5C, 0x31, 0x56, 0x92, 0x89, 0x01, 0x35, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x19, 0x0A, 0x0E,
+    0x2B, 0x2B, 0x0E, 0x0E, 0x2B, 0x2B, 0x0E, 0x75, 0x28, 0x0A, 0x0A, 0x0C, 0x0C, 0x0C, 0x0C, 0x2B,
+    0x0E, 0x75, 0x19, 0x08, 0x0B, 0x0F, 0x09, 0x09, 0x09, 0x09, 0x0F, 0x0B, 0x08, 0x19, 0x65, 0x65,
+    0x6F, 0x30, 0x30, 0x30, 0x30, 0x92, 0x56, 0x31, 0x19, 0x31, 0x56, 0x92, 0x30, 0x30, 0x30, 0x30,
+    0x6F, 0x65, 0x65, 0x28, 0x0A, 0x0A, 0x04, 0x0C, 0x0C, 0x0C, 0x0C, 0x2B, 0x04, 0x17, 0xDD, 0xE6,
+    0x05, 0x05, 0x05, 0x05, 0xC0, 0xBC, 0x17, 0x0C, 0x0C, 0x36, 0x1B, 0x09, 0x09, 0x09, 0x01, 0x19,
+    0x15, 0x35, 0x03, 0x01, 0x01, 0x01, 0x01, 0x5D, 0x0A, 0x0A, 0x19, 0x0C, 0x28, 0x31, 0x46, 0x03,
+    0x03, 0x46, 0x31, 0x28, 0x0C, 0x19, 0x59, 0x35, 0x03, 0x17, 0x15, 0x15, 0x17, 0x03, 0x35, 0x59,
+    0x18, 0x09, 0x0F, 0xDE, 0x08, 0x2D, 0x08, 0xDE, 0x0F, 0x09, 0x27, 0x0C, 0xE7, 0xCF, 0x5E, 0x46,
+    0x31, 0x28, 0x0C, 0x18, 0x09, 0x89, 0xBF, 0xFF, 0x60, 0x36, 0x05, 0xE5, 0x93, 0x09, 0xAF, 0x27,
+    0x27, 0x1C, 0x9C, 0xCD, 0xAA, 0x47, 0x47, 0x47, 0x51, 0xD9, 0xD9, 0x27, 0x47, 0x47, 0x47, 0xAA,
+    0xCD, 0x9C, 0x1C, 0x27, 0x19, 0x49, 0x21, 0x0D, 0x48, 0x0D, 0x21, 0x49, 0x21, 0x0D, 0x48, 0x19,
+    0x45, 0x08, 0xDC, 0x6F, 0xB2, 0xB2, 0x6F, 0xDC, 0x08, 0x45, 0x19, 0xFF, 0x20, 0x01, 0x10, 0x1D,
+    0xFF, 0x2E, 0x1D, 0xFF, 0x27, 0x39, 0xFF, 0x23, 0x31, 0xFF, 0x23, 0x30, 0xA9, 0xFF, 0x06, 0x1C,
+    0xFF, 0x00, 0x08, 0x52, 0x7E, 0x5E, 0x11, 0x18, 0xFF, 0x00, 0x10, 0xFF, 0x40, 0x30, 0xFF, 0x60,
+    0x3E, 0x35, 0xFF, 0xFC, 0x03, 0x2A, 0xFF, 0x66, 0x00, 0xFF, 0x26, 0x00, 0x48, 0x36, 0x7E, 0x5E,
+    0x11, 0x1F, 0x7E, 0x5E, 0x11, 0x1A, 0x03, 0x03, 0x03, 0x1F, 0x03, 0x03, 0x03, 0x1F, 0x03, 0x03,
+    0x03, 0x27, 0x3A, 0x3A, 0x3A, 0x1B, 0x1B, 0x3A, 0x3A, 0x3A, 0x27, 0x3B, 0x3B, 0x3B, 0x1B, 0x1B,
+    0x3B, 0x3B, 0x3B, 0x35, 0x49, 0x21, 0x0D, 0x0D, 0x21, 0x49, 0x1A, 0x01, 0x50, 0xB4, 0x6D, 0x2D,
+    0x40, 0xFF, 0xC0, 0x39, 0x0F, 0x54, 0x50, 0x83, 0x19, 0xFF, 0x70, 0x0C, 0xFF, 0xF8, 0x1C, 0xFF,
+    0xDC, 0x39, 0xFF, 0x8D, 0x31, 0xD3, 0xFF, 0x8E, 0x31, 0xD3, 0xFF, 0x9D, 0x3B, 0xFF, 0x38, 0x1F,
+    0xFF, 0x30, 0x0E, 0x33, 0x27, 0x1C, 0x52, 0x4E, 0x19, 0x10, 0x1D, 0x16, 0x14, 0x02, 0x00, 0x00,
+    0x07, 0x07, 0x02, 0x19, 0x13, 0x83, 0xFF, 0x19, 0x3C, 0x85, 0xFF, 0x1E, 0x33, 0x64, 0xFF, 0xDB,
+    0x30, 0xFF, 0x79, 0x30, 0xFF, 0x38, 0x30, 0x13, 0x52, 0x3F, 0x2A, 0x73, 0x52, 0x6E, 0x2A, 0x2E,
+    0x36, 0x3F, 0x2A, 0x73, 0x1F, 0x3F, 0x2A, 0x73, 0x36, 0x6E, 0x2A, 0x2E, 0x1F, 0x6E, 0x2A, 0x2E,
+    0x44, 0x1C, 0x42, 0x42, 0x42, 0x1C, 0x35, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x19, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x36, 0x27, 0x04, 0xB9, 0x04, 0x27, 0x04, 0xB9,
+    0x19, 0x37, 0x37, 0x2E, 0x37, 0x37, 0x2E, 0x48, 0x5F, 0x48, 0x2E, 0x17, 0xDD, 0xE6, 0x05, 0x8C,
+    0x24, 0x8C, 0xC0, 0xBC, 0x43, 0x4E, 0x52, 0x1C, 0x27, 0x1A, 0x08, 0x0B, 0x0F, 0x09, 0x0F, 0x0B,
+    0x05, 0x05, 0x05, 0x57, 0x06, 0x18, 0x09, 0x89, 0xBF, 0xFF, 0x64, 0x36, 0x24, 0xFF, 0xE4, 0x31,
+    0x93, 0x09, 0xAF, 0x19, 0x5F, 0x21, 0x6C, 0x8B, 0x0E, 0x0E, 0x8B, 0x6C, 0x21, 0x5F, 0x43, 0x11,
+    0xE4, 0xE4, 0x11, 0x27, 0x42, 0x5A, 0x6D, 0x1B, 0x1B, 0xFF, 0x18, 0x0C, 0x6D, 0x3B, 0x28, 0x8F,
+    0xFF, 0xC0, 0x1C, 0x2C, 0x1D, 0xFF, 0xCE, 0x0C, 0xFF, 0xC6, 0x0C, 0xFF, 0xC6, 0x1C, 0xFF, 0x4C,
+    0x18, 0xFF, 0x08, 0x08, 0x19, 0xF2, 0x36, 0x69, 0x38, 0x38, 0x38, 0x38, 0x69, 0x36, 0xF2, 0x19,
+    0x12, 0xAB, 0xB6, 0xEE, 0x0E, 0x0E, 0xEE, 0xB6, 0xAB, 0x12, 0x51, 0xB8, 0xB8, 0x27, 0xFF, 0xDC,
+    0x08, 0xFF, 0xFE, 0x19, 0x6B, 0x6B, 0x6B, 0x6B, 0xFF, 0xE6, 0x1F, 0xFF, 0xC4, 0x0E, 0x35, 0x0D,
+    0x0D, 0x1F, 0x1F, 0x0D, 0x0D, 0x1A, 0x5A, 0x43, 0x62, 0xFF, 0xCC, 0x19, 0x79, 0xFF, 0x2C, 0x1A,
+    0xFF, 0x6C, 0x1B, 0xFF, 0x4C, 0x19, 0x62, 0x43, 0x5A, 0x19, 0x54, 0xFF, 0xFA, 0x06, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0xFF, 0xFF, 0x06, 0xF4, 0x18, 0x27, 0x1C, 0x52, 0x4E, 0x1F, 0x27, 0x1C,
+    0x52, 0x4E, 0x27, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xDB, 0xDB, 0x35, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x1A, 0x5A, 0x43, 0x62, 0x79, 0x79, 0xFF, 0xAC, 0x18, 0x79, 0xFF, 0x4C, 0x1B, 0x62,
+    0x43, 0x5A, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x35, 0x4C, 0x51,
+    0x6C, 0x6C, 0x51, 0x4C, 0x35, 0x33, 0x33, 0xF0, 0xF0, 0x33, 0x33, 0x24, 0xFF, 0x19, 0x00, 0xFF,
+    0x1D, 0x00, 0x82, 0xFF, 0x17, 0x00, 0xFF, 0x12, 0x00, 0x24, 0x81, 0x82, 0x82, 0x6A, 0xFF, 0x0A,
+    0x00, 0x43, 0x49, 0x21, 0x0D, 0x48, 0x18, 0xF1, 0xF1, 0x7B, 0x7C, 0x7C, 0x7C, 0x44, 0x5A, 0x10,
+    0x19, 0x4F, 0x3F, 0xFF, 0xC6, 0x00, 0xFF, 0x82, 0x00, 0x1B, 0x1B, 0x37, 0x1B, 0x1B, 0x37, 0x43,
+    0x5C, 0x31, 0x31, 0x5C, 0x43, 0xA0, 0xA0, 0x01, 0x01, 0x22, 0x37, 0x6A, 0x6A, 0x23, 0x39, 0x81,
+    0x81, 0x39, 0x18, 0x4E, 0x52, 0x1C, 0x27, 0x1F, 0x4E, 0x52, 0x1C, 0x27, 0x19, 0xBD, 0xCA, 0x8E,
+    0xBA, 0x06, 0xDA, 0xBE, 0xB1, 0xAD, 0x66, 0x19, 0xBD, 0xCA, 0x8E, 0xBA, 0x06, 0x04, 0xFF, 0x60,
+    0x19, 0xFF, 0x30, 0x1D, 0xFF, 0x10, 0x17, 0xFF, 0x00, 0x12, 0x19, 0xFF, 0x44, 0x00, 0xFF, 0x54,
+    0x04, 0x8E, 0xFF, 0x28, 0x03, 0x06, 0xDA, 0xBE, 0xB1, 0xAD, 0x66, 0x19, 0x44, 0x66, 0xFF, 0x80,
+    0x3B, 0xFF, 0xC0, 0x31, 0xFF, 0xFB, 0x30, 0xFF, 0x7B, 0x30, 0x01, 0x03, 0x46, 0x44, 0x19, 0x03,
+    0x11, 0x08, 0xE8, 0x74, 0xC7, 0xEB, 0x08, 0x11, 0x03, 0x19, 0x03, 0x11, 0x08, 0xEB, 0xC7, 0x74,
+    0xE8, 0x08, 0x11, 0x03, 0x19, 0x03, 0x11, 0xD1, 0xEC, 0x74, 0x74, 0xEC, 0xD1, 0x11, 0x03, 0x19,
+    0x03, 0x11, 0xFF, 0x82, 0x0F, 0x96, 0xFF, 0x79, 0x0C, 0xFF, 0x7B, 0x0C, 0x95, 0x63, 0xFF, 0x01,
+    0x3E, 0x03, 0x19, 0x03, 0x11, 0x63, 0x96, 0xC9, 0xC9, 0x96, 0x63, 0x11, 0x03, 0x19, 0x03, 0x11,
+    0x08, 0x95, 0xC6, 0xC6, 0x95, 0x08, 0x11, 0x03, 0x19, 0x03, 0x7D, 0x59, 0x9B, 0x86, 0x00, 0x00,
+    0x07, 0x07, 0x02, 0x19, 0x10, 0x1D, 0x16, 0x14, 0xFF, 0x03, 0xB0, 0xA6, 0xA6, 0x14, 0x16, 0x38,
+    0x19, 0x1A, 0x1A, 0xD6, 0x32, 0x64, 0x76, 0x55, 0x55, 0x13, 0x13, 0x19, 0x1A, 0x1A, 0x55, 0x55,
+    0x76, 0x64, 0x32, 0xD6, 0x13, 0x13, 0x19, 0x1A, 0x1A, 0x76, 0x64, 0x32, 0x32, 0x64, 0x76, 0x13,
+    0x13, 0x19, 0x1A, 0x1A, 0x32, 0x32, 0x55, 0x55, 0x32, 0x32, 0x13, 0x13, 0x35, 0x84, 0x19, 0x1B,
+    0x5B, 0x13, 0x13, 0x35, 0x13, 0x13, 0x5B, 0x1B, 0x19, 0x84, 0x35, 0x4B, 0x4D, 0xF3, 0xF3, 0x4D,
+    0x4B, 0x35, 0x19, 0x19, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x04, 0x00, 0x00, 0x07, 0x02, 0x02, 0x14,
+    0x16, 0x1D, 0x10, 0x19, 0x1A, 0x1A, 0x73, 0xE9, 0xFF, 0xC1, 0x01, 0xD0, 0xFF, 0x02, 0x07, 0xFF,
+    0x03, 0x0E, 0xFF, 0xF9, 0x3F, 0x1A, 0x19, 0x15, 0x29, 0xB5, 0x19, 0x4D, 0x4B, 0x13, 0x50, 0x29,
+    0x15, 0x19, 0x15, 0x29, 0x50, 0x13, 0x4B, 0x4D, 0x19, 0xB5, 0x29, 0x15, 0x19, 0x15, 0x29, 0xB7,
+    0x4D, 0x19, 0x19, 0x4D, 0xB7, 0x29, 0x15, 0x19, 0x15, 0x29, 0xFF, 0x3A, 0x38, 0x19, 0x84, 0x19,
+    0xFF, 0x1A, 0x30, 0x88, 0xFF, 0xF1, 0x1F, 0x15, 0x19, 0x15, 0x29, 0x88, 0x19, 0x13, 0x13, 0x19,
+    0x88, 0x29, 0x15, 0x27, 0xBB, 0x33, 0xCE, 0x2D, 0x2D, 0xCE, 0x33, 0xBB, 0x19, 0xFF, 0xF0, 0x2F,
+    0x1A, 0xFF, 0x1C, 0x18, 0xFF, 0x0C, 0x3E, 0xFF, 0x8C, 0x37, 0xFF, 0xEC, 0x31, 0xCB, 0x83, 0x9C,
+    0xFF, 0xF4, 0x0F, 0x19, 0x25, 0x2C, 0xA1, 0x02, 0x20, 0xA7, 0x01, 0x03, 0x2C, 0x25, 0x19, 0x25,
+    0x2C, 0x03, 0x01, 0xA7, 0x20, 0x02, 0xA1, 0x2C, 0x25, 0x19, 0x25, 0x2C, 0xA8, 0x20, 0x02, 0x02,
+    0x20, 0xA8, 0x2C, 0x25, 0x19, 0x25, 0x2C, 0xA3, 0x02, 0x01, 0x01, 0x02, 0xA3, 0x2C, 0x25, 0x19,
+    0x5F, 0x21, 0x3A, 0x0C, 0xE1, 0xE2, 0x8B, 0xFF, 0x31, 0x00, 0x21, 0x5F, 0x27, 0x26, 0x5B, 0x5B,
+    0xFF, 0x6C, 0x36, 0x22, 0x22, 0x59, 0x91, 0x27, 0xFF, 0xC0, 0xFF, 0x65, 0xFF, 0x30, 0x21, 0xAE,
+    0xAE, 0xFF, 0x30, 0x33, 0x0A, 0xFF, 0xC0, 0x1E, 0x19, 0x17, 0x2F, 0x05, 0x71, 0x23, 0x18, 0x24,
+    0x05, 0x0A, 0x0E, 0x19, 0x17, 0x2F, 0x05, 0x24, 0x18, 0x23, 0x71, 0x05, 0x0A, 0x0E, 0x19, 0x17,
+    0x2F, 0x24, 0x18, 0x23, 0x23, 0x18, 0x24, 0x0A, 0x0E, 0x19, 0x17, 0x2F, 0x24, 0x18, 0x8C, 0x18,
+    0x24, 0x18, 0xFF, 0xE4, 0x3F, 0x0E, 0x19, 0x17, 0x2F, 0x18, 0x18, 0x05, 0x05, 0x18, 0x18, 0x0A,
+    0x0E, 0x19, 0x17, 0x2F, 0x05, 0x05, 0xC5, 0xFF, 0x6A, 0x33, 0xC5, 0x05, 0x0A, 0x0E, 0x19, 0x17,
+    0x2F, 0x05, 0x05, 0x0A, 0x0B, 0x05, 0x05, 0xE5, 0xFF, 0xC0, 0x10, 0x19, 0x08, 0x0B, 0x0F, 0x09,
+    0xFF, 0x60, 0xB0, 0xC1, 0xC1, 0x09, 0x33, 0x8F, 0x19, 0x08, 0x0B, 0x94, 0x71, 0x23, 0x18, 0x24,
+    0x05, 0x57, 0x06, 0x19, 0x08, 0x0B, 0x94, 0x24, 0x18, 0x23, 0x71, 0x05, 0x57, 0x06, 0x19, 0x08,
+    0x0B, 0xFF, 0xE8, 0x3B, 0x18, 0x23, 0x23, 0x18, 0x24, 0x57, 0x06, 0x19, 0x08, 0x0B, 0xFF, 0xE6,
+    0x3B, 0x23, 0x05, 0x05, 0x23, 0x23, 0x57, 0x06, 0x35, 0x01, 0x8A, 0x77, 0x7A, 0x60, 0x01, 0x35,
+    0x01, 0x72, 0x7A, 0x77, 0x7F, 0x01, 0x35, 0x60, 0x3E, 0x77, 0x77, 0x26, 0x60, 0x35, 0x20, 0x3D,
+    0x0A, 0x0A, 0x20, 0x20, 0x19, 0x08, 0x0B, 0x0F, 0xFF, 0x6A, 0x30, 0xC4, 0xC2, 0xC4, 0xFF, 0xFA,
+    0x38, 0xFF, 0xD0, 0x1F, 0x08, 0x28, 0x0A, 0xFF, 0xE8, 0x3F, 0xC3, 0xFF, 0x64, 0x00, 0xC3, 0xFF,
+    0x68, 0x00, 0xFF, 0xEC, 0x00, 0xE1, 0x75, 0x19, 0x08, 0x0B, 0x0F, 0x8A, 0x3D, 0x3E, 0x72, 0x0F,
+    0x0B, 0x08, 0x19, 0x08, 0x0B, 0x0F, 0x72, 0x3E, 0x3D, 0x8A, 0x0F, 0x0B, 0x08, 0x19, 0x08, 0x0B,
+    0x97, 0x3E, 0x3D, 0x3D, 0x3E, 0x97, 0x0B, 0x08, 0x19, 0x08, 0x0B, 0x97, 0x3E, 0xC2, 0x3E, 0x72,
+    0xFF, 0xEC, 0x38, 0xFF, 0xC4, 0x1F, 0x08, 0x19, 0x08, 0x0B, 0xED, 0x3D, 0x09, 0x09, 0x3D, 0xED,
+    0x0B, 0x08, 0x27, 0x06, 0x06, 0x06, 0xD7, 0xD7, 0x06, 0x06, 0x06, 0x28, 0xFF, 0x80, 0x2F, 0x0B,
+    0x0F, 0xFF, 0x60, 0x34, 0xFF, 0x60, 0x32, 0xFF, 0x60, 0x31, 0x0F, 0x0B, 0xFF, 0xA0, 0x0F, 0x19,
+    0x15, 0x35, 0x03, 0x7F, 0x20, 0x26, 0x60, 0x5D, 0x0A, 0x0A, 0x19, 0x15, 0x35, 0x03, 0x60, 0x26,
+    0x20, 0x7F, 0x5D, 0x0A, 0x0A, 0x19, 0x15, 0x35, 0xFF, 0x08, 0x38, 0x26, 0x20, 0x20, 0x26, 0xFF,
+    0x08, 0x18, 0x0A, 0x0A, 0x19, 0x15, 0x35, 0xFF, 0x0C, 0x38, 0x26, 0x01, 0x01, 0x26, 0xFF, 0x0C,
+    0x18, 0x0A, 0x0A, 0x27, 0x0C, 0xE7, 0xCF, 0xFF, 0x10, 0x7E, 0xFF, 0x18, 0x1E, 0xD2, 0xFF, 0xE4,
+    0x01, 0x0C, 0x27, 0x02, 0x00, 0x00, 0x85, 0x69, 0x69, 0x25, 0x10, 0x27, 0x0C, 0xFF, 0xEC, 0x81,
+    0xFF, 0x8C, 0xE7, 0x5E, 0x46, 0xD2, 0xFF, 0xEC, 0x01, 0x0C
+};
+
+#endif // TERMINAL12C_FONT_RELEASE
@@ -0,0 +1,552 @@
+///
+/// @file Terminal16x24c.h
+/// @brief Font Terminal 16 x 24, compressed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Generated by extras/Fonts/Terminal_Compress.py from Terminal16x24e.h, do not edit
+///
+
+#ifndef TERMINAL16C_FONT_RELEASE
+///
+/// @brief Library release number
+///
+#define TERMINAL16C_FONT_RELEASE 821
+
+///
+/// @brief Dictionary of columns
+///
+static const uint8_t Terminal16x24c_dictionary[255][3] =
+{
+    { 0x30, 0x00, 0x06 },
+    { 0xF0, 0xFF, 0x07 },
+    { 0x30, 0x0C, 0x06 },
+    { 0x00, 0x00, 0x06 },
+    { 0x80, 0x01, 0x06 },
+    { 0x00, 0x18, 0x00 },
+    { 0x00, 0xFC, 0x00 },
+    { 0x00, 0x7F, 0x00 },
+    { 0x80, 0x31, 0x06 },
+    { 0xC0, 0xFF, 0x01 },
+    { 0x80, 0xFF, 0x07 },
+    { 0x00, 0x00, 0x07 },
+    { 0x80, 0x01, 0x00 },
+    { 0x00, 0x00, 0xC0 },
+    { 0x00, 0x30, 0x00 },
+    { 0x00, 0x0C, 0x00 },
+    { 0x00, 0xC0, 0x07 },
+    { 0x00, 0xFE, 0x03 },
+    { 0x30, 0x00, 0x00 },
+    { 0xF0, 0xFF, 0x03 },
+    { 0x0C, 0x00, 0xC0 },
+    { 0x33, 0x00, 0x06 },
+    { 0x70, 0x00, 0x00 },
+    { 0x00, 0xFE, 0x07 },
+    { 0x00, 0xFF, 0x07 },
+    { 0x0C, 0x00, 0x00 },
+    { 0x10, 0x00, 0x00 },
+    { 0xE0, 0x80, 0x03 },
+    { 0x00, 0x3C, 0x00 },
+    { 0x00, 0x66, 0x00 },
+    { 0x9C, 0x01, 0x06 },
+    { 0xFC, 0xFF, 0x07 },
+    { 0x00, 0x00, 0x00 },
+    { 0x1C, 0x00, 0x00 },
+    { 0xFC, 0x00, 0x00 },
+    { 0x00, 0x00, 0x03 },
+    { 0x00, 0x03, 0x00 },
+    { 0x00, 0x06, 0x06 },
+    { 0x30, 0x0C, 0x00 },
+    { 0x80, 0xFF, 0x01 },
+    { 0xC0, 0xC0, 0x00 },
+    { 0x00, 0x10, 0x00 },
+    { 0x00, 0x7C, 0x00 },
+    { 0x00, 0x80, 0x07 },
+    { 0x00, 0xC0, 0x03 },
+    { 0x00, 0xF8, 0x00 },
+    { 0x00, 0xF8, 0x01 },
+    { 0x00, 0xFF, 0x01 },
+    { 0x04, 0x00, 0x00 },
+    { 0x33, 0x0C, 0x06 },
+    { 0x34, 0x00, 0x06 },
+    { 0x60, 0x00, 0x03 },
+    { 0x9C, 0x31, 0x06 },
+    { 0x00, 0x00, 0x04 },
+    { 0x00, 0x07, 0x00 },
+    { 0x00, 0x1C, 0x00 },
+    { 0x00, 0x1E, 0x00 },
+    { 0x00, 0x38, 0x00 },
+    { 0x00, 0x87, 0x03 },
+    { 0x00, 0xF0, 0x00 },
+    { 0x00, 0xFE, 0x00 },
+    { 0x03, 0x00, 0x06 },
+    { 0x0C, 0x00, 0x06 },
+    { 0x36, 0x00, 0x06 },
+    { 0x80, 0xFF, 0xFF },
+    { 0x98, 0x31, 0x06 },
+    { 0x9C, 0xFF, 0x07 },
+    { 0xE0, 0x00, 0x00 },
+    { 0xF0, 0xFF, 0x00 },
+    { 0xF0, 0xFF, 0x01 },
+    { 0xFC, 0xFF, 0xFF },
+    { 0x00, 0x03, 0x03 },
+    { 0x00, 0x7E, 0x00 },
+    { 0x00, 0xE0, 0x07 },
+    { 0x00, 0xF8, 0x07 },
+    { 0x0C, 0x03, 0x00 },
+    { 0x1C, 0x00, 0x06 },
+    { 0x30, 0x18, 0x06 },
+    { 0x30, 0x30, 0x00 },
+    { 0x80, 0x03, 0x00 },
+    { 0x80, 0x03, 0x07 },
+    { 0x80, 0x07, 0x00 },
+    { 0x8C, 0x31, 0x06 },
+    { 0x90, 0x01, 0x06 },
+    { 0x90, 0x31, 0x06 },
+    { 0x00, 0x00, 0x60 },
+    { 0x00, 0x06, 0x00 },
+    { 0x00, 0x0F, 0x00 },
+    { 0x00, 0x60, 0x00 },
+    { 0x00, 0xC7, 0x01 },
+    { 0x00, 0xE0, 0x03 },
+    { 0x00, 0xE3, 0x03 },
+    { 0x00, 0xEE, 0x00 },
+    { 0x00, 0xF0, 0x01 },
+    { 0x00, 0xFE, 0x01 },
+    { 0x04, 0x00, 0x06 },
+    { 0x06, 0x00, 0x06 },
+    { 0x10, 0x00, 0x04 },
+    { 0x18, 0x0C, 0x00 },
+    { 0x1C, 0x00, 0xE0 },
+    { 0x1C, 0x87, 0x03 },
+    { 0x36, 0x0C, 0x06 },
+    { 0x60, 0x00, 0x07 },
+    { 0x80, 0x01, 0x03 },
+    { 0x80, 0x01, 0x07 },
+    { 0x80, 0x01, 0xC0 },
+    { 0x80, 0x03, 0xC0 },
+    { 0x80, 0x0F, 0x00 },
+    { 0x80, 0xFF, 0x03 },
+    { 0x8C, 0x01, 0x06 },
+    { 0xC0, 0x03, 0x00 },
+    { 0xCC, 0x0C, 0x00 },
+    { 0xF0, 0x00, 0x00 },
+    { 0xF3, 0xFF, 0x07 },
+    { 0xFC, 0x0F, 0x00 },
+    { 0x00, 0x00, 0x1F },
+    { 0x00, 0x03, 0x06 },
+    { 0x00, 0x07, 0x06 },
+    { 0x00, 0x0E, 0x03 },
+    { 0x00, 0x6C, 0x00 },
+    { 0x00, 0x80, 0x03 },
+    { 0x00, 0x83, 0x01 },
+    { 0x00, 0xC0, 0x00 },
+    { 0x00, 0xC6, 0x00 },
+    { 0x00, 0xFF, 0x00 },
+    { 0x00, 0xFF, 0x03 },
+    { 0x03, 0x00, 0x03 },
+    { 0x03, 0x0F, 0x00 },
+    { 0x10, 0x00, 0x02 },
+    { 0x10, 0x00, 0x06 },
+    { 0x18, 0x00, 0x06 },
+    { 0x20, 0x01, 0x00 },
+    { 0x30, 0x00, 0x07 },
+    { 0x30, 0x0A, 0x06 },
+    { 0x30, 0x18, 0x00 },
+    { 0x30, 0x80, 0x07 },
+    { 0x31, 0x00, 0x06 },
+    { 0x34, 0x0C, 0x06 },
+    { 0x60, 0x00, 0x06 },
+    { 0x80, 0x00, 0x04 },
+    { 0x80, 0x03, 0x06 },
+    { 0x80, 0x0F, 0xC0 },
+    { 0x80, 0x31, 0x07 },
+    { 0x80, 0x33, 0x03 },
+    { 0x80, 0x3F, 0x00 },
+    { 0x80, 0x61, 0xC6 },
+    { 0x80, 0x83, 0x03 },
+    { 0x80, 0x87, 0x07 },
+    { 0x84, 0x01, 0x06 },
+    { 0x84, 0x31, 0x06 },
+    { 0x98, 0x01, 0x06 },
+    { 0xC0, 0x99, 0x03 },
+    { 0xC0, 0xCF, 0x00 },
+    { 0xE0, 0x03, 0x00 },
+    { 0xE0, 0xFF, 0x01 },
+    { 0xF0, 0x01, 0x00 },
+    { 0xF0, 0x03, 0x00 },
+    { 0xF0, 0xC0, 0x00 },
+    { 0xFC, 0x0F, 0x30 },
+    { 0x00, 0x00, 0x0F },
+    { 0x00, 0x00, 0x1E },
+    { 0x00, 0x00, 0x20 },
+    { 0x00, 0x00, 0x3C },
+    { 0x00, 0x07, 0x07 },
+    { 0x00, 0x0C, 0x06 },
+    { 0x00, 0x0E, 0x00 },
+    { 0x00, 0x1F, 0x00 },
+    { 0x00, 0x33, 0x03 },
+    { 0x00, 0x33, 0x06 },
+    { 0x00, 0x3E, 0x00 },
+    { 0x00, 0x3E, 0x06 },
+    { 0x00, 0x3F, 0x00 },
+    { 0x00, 0x3F, 0x03 },
+    { 0x00, 0x3F, 0x06 },
+    { 0x00, 0x63, 0x00 },
+    { 0x00, 0x70, 0x00 },
+    { 0x00, 0x7E, 0xE0 },
+    { 0x00, 0x80, 0x3F },
+    { 0x00, 0xC0, 0x01 },
+    { 0x00, 0xCF, 0x00 },
+    { 0x00, 0xE0, 0x00 },
+    { 0x00, 0xE0, 0x01 },
+    { 0x00, 0xE3, 0x07 },
+    { 0x00, 0xF0, 0x71 },
+    { 0x00, 0xFC, 0x01 },
+    { 0x03, 0xFE, 0x00 },
+    { 0x04, 0x00, 0x03 },
+    { 0x04, 0x87, 0x03 },
+    { 0x07, 0x00, 0x06 },
+    { 0x08, 0x00, 0x06 },
+    { 0x08, 0x00, 0x40 },
+    { 0x08, 0x0C, 0x00 },
+    { 0x0C, 0x00, 0x02 },
+    { 0x0C, 0x00, 0x07 },
+    { 0x10, 0x28, 0x00 },
+    { 0x10, 0x87, 0x03 },
+    { 0x10, 0xC0, 0x00 },
+    { 0x18, 0x00, 0x00 },
+    { 0x1C, 0xE3, 0x03 },
+    { 0x1C, 0xFF, 0x07 },
+    { 0x20, 0x00, 0x00 },
+    { 0x20, 0x00, 0x01 },
+    { 0x20, 0x00, 0x02 },
+    { 0x30, 0x00, 0x1E },
+    { 0x30, 0x00, 0x3E },
+    { 0x30, 0x03, 0x00 },
+    { 0x30, 0x1C, 0x03 },
+    { 0x30, 0x1E, 0x06 },
+    { 0x30, 0x2C, 0x00 },
+    { 0x30, 0x78, 0x00 },
+    { 0x30, 0x98, 0x01 },
+    { 0x30, 0xC0, 0x07 },
+    { 0x37, 0x00, 0x06 },
+    { 0x37, 0x0C, 0x06 },
+    { 0x38, 0x00, 0x70 },
+    { 0x38, 0xF0, 0x07 },
+    { 0x3C, 0x00, 0x00 },
+    { 0x40, 0x00, 0x06 },
+    { 0x60, 0x98, 0x01 },
+    { 0x70, 0x00, 0x03 },
+    { 0x70, 0x00, 0x38 },
+    { 0x70, 0x0C, 0x06 },
+    { 0x70, 0x0E, 0x06 },
+    { 0x70, 0x3E, 0x07 },
+    { 0x70, 0xC0, 0x00 },
+    { 0x70, 0xF0, 0x07 },
+    { 0x80, 0x00, 0x02 },
+    { 0x80, 0x33, 0x07 },
+    { 0x80, 0x71, 0x06 },
+    { 0x80, 0x73, 0xC6 },
+    { 0x80, 0x7F, 0x00 },
+    { 0x80, 0x9B, 0x01 },
+    { 0x80, 0xC1, 0x07 },
+    { 0x80, 0xF3, 0xFF },
+    { 0x84, 0xFF, 0x07 },
+    { 0x8C, 0x03, 0x07 },
+    { 0x90, 0x28, 0x00 },
+    { 0x90, 0xFF, 0x07 },
+    { 0x98, 0x03, 0x07 },
+    { 0x98, 0x71, 0x06 },
+    { 0x98, 0xFF, 0x07 },
+    { 0x9C, 0x03, 0x00 },
+    { 0x9C, 0x03, 0x07 },
+    { 0x9C, 0x33, 0x03 },
+    { 0xA4, 0x31, 0x06 },
+    { 0xC0, 0x00, 0x00 },
+    { 0xC0, 0x01, 0x00 },
+    { 0xC0, 0x01, 0x07 },
+    { 0xC0, 0x07, 0x00 },
+    { 0xC0, 0x0F, 0x00 },
+    { 0xC0, 0x23, 0x00 },
+    { 0xC0, 0x71, 0x02 },
+    { 0xC0, 0x99, 0x01 },
+    { 0xC0, 0xC1, 0x03 },
+    { 0xC0, 0xE1, 0x00 }
+};
+
+///
+/// @brief Offsets of the glyphs in the stream
+///
+static const uint16_t Terminal16x24c_offsets[225] =
+{
+    0, 0, 10, 19, 44, 82, 135, 175, 179, 190, 201, 215, 234, 247, 255, 260,
+    274, 301, 315, 350, 366, 388, 407, 427, 447, 470, 499, 503, 519, 529, 540, 550,
+    570, 620, 639, 656, 670, 685, 695, 705, 726, 738, 749, 761, 787, 797, 810, 825,
+    838, 855, 883, 903, 929, 942, 954, 971, 989, 1018, 1032, 1062, 1069, 1083, 1090, 1100,
+    1114, 1120, 1131, 1145, 1155, 1169, 1180, 1198, 1228, 1238, 1248, 1269, 1286, 1296, 1309, 1319,
+    1331, 1342, 1356, 1367, 1386, 1404, 1414, 1426, 1438, 1456, 1472, 1491, 1506, 1515, 1530, 1543,
+    1549, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1631, 1631, 1631, 1644, 1644, 1644,
+    1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1659, 1659, 1659, 1672, 1672, 1672,
+    1692, 1692, 1696, 1724, 1745, 1763, 1776, 1785, 1826, 1835, 1864, 1891, 1902, 1913, 1921, 1943,
+    1950, 1965, 1982, 2005, 2022, 2028, 2039, 2068, 2073, 2086, 2094, 2109, 2120, 2143, 2178, 2209,
+    2226, 2254, 2282, 2316, 2356, 2381, 2406, 2423, 2438, 2451, 2464, 2477, 2487, 2501, 2518, 2529,
+    2540, 2557, 2596, 2618, 2634, 2656, 2687, 2709, 2735, 2769, 2784, 2799, 2811, 2823, 2849, 2866,
+    2895, 2912, 2929, 2949, 2975, 2992, 3003, 3022, 3041, 3055, 3072, 3092, 3115, 3125, 3135, 3148,
+    3158, 3188, 3219, 3231, 3243, 3255, 3282, 3297, 3309, 3339, 3355, 3371, 3393, 3412, 3440, 3451,
+    3482
+};
+
+///
+/// @brief Stream of compressed glyphs
+///
+static const uint8_t Terminal16x24c[3482] =
+{
+    0x72, 0xFF, 0xFC, 0x3F, 0x07, 0xFF, 0xFC, 0x3F, 0x07, 0x0B, 0x57, 0x22, 0x22, 0x22, 0x20, 0x20,
+    0x22, 0x22, 0x22, 0x3B, 0x58, 0xAE, 0xB6, 0x18, 0xFF, 0xF0, 0x7F, 0x00, 0xFF, 0xF0, 0x63, 0x00,
+    0xB6, 0x18, 0xFF, 0xF0, 0x7F, 0x00, 0xFF, 0xF0, 0x63, 0x00, 0xAE, 0x24, 0x39, 0xFF, 0xE0, 0x01,
+    0x03, 0xFF, 0xF0, 0x03, 0x06, 0xFF, 0x30, 0x07, 0x06, 0xFF, 0x18, 0x06, 0x3F, 0xFF, 0x18, 0xFF,
+    0x3F, 0xFF, 0xFE, 0x3F, 0x06, 0xFF, 0x1E, 0x1C, 0x06, 0xFF, 0x18, 0x18, 0x03, 0xFF, 0x18, 0xF0,
+    0x03, 0xB5, 0x2C, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xF8, 0x01, 0x06, 0xFF, 0x8C, 0x81, 0x03, 0xFF,
+    0x8C, 0xC1, 0x01, 0xFF, 0x8C, 0x71, 0x00, 0xFF, 0xFC, 0x1C, 0x00, 0xFF, 0x78, 0xCE, 0x03, 0xFF,
+    0x80, 0xE3, 0x07, 0xFF, 0xC0, 0x31, 0x06, 0xFF, 0x70, 0x30, 0x06, 0xFF, 0x38, 0x30, 0x06, 0xFF,
+    0x0C, 0xF0, 0x03, 0xFF, 0x04, 0xE0, 0x01, 0x3B, 0x5D, 0xFF, 0xF0, 0xF8, 0x03, 0xFF, 0xF8, 0x1F,
+    0x07, 0xFF, 0x1C, 0x0F, 0x06, 0xFF, 0x0C, 0x1E, 0x06, 0xFF, 0x0C, 0x3B, 0x06, 0xFF, 0x9C, 0x73,
+    0x07, 0xFF, 0xF8, 0xE1, 0x03, 0xFF, 0xF0, 0xC0, 0x03, 0x4A, 0xFF, 0x00, 0x38, 0x06, 0x35, 0x72,
+    0x22, 0x22, 0x22, 0x66, 0xB8, 0x0A, 0xFF, 0xC0, 0x03, 0x1F, 0xDC, 0xD6, 0x63, 0xBE, 0x56, 0xBE,
+    0x63, 0xD6, 0xDC, 0xFF, 0xE0, 0x03, 0x0F, 0x0A, 0x3C, 0x49, 0xFF, 0x20, 0x03, 0x00, 0xCD, 0x83,
+    0xF5, 0x72, 0x72, 0xF5, 0x83, 0xCD, 0x83, 0x3B, 0x05, 0x05, 0x05, 0x05, 0x05, 0xFF, 0xC0, 0xFF,
+    0x03, 0xFF, 0xC0, 0xFF, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x55, 0x55, 0x55, 0xFF, 0x00, 0x80,
+    0x73, 0xB1, 0xFF, 0x00, 0x80, 0x1F, 0x9F, 0x56, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x73,
+    0x23, 0x2B, 0x2B, 0x23, 0x39, 0xA1, 0xA2, 0x73, 0x5A, 0x2D, 0xA6, 0xF8, 0xFF, 0xF8, 0x00, 0x00,
+    0xD8, 0x30, 0x3A, 0x07, 0x09, 0xFF, 0xE0, 0xE0, 0x03, 0xFF, 0x70, 0x30, 0x07, 0x4D, 0xFF, 0x30,
+    0x1C, 0x06, 0x02, 0xFF, 0x70, 0x06, 0x07, 0xFF, 0xE0, 0x83, 0x03, 0x09, 0x07, 0x49, 0xD9, 0xFF,
+    0xE0, 0x00, 0x06, 0x8A, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x49, 0xD9, 0xFF, 0xE0, 0x00,
+    0x07, 0xFF, 0x70, 0x80, 0x07, 0xFF, 0x30, 0xC0, 0x06, 0xFF, 0x30, 0x60, 0x06, 0xFF, 0x30, 0x30,
+    0x06, 0xFF, 0x70, 0x1C, 0x06, 0xFF, 0xE0, 0x0F, 0x06, 0xFF, 0xC0, 0x07, 0x06, 0x03, 0x48, 0x8A,
+    0x00, 0x02, 0x02, 0x02, 0xDE, 0xFF, 0xE0, 0x1B, 0x03, 0xFF, 0xC0, 0xF9, 0x03, 0x3B, 0x3B, 0xB4,
+    0x3B, 0xFF, 0x00, 0xDC, 0x00, 0xB3, 0xFF, 0x80, 0xC3, 0x00, 0xFF, 0xE0, 0xC0, 0x00, 0xE0, 0x01,
+    0x01, 0x7A, 0x7A, 0x7A, 0x48, 0xFF, 0xF0, 0x0F, 0x06, 0xFF, 0xF0, 0x0F, 0x06, 0x02, 0x02, 0x02,
+    0x02, 0xCE, 0xFF, 0x30, 0xF8, 0x01, 0x3B, 0x39, 0x3C, 0x6C, 0xFF, 0xC0, 0x18, 0x03, 0xFF, 0x60,
+    0x0C, 0x06, 0xDD, 0x02, 0x02, 0xCE, 0xFF, 0x30, 0xF8, 0x03, 0x3B, 0x39, 0x12, 0x12, 0x00, 0x87,
+    0xFF, 0x30, 0xE0, 0x03, 0xD1, 0xFF, 0x30, 0x1E, 0x00, 0xFF, 0xB0, 0x07, 0x00, 0x9B, 0x16, 0x39,
+    0xFF, 0xC0, 0xE1, 0x01, 0xFF, 0xE0, 0xF3, 0x03, 0xDF, 0xCF, 0x02, 0x02, 0xCF, 0xDF, 0xFF, 0xE0,
+    0xF3, 0x03, 0xFF, 0xC0, 0xE1, 0x01, 0x39, 0x51, 0xFF, 0xE0, 0x0F, 0x06, 0xFF, 0x60, 0x1C, 0x06,
+    0x4D, 0x4D, 0xFF, 0x30, 0x18, 0x07, 0xFF, 0x30, 0x18, 0x03, 0xFF, 0x60, 0xCC, 0x01, 0xFF, 0xE0,
+    0xFF, 0x00, 0x90, 0x72, 0x47, 0x93, 0x47, 0x55, 0x55, 0x55, 0xFF, 0x00, 0x83, 0x73, 0xFF, 0x80,
+    0x87, 0x3F, 0xFF, 0x00, 0x83, 0x1F, 0x9F, 0x48, 0x29, 0x39, 0x2A, 0x77, 0x7B, 0x79, 0x67, 0xF7,
+    0xE2, 0x49, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x48, 0xE2, 0xF7, 0x67,
+    0x79, 0x7B, 0x77, 0x2A, 0x39, 0x29, 0x66, 0x19, 0xC1, 0xFF, 0x0C, 0x3C, 0x07, 0xFF, 0x18, 0x3C,
+    0x07, 0xFF, 0x38, 0x0E, 0x00, 0xFF, 0xF0, 0x0F, 0x00, 0x99, 0x2C, 0xFF, 0x00, 0xFC, 0x07, 0xFF,
+    0x80, 0xFF, 0x3F, 0xFF, 0xE0, 0x03, 0x78, 0xFF, 0x70, 0x00, 0x40, 0xFF, 0x18, 0xF8, 0xC3, 0xFF,
+    0x0C, 0xFE, 0x87, 0xFF, 0x04, 0x07, 0x86, 0xFF, 0x04, 0xE3, 0x83, 0xFF, 0x04, 0xFF, 0x87, 0xFF,
+    0x0C, 0x0F, 0x46, 0xFF, 0x38, 0x00, 0x07, 0x13, 0xFF, 0xC0, 0xFF, 0x00, 0x3B, 0x0B, 0x49, 0x3C,
+    0x98, 0xFF, 0xF0, 0xC1, 0x00, 0xC4, 0x9D, 0xFF, 0xE0, 0xC7, 0x00, 0x7C, 0x2E, 0x10, 0x0B, 0x49,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0xDE, 0xFF, 0xE0, 0x1B, 0x03, 0xFF, 0xC0, 0xF9, 0x03, 0xB4,
+    0x39, 0x07, 0x09, 0xFF, 0xE0, 0xC1, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3A, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x84, 0x33, 0xFF, 0xE0, 0xC0, 0x03, 0x09, 0x07, 0x48, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x48, 0x01, 0x01, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x3A, 0x48, 0x27, 0xFD, 0x33, 0xFF, 0x70, 0x00, 0x06, 0x00, 0x02, 0x02, 0x02, 0xFF, 0x30,
+    0xFC, 0x07, 0xFF, 0x60, 0xFC, 0x03, 0x3A, 0x01, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x01, 0x01, 0x49, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0x30,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x84, 0x13, 0x45, 0x49, 0x01, 0x01, 0xFF, 0x00, 0x08, 0x00,
+    0x37, 0xFF, 0x00, 0x77, 0x00, 0xFF, 0x80, 0xE3, 0x00, 0xFF, 0xC0, 0xC1, 0x01, 0xFF, 0x60, 0x80,
+    0x03, 0x00, 0x61, 0x58, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3B, 0x01, 0x01,
+    0x70, 0x51, 0x38, 0x0E, 0x38, 0x51, 0x70, 0x01, 0x01, 0x03, 0x3A, 0x01, 0x01, 0x16, 0xFF, 0xE0,
+    0x01, 0x00, 0x51, 0x1C, 0x3B, 0x2C, 0x0B, 0x01, 0x01, 0x3B, 0x07, 0x09, 0x1B, 0x66, 0x00, 0x00,
+    0x00, 0x00, 0xDB, 0x1B, 0x09, 0x07, 0x49, 0x01, 0x01, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0xFF, 0x60,
+    0x18, 0x00, 0xFF, 0xE0, 0x0F, 0x00, 0x51, 0x3B, 0x07, 0x09, 0x1B, 0x66, 0x00, 0xCB, 0xCC, 0xFF,
+    0x30, 0x00, 0x76, 0xFF, 0x70, 0x00, 0x63, 0xFF, 0xE0, 0x80, 0x63, 0xFF, 0xC0, 0xFF, 0x61, 0xFF,
+    0x00, 0x7F, 0x30, 0x49, 0x01, 0x01, 0x86, 0x86, 0x86, 0xD1, 0xFF, 0x70, 0xEC, 0x01, 0xFF, 0xE0,
+    0xCF, 0x07, 0xFF, 0xC0, 0x03, 0x07, 0x35, 0x39, 0xFF, 0xC0, 0x03, 0x03, 0xFF, 0xE0, 0x07, 0x06,
+    0xFF, 0x60, 0x06, 0x06, 0x02, 0x02, 0x4D, 0x4D, 0xFF, 0x30, 0x38, 0x03, 0xFF, 0x60, 0xF0, 0x03,
+    0xB5, 0x3B, 0x12, 0x12, 0x12, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x12, 0x12, 0x12, 0x3A, 0x45,
+    0x13, 0x23, 0x03, 0x03, 0x03, 0x03, 0x03, 0x23, 0x13, 0x44, 0x2C, 0x16, 0x9B, 0xF9, 0x48, 0xFF,
+    0x00, 0xF8, 0x03, 0x10, 0x03, 0x10, 0x5D, 0x48, 0xF9, 0x9B, 0x16, 0x3A, 0xFF, 0xF0, 0x3F, 0x00,
+    0x01, 0x10, 0x2B, 0x2E, 0x56, 0xB8, 0x10, 0x2B, 0x01, 0xFF, 0xF0, 0x3F, 0x00, 0x2C, 0x35, 0x81,
+    0x87, 0xFF, 0xF0, 0xC0, 0x03, 0xFF, 0xC0, 0xE3, 0x00, 0xE6, 0x38, 0xAB, 0xFF, 0x80, 0xF3, 0x00,
+    0xFF, 0xC0, 0xE1, 0x03, 0xFF, 0xF0, 0x80, 0x07, 0x00, 0x61, 0x2C, 0x16, 0x43, 0x6E, 0x57, 0x38,
+    0x4A, 0x4A, 0x37, 0x57, 0x6E, 0x43, 0x16, 0x1A, 0x3A, 0x00, 0x87, 0xD3, 0xFF, 0x30, 0xF0, 0x06,
+    0xFF, 0x30, 0x38, 0x06, 0xFF, 0x30, 0x0E, 0x06, 0xFF, 0xB0, 0x07, 0x06, 0xFF, 0xF0, 0x01, 0x06,
+    0xFF, 0xF0, 0x00, 0x06, 0x00, 0x03, 0x65, 0x46, 0x46, 0x14, 0x14, 0x14, 0x14, 0x49, 0x30, 0xD8,
+    0xFF, 0xF8, 0x00, 0x00, 0xF8, 0xA6, 0x2D, 0x5A, 0x73, 0xA2, 0xA1, 0x55, 0x14, 0x14, 0x14, 0x14,
+    0x46, 0x46, 0x48, 0x56, 0x36, 0xF6, 0x16, 0x12, 0x16, 0xF6, 0x36, 0x56, 0x2C, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x54, 0x30, 0x19, 0x21, 0xC5, 0x1A,
+    0x49, 0x2C, 0x5B, 0xE4, 0x08, 0x08, 0x08, 0x8E, 0x8F, 0x18, 0x17, 0x49, 0xFF, 0xFC, 0xFF, 0x03,
+    0x1F, 0x75, 0x74, 0x04, 0x04, 0x68, 0x92, 0x2F, 0x06, 0x48, 0x06, 0x11, 0x3A, 0x50, 0x04, 0x04,
+    0x04, 0x04, 0x47, 0x39, 0x06, 0x11, 0xA3, 0x8C, 0x04, 0x04, 0x67, 0xFF, 0x80, 0x81, 0x01, 0x1F,
+    0x1F, 0x39, 0x06, 0x11, 0xA7, 0x08, 0x08, 0x08, 0x08, 0xA8, 0xAC, 0x1C, 0x3A, 0x24, 0x24, 0x24,
+    0x24, 0x01, 0xFF, 0xF8, 0xFF, 0x07, 0xFF, 0x1C, 0x03, 0x00, 0x4B, 0x4B, 0x4B, 0x19, 0x3A, 0xFF,
+    0x00, 0x80, 0x39, 0xFF, 0x00, 0xDE, 0x7F, 0xFF, 0x00, 0x7F, 0xE6, 0xE5, 0x91, 0x91, 0x91, 0xE5,
+    0xFF, 0x80, 0x3F, 0x66, 0xFF, 0x80, 0x1F, 0x7C, 0xFF, 0x80, 0x01, 0x3C, 0x48, 0x1F, 0x1F, 0x36,
+    0x24, 0x0C, 0x0C, 0x4F, 0x18, 0x17, 0x48, 0x04, 0x04, 0x04, 0x1E, 0x42, 0x42, 0x03, 0x03, 0x03,
+    0x47, 0xFF, 0x80, 0x01, 0x60, 0x69, 0x69, 0x69, 0x69, 0xFF, 0x9C, 0x01, 0xE0, 0xFF, 0x9C, 0xFF,
+    0x7F, 0xFF, 0x9C, 0xFF, 0x1F, 0x49, 0x1F, 0x1F, 0x29, 0x39, 0x77, 0x7B, 0xFF, 0x00, 0x87, 0x01,
+    0xFF, 0x80, 0x03, 0x03, 0x04, 0x8B, 0x48, 0x3E, 0x3E, 0x3E, 0x3E, 0x1F, 0x1F, 0x03, 0x03, 0x03,
+    0x3B, 0x0A, 0x0A, 0x36, 0x0C, 0x0C, 0x0A, 0x18, 0x36, 0x0C, 0x0C, 0x0A, 0x18, 0x48, 0x0A, 0x0A,
+    0x36, 0x24, 0x0C, 0x0C, 0x4F, 0x18, 0x17, 0x3A, 0x06, 0x11, 0x3A, 0x50, 0x04, 0x04, 0x04, 0x50,
+    0x3A, 0x2F, 0x06, 0x49, 0x40, 0x40, 0x75, 0x74, 0x04, 0x04, 0x68, 0x92, 0x2F, 0x06, 0x39, 0x06,
+    0x11, 0xA3, 0x8C, 0x04, 0x04, 0x67, 0xFF, 0x80, 0x81, 0x03, 0x40, 0x40, 0x49, 0x0A, 0x0A, 0x56,
+    0x24, 0x0C, 0x0C, 0x0C, 0x4F, 0x57, 0xA5, 0x48, 0x76, 0xFF, 0x00, 0x1F, 0x06, 0xFF, 0x80, 0x19,
+    0x06, 0x08, 0x08, 0x08, 0xFF, 0x80, 0x61, 0x06, 0x5B, 0xB2, 0x3A, 0x0C, 0x0C, 0x0C, 0x44, 0xFF,
+    0xF8, 0xFF, 0x03, 0xFF, 0x80, 0x81, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x48, 0x27, 0x6C, 0x0B,
+    0x03, 0x03, 0x23, 0x78, 0x0A, 0x0A, 0x3A, 0x4F, 0x6B, 0x48, 0x5D, 0x2B, 0x35, 0x2B, 0x5D, 0xA9,
+    0x6B, 0x0C, 0x3A, 0xE6, 0x0A, 0x03, 0x10, 0x2D, 0x0F, 0x2D, 0x10, 0x03, 0x0A, 0x90, 0x3A, 0x8B,
+    0x04, 0x93, 0xFF, 0x00, 0xCF, 0x03, 0x06, 0x39, 0x06, 0xFF, 0x00, 0xCE, 0x03, 0x93, 0x04, 0x8B,
+    0x2B, 0x0D, 0x6A, 0x8D, 0xB0, 0xB7, 0xFF, 0x00, 0xC0, 0x3F, 0xA0, 0x10, 0x3B, 0xA9, 0x6B, 0x0C,
+    0x48, 0x04, 0x68, 0xE8, 0xFF, 0x80, 0xE1, 0x06, 0x08, 0xFF, 0x80, 0x1D, 0x06, 0xFF, 0x80, 0x0F,
+    0x06, 0x8C, 0x04, 0x47, 0x05, 0x05, 0x1C, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xF8, 0xE7, 0x7F, 0x63,
+    0x14, 0x14, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x14, 0x14, 0x63, 0xFF,
+    0xF8, 0xE7, 0x7F, 0xFF, 0xF0, 0xFF, 0x3F, 0x1C, 0x05, 0x05, 0x3B, 0x0E, 0x39, 0x0F, 0x0F, 0x0F,
+    0x05, 0x0E, 0x58, 0x58, 0x58, 0x39, 0x05, 0x24, 0x13, 0x80, 0x80, 0x80, 0x13, 0x2A, 0xFF, 0x00,
+    0x0A, 0x00, 0x07, 0x09, 0xFF, 0xE0, 0xCB, 0x03, 0xFF, 0x60, 0x0A, 0x03, 0x85, 0x85, 0x85, 0xFF,
+    0x70, 0x02, 0x06, 0xFF, 0x70, 0x00, 0x07, 0xFF, 0x20, 0x00, 0x03, 0x1E, 0x35, 0x00, 0xFF, 0x48,
+    0x80, 0x03, 0xFF, 0x48, 0xC0, 0x01, 0xFF, 0x30, 0x70, 0x00, 0x37, 0xFF, 0x00, 0x8E, 0x01, 0xFF,
+    0x80, 0x43, 0x02, 0xFF, 0xC0, 0x41, 0x02, 0xFF, 0x70, 0x80, 0x01, 0xFF, 0x38, 0x00, 0x00, 0xFF,
+    0x0C, 0x80, 0x01, 0xFF, 0x04, 0x40, 0x02, 0xFF, 0x00, 0x40, 0x02, 0xFF, 0x00, 0x80, 0x01, 0x3B,
+    0x07, 0x09, 0x1B, 0x66, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x3A, 0x1A, 0x1A, 0x9C,
+    0x1A, 0x1A, 0x20, 0x9C, 0xC8, 0xFF, 0x40, 0x00, 0x00, 0xC8, 0x9C, 0x2B, 0x5E, 0x7D, 0x04, 0x04,
+    0x47, 0x5E, 0x7D, 0xE3, 0x08, 0x08, 0xAD, 0xAA, 0x2C, 0x16, 0x43, 0x6E, 0x7F, 0xFF, 0x03, 0x1E,
+    0x00, 0x4A, 0x4A, 0x37, 0x7F, 0xFF, 0xC3, 0x03, 0x00, 0x43, 0x16, 0x1A, 0x72, 0xE9, 0xE9, 0x4F,
+    0x38, 0xAB, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xC0, 0xC1, 0x00, 0xFF, 0xE0, 0x80, 0x39, 0xFF, 0x60,
+    0xF0, 0x3F, 0x9A, 0xFF, 0xFE, 0x87, 0x01, 0xFF, 0x6E, 0x80, 0x01, 0x28, 0x3A, 0xA4, 0xA4, 0xFF,
+    0xC0, 0xFF, 0x07, 0xFF, 0xE0, 0xFF, 0x07, 0xDD, 0x02, 0x02, 0x02, 0x02, 0x8A, 0xFF, 0x20, 0x00,
+    0x06, 0x3A, 0xC9, 0xFF, 0x70, 0xBE, 0x03, 0x9A, 0xFE, 0x28, 0x28, 0x28, 0xFE, 0x9A, 0xFF, 0x70,
+    0x9F, 0x03, 0xC9, 0x2B, 0x1A, 0xD2, 0xDA, 0xFC, 0xE7, 0x17, 0x17, 0xE7, 0xFC, 0xDA, 0xD2, 0x1A,
+    0x81, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x49, 0xFF, 0x00, 0x1E, 0x18, 0xFF, 0x70,
+    0x3F, 0x30, 0xFF, 0xF8, 0x73, 0x30, 0xFF, 0xDC, 0x61, 0x30, 0xFF, 0x8C, 0xC1, 0x30, 0xFF, 0x0C,
+    0x83, 0x31, 0xFF, 0x0C, 0x87, 0x19, 0xFF, 0x0C, 0xCE, 0x1F, 0xFF, 0x0C, 0xFC, 0x0E, 0xFF, 0x00,
+    0x78, 0x00, 0x57, 0x21, 0x21, 0x21, 0x20, 0x20, 0x21, 0x21, 0x21, 0x2C, 0x07, 0x09, 0x1B, 0xCA,
+    0xFF, 0x30, 0x3E, 0x06, 0xFF, 0x10, 0xFF, 0x04, 0xFF, 0x90, 0xC1, 0x04, 0xFF, 0x90, 0x80, 0x04,
+    0xFF, 0xB0, 0x80, 0x06, 0xCA, 0x1B, 0x09, 0x07, 0x57, 0xFF, 0x00, 0x27, 0x00, 0xFF, 0xB0, 0x2F,
+    0x00, 0xEC, 0xEC, 0xFF, 0x90, 0x24, 0x00, 0xFF, 0xF0, 0x2F, 0x00, 0xFF, 0xE0, 0x2F, 0x00, 0xFF,
+    0x00, 0x20, 0x00, 0x39, 0x29, 0x2A, 0x5C, 0x59, 0x20, 0x20, 0x29, 0x2A, 0x5C, 0x59, 0x39, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x2D, 0x2D, 0x56, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x48, 0x99, 0x62, 0xFF, 0x08, 0x08, 0x00, 0xFF, 0xF4, 0x17, 0x00, 0xFF, 0x94, 0x10, 0x00,
+    0xFF, 0x74, 0x13, 0x00, 0xBF, 0x62, 0x99, 0x65, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x47, 0x70,
+    0xFF, 0xF8, 0x01, 0x00, 0xF1, 0x4B, 0x4B, 0xF1, 0xFF, 0xF8, 0x01, 0x00, 0x70, 0x49, 0x25, 0x25,
+    0x25, 0x25, 0xFF, 0xE0, 0x7F, 0x06, 0xFF, 0xE0, 0x7F, 0x06, 0x25, 0x25, 0x25, 0x25, 0x56, 0xBF,
+    0xFF, 0x0C, 0x0E, 0x00, 0xFF, 0x0C, 0x0F, 0x00, 0xFF, 0x8C, 0x0F, 0x00, 0xFF, 0xFC, 0x0C, 0x00,
+    0xFF, 0x78, 0x0C, 0x00, 0x0F, 0x56, 0xFF, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0xFF, 0xFC,
+    0x07, 0x00, 0xFF, 0xB8, 0x07, 0x00, 0x74, 0x1A, 0xC5, 0x21, 0x19, 0x30, 0x49, 0x40, 0x40, 0x0B,
+    0x03, 0x03, 0x0B, 0x78, 0x6C, 0x0A, 0x03, 0x39, 0xFF, 0xE0, 0x01, 0x00, 0xFF, 0xF8, 0x07, 0x10,
+    0xFF, 0xF8, 0x07, 0x18, 0x9E, 0x9E, 0x9E, 0xFF, 0x0C, 0x00, 0x30, 0xFF, 0x0C, 0x00, 0x18, 0xFF,
+    0xFC, 0xFF, 0x1F, 0x1F, 0x73, 0x05, 0x1C, 0x1C, 0x05, 0x72, 0xFF, 0x00, 0x00, 0x30, 0xFF, 0x00,
+    0x00, 0x38, 0xFF, 0x00, 0x00, 0x18, 0x56, 0x26, 0x62, 0x62, 0x72, 0x72, 0x0F, 0x0F, 0x47, 0xFA,
+    0xFF, 0xE0, 0x27, 0x00, 0xD0, 0xC2, 0xC2, 0xD0, 0xFF, 0xE0, 0x27, 0x00, 0xFA, 0x49, 0x59, 0x5C,
+    0x2A, 0x29, 0x20, 0x20, 0x59, 0x5C, 0x2A, 0x29, 0x2C, 0x61, 0xBD, 0xFF, 0xFC, 0x81, 0x03, 0xFF,
+    0xFC, 0xC1, 0x01, 0xAF, 0x37, 0x76, 0xFF, 0x80, 0xE3, 0x03, 0xFB, 0xE1, 0xD7, 0xC0, 0x30, 0x2C,
+    0x61, 0xBD, 0xFF, 0xFC, 0x81, 0x03, 0xFF, 0xFC, 0xC1, 0x01, 0xAF, 0x37, 0xA5, 0xFF, 0x80, 0x23,
+    0x04, 0xFF, 0xC0, 0x11, 0x06, 0xFF, 0x70, 0x10, 0x07, 0xFF, 0x38, 0xF0, 0x05, 0xFF, 0x0C, 0xE0,
+    0x04, 0x30, 0x3B, 0xFF, 0x94, 0x00, 0x06, 0xFF, 0x94, 0x80, 0x03, 0xFF, 0x94, 0xC0, 0x01, 0xFF,
+    0xFC, 0x70, 0x00, 0xFF, 0x6C, 0x38, 0x00, 0x76, 0xFF, 0x00, 0xE7, 0x03, 0xFB, 0xE1, 0xD7, 0xC0,
+    0x30, 0x56, 0x73, 0xB1, 0xFF, 0x00, 0xC0, 0x71, 0xFF, 0x80, 0xF3, 0x60, 0xFF, 0x80, 0xF3, 0xC0,
+    0x6A, 0x0D, 0x3B, 0x0B, 0xFF, 0x01, 0xE0, 0x07, 0xB9, 0xFF, 0xC7, 0xCF, 0x00, 0xFF, 0xF6, 0xC1,
+    0x00, 0xFF, 0x14, 0xC0, 0x00, 0x9D, 0xFF, 0xE0, 0xC7, 0x00, 0x7C, 0x2E, 0x10, 0x0B, 0x3B, 0x0B,
+    0x49, 0x3C, 0x98, 0xFF, 0xF4, 0xC1, 0x00, 0xFF, 0x16, 0xC0, 0x00, 0xFF, 0xF7, 0xC0, 0x00, 0xFF,
+    0xE3, 0xC7, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x2E, 0x10, 0x0B, 0x3B, 0x0B, 0x49, 0xFF, 0x04, 0xFE,
+    0x00, 0xFF, 0xC6, 0xCF, 0x00, 0xFF, 0xF3, 0xC1, 0x00, 0xFF, 0x13, 0xC0, 0x00, 0xFF, 0xF3, 0xC0,
+    0x00, 0xFF, 0xE6, 0xC7, 0x00, 0xFF, 0x04, 0xFF, 0x00, 0x2E, 0x10, 0x0B, 0x3B, 0x0B, 0xFF, 0x02,
+    0xE0, 0x07, 0xFF, 0x07, 0xFE, 0x00, 0xFF, 0xC1, 0xCF, 0x00, 0xFF, 0xF1, 0xC1, 0x00, 0xFF, 0x12,
+    0xC0, 0x00, 0xFF, 0xF4, 0xC0, 0x00, 0xFF, 0xE4, 0xC7, 0x00, 0xFF, 0x07, 0xFF, 0x00, 0xFF, 0x02,
+    0xF8, 0x01, 0x10, 0x0B, 0x3B, 0x0B, 0x49, 0xB9, 0xFF, 0xC3, 0xCF, 0x00, 0xFF, 0xF0, 0xC1, 0x00,
+    0xC4, 0x9D, 0xFF, 0xE3, 0xC7, 0x00, 0xFF, 0x03, 0xFF, 0x00, 0x2E, 0x10, 0x0B, 0x3B, 0x0B, 0x49,
+    0x3C, 0x98, 0xFF, 0xF2, 0xC1, 0x00, 0xFF, 0x15, 0xC0, 0x00, 0xFF, 0xF5, 0xC0, 0x00, 0xFF, 0xE2,
+    0xC7, 0x00, 0x7C, 0x2E, 0x10, 0x0B, 0x2C, 0x35, 0x2B, 0x5A, 0x06, 0xB3, 0xFF, 0xE0, 0xC3, 0x00,
+    0xE0, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x3A, 0x07, 0x27, 0xFD, 0x33, 0xFF, 0x70, 0x00, 0x37,
+    0xCC, 0xCB, 0x00, 0x00, 0x00, 0x33, 0x48, 0xFF, 0xF1, 0xFF, 0x07, 0x71, 0xD5, 0x65, 0x89, 0x02,
+    0x02, 0x02, 0x02, 0x48, 0x01, 0x01, 0x02, 0x89, 0x65, 0xD5, 0x31, 0xFF, 0x31, 0x0C, 0x06, 0x02,
+    0x48, 0x01, 0xFF, 0xF4, 0xFF, 0x07, 0x65, 0x31, 0x31, 0x31, 0x65, 0x89, 0x02, 0x48, 0x01, 0x71,
+    0x31, 0x02, 0x02, 0x02, 0x31, 0x31, 0x02, 0x49, 0x88, 0x15, 0xD4, 0x3F, 0xFF, 0xF4, 0xFF, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF6, 0xFF, 0x07, 0xFF, 0xF7,
+    0xFF, 0x07, 0x15, 0x88, 0x00, 0x00, 0x49, 0x00, 0x32, 0x3F, 0x15, 0x71, 0x71, 0x3F, 0x32, 0x00,
+    0x00, 0x49, 0x00, 0x15, 0x15, 0x00, 0x01, 0x01, 0x15, 0x15, 0x00, 0x00, 0x2C, 0x0F, 0x0F, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x00, 0x84, 0x33, 0xFF, 0xE0, 0xC0, 0x03, 0x09, 0x07, 0x3A, 0x01, 0xFF,
+    0xF2, 0xFF, 0x07, 0xFF, 0x77, 0x00, 0x00, 0xFF, 0xE1, 0x01, 0x00, 0xFF, 0x81, 0x07, 0x00, 0xFF,
+    0x02, 0x3C, 0x00, 0xFF, 0x04, 0xF0, 0x00, 0xFF, 0x04, 0xC0, 0x03, 0xFF, 0x07, 0x00, 0x07, 0xFF,
+    0xF2, 0xFF, 0x07, 0x01, 0x3B, 0x07, 0xFF, 0xC1, 0xFF, 0x01, 0xFF, 0xE3, 0x80, 0x03, 0xFF, 0x67,
+    0x00, 0x07, 0x3F, 0x32, 0x00, 0x00, 0xDB, 0x1B, 0x09, 0x07, 0x3B, 0x07, 0x09, 0x1B, 0x66, 0x32,
+    0x3F, 0xD4, 0x15, 0xFF, 0x71, 0x00, 0x03, 0x1B, 0x09, 0x07, 0x3B, 0x07, 0x09, 0xFF, 0xE4, 0x80,
+    0x03, 0xFF, 0x66, 0x00, 0x07, 0x15, 0x15, 0x15, 0x3F, 0xFF, 0x74, 0x00, 0x03, 0x1B, 0x09, 0x07,
+    0x3B, 0x07, 0xFF, 0xC2, 0xFF, 0x01, 0xFF, 0xE7, 0x80, 0x03, 0xFF, 0x61, 0x00, 0x07, 0x88, 0xFF,
+    0x32, 0x00, 0x06, 0x32, 0x32, 0xFF, 0x77, 0x00, 0x03, 0xFF, 0xE2, 0x80, 0x03, 0x09, 0x07, 0x3B,
+    0x07, 0x09, 0xFF, 0xE3, 0x80, 0x03, 0xFF, 0x63, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0xFF, 0x73,
+    0x00, 0x03, 0x1B, 0x09, 0x07, 0x49, 0x79, 0xFF, 0x80, 0xC7, 0x01, 0xFF, 0x00, 0xEF, 0x00, 0x48,
+    0x1C, 0x2A, 0x3C, 0xFF, 0x00, 0xE7, 0x01, 0xFF, 0x80, 0xC3, 0x01, 0xFF, 0x00, 0x81, 0x00, 0x3B,
+    0x07, 0x09, 0xFF, 0xE0, 0x80, 0x33, 0xFF, 0x60, 0x00, 0x3F, 0xD3, 0xFF, 0x30, 0xFC, 0x06, 0xFF,
+    0xB0, 0x1F, 0x06, 0xFF, 0xF0, 0x01, 0x06, 0xFF, 0x7E, 0x00, 0x03, 0xFF, 0xE6, 0x80, 0x03, 0x09,
+    0x07, 0x3A, 0x45, 0xFF, 0xF1, 0xFF, 0x03, 0x7E, 0xBC, 0x60, 0x5F, 0x03, 0x03, 0x23, 0x13, 0x44,
+    0x3A, 0x45, 0x13, 0x23, 0x03, 0x5F, 0x60, 0xBC, 0x3D, 0xFF, 0x01, 0x00, 0x03, 0x13, 0x44, 0x3A,
+    0x45, 0x13, 0xBA, 0x60, 0x3D, 0x3D, 0x3D, 0x60, 0xBA, 0x13, 0x44, 0x3A, 0x45, 0x13, 0x7E, 0x3D,
+    0x03, 0x03, 0x03, 0x3D, 0x7E, 0x13, 0x44, 0x2C, 0x16, 0x43, 0x6E, 0x57, 0x38, 0xFF, 0x04, 0xF8,
+    0x07, 0xFF, 0x06, 0xF8, 0x07, 0xFF, 0x07, 0x1C, 0x00, 0x7F, 0xFF, 0xC1, 0x03, 0x00, 0x43, 0x16,
+    0x1A, 0x49, 0x01, 0x01, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0, 0xE0, 0x00, 0xFF, 0x80, 0x61, 0x00,
+    0x90, 0x38, 0x49, 0x01, 0xFF, 0xF8, 0xFF, 0x07, 0x21, 0x19, 0xFF, 0x0C, 0x0E, 0x06, 0xFF, 0x8C,
+    0x1F, 0x06, 0xFF, 0x8C, 0x39, 0x06, 0xFF, 0xF8, 0x70, 0x06, 0xFF, 0x70, 0xE0, 0x03, 0xB2, 0x49,
+    0x2C, 0xFF, 0x04, 0xE3, 0x03, 0xFF, 0x8C, 0x71, 0x06, 0x34, 0x41, 0x54, 0x8E, 0x8F, 0x18, 0x17,
+    0x49, 0x2C, 0x5B, 0xE4, 0x54, 0x41, 0x34, 0xFF, 0x8C, 0x31, 0x07, 0xFF, 0x84, 0x33, 0x03, 0x18,
+    0x17, 0x49, 0x2C, 0xFF, 0x10, 0xE3, 0x03, 0xEF, 0x52, 0x95, 0x52, 0xFF, 0x98, 0x31, 0x07, 0xFF,
+    0x90, 0x33, 0x03, 0x18, 0x17, 0x49, 0xFF, 0x08, 0xC0, 0x03, 0xC6, 0xFF, 0x84, 0x71, 0x06, 0x95,
+    0xFF, 0x88, 0x31, 0x06, 0x54, 0xFF, 0x90, 0x31, 0x07, 0xF3, 0xFF, 0x08, 0xFF, 0x07, 0x17, 0x49,
+    0x2C, 0xC6, 0xFF, 0x9C, 0x71, 0x06, 0x34, 0x08, 0x08, 0xFF, 0x9C, 0x31, 0x07, 0xF3, 0xC7, 0x17,
+    0x49, 0x2C, 0x5B, 0xEF, 0xF4, 0xF4, 0x41, 0x8E, 0x8F, 0x18, 0x17, 0x2B, 0x5A, 0xFF, 0x00, 0xF3,
+    0x07, 0x08, 0x08, 0xFF, 0x80, 0x31, 0x03, 0x27, 0x7D, 0xE3, 0x08, 0x08, 0xAD, 0xAA, 0x48, 0x06,
+    0x11, 0x3A, 0xFF, 0x80, 0x03, 0x37, 0xFF, 0x80, 0x01, 0x3E, 0xFF, 0x80, 0x01, 0x1E, 0x04, 0x04,
+    0x47, 0x39, 0x06, 0x11, 0xFF, 0x04, 0x33, 0x03, 0x52, 0x34, 0x41, 0x54, 0xA8, 0xAC, 0x1C, 0x39,
+    0x06, 0x11, 0xA7, 0x08, 0x54, 0x41, 0x34, 0xFF, 0x0C, 0x33, 0x06, 0xFF, 0x04, 0x3F, 0x03, 0x1C,
+    0x39, 0x06, 0x11, 0xFF, 0x10, 0x33, 0x03, 0x41, 0x52, 0x95, 0x52, 0xFF, 0x18, 0x33, 0x06, 0xFF,
+    0x10, 0x3F, 0x03, 0x1C, 0x39, 0x06, 0x11, 0xFF, 0x1C, 0x33, 0x03, 0x34, 0x34, 0x08, 0x08, 0xFF,
+    0x1C, 0x33, 0x06, 0xFF, 0x1C, 0x3F, 0x03, 0xFF, 0x1C, 0x3C, 0x00, 0x48, 0x04, 0x94, 0x6D, 0x1E,
+    0xF0, 0xED, 0x03, 0x03, 0x03, 0x48, 0x04, 0x04, 0x04, 0x53, 0xF0, 0x42, 0x3E, 0x5F, 0x03, 0x48,
+    0x04, 0x53, 0x96, 0x6D, 0xEA, 0xFF, 0x8C, 0xFF, 0x07, 0x82, 0x81, 0x03, 0x48, 0x04, 0x1E, 0x1E,
+    0x1E, 0x0A, 0x0A, 0x4C, 0x4C, 0x4C, 0x3A, 0x2D, 0x11, 0xFF, 0x30, 0x87, 0x03, 0xFF, 0xB4, 0x03,
+    0x07, 0x1E, 0x1E, 0xFF, 0xF8, 0x01, 0x06, 0xFF, 0xF8, 0x01, 0x07, 0xFF, 0xCC, 0x87, 0x03, 0xFF,
+    0x0C, 0xFF, 0x01, 0x06, 0x48, 0xFF, 0x88, 0xFF, 0x07, 0x42, 0xFF, 0x04, 0x07, 0x00, 0xFF, 0x04,
+    0x03, 0x00, 0xFF, 0x88, 0x01, 0x00, 0xFF, 0x90, 0x01, 0x00, 0xFF, 0x90, 0x03, 0x00, 0xC7, 0xFF,
+    0x08, 0xFE, 0x07, 0x3A, 0x06, 0x11, 0xBB, 0xEB, 0x1E, 0x96, 0x53, 0x50, 0x3A, 0x2F, 0x06, 0x3A,
+    0x06, 0x11, 0x3A, 0x50, 0x53, 0x96, 0x1E, 0xEB, 0xBB, 0x2F, 0x06, 0x3A, 0x06, 0x11, 0xC3, 0xEE,
+    0x6D, 0x94, 0x6D, 0xEE, 0xC3, 0x2F, 0x06, 0x3A, 0x06, 0xFF, 0x08, 0xFE, 0x03, 0x64, 0xFF, 0x84,
+    0x03, 0x07, 0x94, 0xFF, 0x88, 0x01, 0x06, 0x53, 0xFF, 0x90, 0x03, 0x07, 0x64, 0xFF, 0x08, 0xFF,
+    0x01, 0x06, 0x3A, 0x06, 0x11, 0x64, 0xF2, 0x1E, 0x04, 0x04, 0xF2, 0x64, 0xFF, 0x1C, 0xFF, 0x01,
+    0x06, 0x3A, 0x05, 0x05, 0x05, 0x05, 0x97, 0x97, 0x97, 0x05, 0x05, 0x05, 0x05, 0x3A, 0x06, 0x5E,
+    0xFF, 0x00, 0x87, 0x33, 0xFF, 0x80, 0x03, 0x3F, 0xE8, 0xFF, 0x80, 0xF9, 0x06, 0xFF, 0x80, 0x1F,
+    0x06, 0xFF, 0xE0, 0x03, 0x07, 0xFF, 0x60, 0x87, 0x03, 0x5E, 0x06, 0x48, 0x27, 0xFF, 0x84, 0xFF,
+    0x03, 0xC1, 0x4C, 0x82, 0xFF, 0x10, 0x00, 0x03, 0x78, 0x0A, 0x0A, 0x48, 0x27, 0x6C, 0x0B, 0x81,
+    0x82, 0xFF, 0x1C, 0x00, 0x03, 0xFF, 0x0C, 0x80, 0x03, 0xEA, 0x0A, 0x48, 0x27, 0xFF, 0x90, 0xFF,
+    0x03, 0xFF, 0x18, 0x00, 0x07, 0x3E, 0x5F, 0xFF, 0x0C, 0x00, 0x03, 0xFF, 0x18, 0x80, 0x03, 0xED,
+    0x0A, 0x48, 0x27, 0xFF, 0x9C, 0xFF, 0x03, 0xFF, 0x1C, 0x00, 0x07, 0x4C, 0x03, 0x23, 0xFF, 0x1C,
+    0x80, 0x03, 0x42, 0x42, 0x2B, 0x0D, 0x6A, 0x8D, 0xB0, 0xB7, 0xFF, 0x10, 0xC0, 0x3F, 0xFF, 0x18,
+    0x00, 0x1E, 0xFF, 0x1C, 0xC0, 0x07, 0xFF, 0x0C, 0xF0, 0x00, 0xFF, 0x04, 0x3E, 0x00, 0x6B, 0x0C,
+    0x49, 0x46, 0x46, 0x75, 0x74, 0x04, 0x04, 0x68, 0x92, 0x2F, 0x06, 0x2B, 0x0D, 0x6A, 0x8D, 0xFF,
+    0x1C, 0x7E, 0xE0, 0xFF, 0x1C, 0xF0, 0x71, 0xFF, 0x1C, 0xC0, 0x3F, 0xA0, 0x10, 0xFF, 0x1C, 0xF0,
+    0x00, 0xFF, 0x1C, 0x3E, 0x00, 0xFF, 0x9C, 0x0F, 0x00, 0x0C
+};
+
+#endif // TERMINAL16C_FONT_RELEASE
@@ -0,0 +1,344 @@
+///
+/// @file Terminal8x12c.h
+/// @brief Font Terminal 8 x 12, compressed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+/// @note Generated by extras/Fonts/Terminal_Compress.py from Terminal8x12e.h, do not edit
+///
+
+#ifndef TERMINAL8C_FONT_RELEASE
+///
+/// @brief Library release number
+///
+#define TERMINAL8C_FONT_RELEASE 821
+
+///
+/// @brief Dictionary of columns
+///
+static const uint8_t Terminal8x12c_dictionary[161][2] =
+{
+    { 0xFE, 0x03 },
+    { 0xF8, 0x03 },
+    { 0x20, 0x00 },
+    { 0x00, 0x02 },
+    { 0xFD, 0x03 },
+    { 0xFC, 0x01 },
+    { 0xFC, 0x03 },
+    { 0xF8, 0x01 },
+    { 0x02, 0x02 },
+    { 0x08, 0x02 },
+    { 0xF0, 0x01 },
+    { 0x02, 0x00 },
+    { 0xF8, 0x00 },
+    { 0xFA, 0x03 },
+    { 0x01, 0x00 },
+    { 0x70, 0x00 },
+    { 0xF0, 0x03 },
+    { 0xF9, 0x03 },
+    { 0xFB, 0x03 },
+    { 0x00, 0x08 },
+    { 0x22, 0x02 },
+    { 0x08, 0x00 },
+    { 0x48, 0x02 },
+    { 0x00, 0x03 },
+    { 0x05, 0x02 },
+    { 0x0E, 0x00 },
+    { 0x40, 0x00 },
+    { 0x00, 0x00 },
+    { 0x04, 0x02 },
+    { 0x22, 0x00 },
+    { 0xFF, 0x0F },
+    { 0x03, 0x00 },
+    { 0x06, 0x03 },
+    { 0x01, 0x02 },
+    { 0x06, 0x00 },
+    { 0x18, 0x00 },
+    { 0x18, 0x03 },
+    { 0x20, 0x02 },
+    { 0x80, 0x00 },
+    { 0xF0, 0x00 },
+    { 0x00, 0x07 },
+    { 0x25, 0x02 },
+    { 0x3E, 0x00 },
+    { 0x4A, 0x02 },
+    { 0x50, 0x00 },
+    { 0x80, 0x01 },
+    { 0xFE, 0x01 },
+    { 0x08, 0x01 },
+    { 0x0C, 0x00 },
+    { 0x0F, 0x00 },
+    { 0x1C, 0x00 },
+    { 0x46, 0x00 },
+    { 0x8C, 0x01 },
+    { 0xBE, 0x00 },
+    { 0x1E, 0x00 },
+    { 0x24, 0x02 },
+    { 0x49, 0x02 },
+    { 0x60, 0x03 },
+    { 0x62, 0x02 },
+    { 0x88, 0x00 },
+    { 0x98, 0x01 },
+    { 0xE0, 0x00 },
+    { 0xF8, 0x0F },
+    { 0xFE, 0x07 },
+    { 0x00, 0x0B },
+    { 0x01, 0x04 },
+    { 0x01, 0x08 },
+    { 0x03, 0x02 },
+    { 0x04, 0x00 },
+    { 0x09, 0x02 },
+    { 0x0A, 0x02 },
+    { 0x0B, 0x02 },
+    { 0x30, 0x00 },
+    { 0x47, 0x00 },
+    { 0x4B, 0x02 },
+    { 0x60, 0x00 },
+    { 0x78, 0x02 },
+    { 0xC0, 0x01 },
+    { 0xC8, 0x03 },
+    { 0xD8, 0x00 },
+    { 0xDC, 0x01 },
+    { 0xE0, 0x03 },
+    { 0xFC, 0x00 },
+    { 0xFE, 0x00 },
+    { 0x00, 0x01 },
+    { 0x00, 0x06 },
+    { 0x00, 0x0F },
+    { 0x02, 0x04 },
+    { 0x07, 0x00 },
+    { 0x09, 0x00 },
+    { 0x0B, 0x00 },
+    { 0x0D, 0x00 },
+    { 0x1E, 0x02 },
+    { 0x32, 0x02 },
+    { 0x3C, 0x00 },
+    { 0x3E, 0x02 },
+    { 0x4D, 0x00 },
+    { 0x80, 0x03 },
+    { 0x8E, 0x03 },
+    { 0xB8, 0x03 },
+    { 0xCE, 0x03 },
+    { 0xDE, 0x03 },
+    { 0xDF, 0x00 },
+    { 0xE0, 0x01 },
+    { 0xF1, 0x03 },
+    { 0xF2, 0x03 },
+    { 0xF3, 0x01 },
+    { 0xF8, 0x09 },
+    { 0x00, 0x0D },
+    { 0x00, 0x0E },
+    { 0x02, 0x01 },
+    { 0x07, 0x07 },
+    { 0x08, 0x08 },
+    { 0x08, 0x09 },
+    { 0x0C, 0x01 },
+    { 0x0E, 0x07 },
+    { 0x10, 0x01 },
+    { 0x16, 0x02 },
+    { 0x1C, 0x02 },
+    { 0x1E, 0x03 },
+    { 0x3E, 0x0F },
+    { 0x40, 0x01 },
+    { 0x48, 0x00 },
+    { 0x52, 0x02 },
+    { 0x55, 0x02 },
+    { 0x62, 0x00 },
+    { 0x68, 0x02 },
+    { 0x7E, 0x00 },
+    { 0x7E, 0x03 },
+    { 0x7F, 0x00 },
+    { 0x82, 0x03 },
+    { 0x84, 0x01 },
+    { 0x86, 0x03 },
+    { 0x8A, 0x02 },
+    { 0x8F, 0x07 },
+    { 0x90, 0x00 },
+    { 0x99, 0x09 },
+    { 0x9C, 0x00 },
+    { 0x9F, 0x01 },
+    { 0xA2, 0x00 },
+    { 0xA8, 0x00 },
+    { 0xAA, 0x00 },
+    { 0xAC, 0x01 },
+    { 0xAE, 0x00 },
+    { 0xB0, 0x03 },
+    { 0xB4, 0x00 },
+    { 0xC0, 0x03 },
+    { 0xC2, 0x00 },
+    { 0xC2, 0x02 },
+    { 0xC2, 0x03 },
+    { 0xC4, 0x07 },
+    { 0xC6, 0x03 },
+    { 0xC8, 0x02 },
+    { 0xC9, 0x03 },
+    { 0xCC, 0x07 },
+    { 0xD8, 0x02 },
+    { 0xD8, 0x0F },
+    { 0xF2, 0x01 },
+    { 0xF8, 0x02 },
+    { 0xF8, 0x08 },
+    { 0xFE, 0x02 }
+};
+
+///
+/// @brief Offsets of the glyphs in the stream
+///
+static const uint16_t Terminal8x12c_offsets[225] =
+{
+    0, 0, 5, 12, 20, 31, 52, 70, 73, 78, 83, 91, 98, 102, 109, 113,
+    120, 129, 135, 144, 151, 161, 172, 179, 190, 197, 210, 214, 224, 231, 238, 245,
+    256, 271, 278, 285, 292, 299, 306, 313, 324, 331, 336, 343, 350, 357, 365, 373,
+    380, 387, 400, 409, 416, 423, 430, 437, 445, 454, 461, 470, 475, 486, 491, 498,
+    507, 511, 518, 525, 532, 539, 546, 553, 564, 571, 578, 588, 595, 602, 610, 617,
+    624, 631, 638, 647, 658, 665, 672, 679, 687, 694, 701, 716, 722, 725, 731, 740,
+    747, 756, 756, 759, 759, 765, 771, 778, 785, 785, 800, 800, 803, 812, 812, 812,
+    812, 812, 815, 818, 824, 830, 835, 840, 847, 854, 862, 862, 865, 865, 865, 865,
+    865, 865, 870, 877, 889, 896, 903, 906, 921, 928, 939, 950, 959, 966, 973, 986,
+    995, 1002, 1009, 1022, 1031, 1035, 1048, 1056, 1060, 1069, 1073, 1080, 1089, 1098, 1115, 1130,
+    1141, 1148, 1155, 1162, 1171, 1178, 1185, 1195, 1212, 1219, 1226, 1233, 1240, 1245, 1250, 1255,
+    1260, 1268, 1278, 1285, 1292, 1299, 1306, 1313, 1320, 1331, 1338, 1345, 1352, 1359, 1370, 1377,
+    1384, 1391, 1398, 1407, 1416, 1429, 1438, 1449, 1462, 1469, 1478, 1487, 1498, 1505, 1512, 1519,
+    1526, 1537, 1546, 1553, 1560, 1567, 1576, 1583, 1590, 1597, 1604, 1611, 1620, 1629, 1641, 1648,
+    1662
+};
+
+///
+/// @brief Stream of compressed glyphs
+///
+static const uint8_t Terminal8x12c[1662] =
+{
+    0x23, 0x32, 0x80, 0x80, 0x32, 0x15, 0x19, 0x19, 0x1B, 0x1B, 0x19, 0x19, 0x16, 0x3B, 0x00, 0x00,
+    0x3B, 0x00, 0x00, 0x3B, 0x15, 0x72, 0x77, 0xFF, 0x33, 0x0E, 0xFF, 0x63, 0x0E, 0x97, 0x83, 0x07,
+    0x22, 0xFF, 0x8F, 0x01, 0xFF, 0xC9, 0x00, 0xFF, 0x6F, 0x03, 0xFF, 0xB6, 0x07, 0xFF, 0x98, 0x04,
+    0xFF, 0x8C, 0x07, 0x17, 0x16, 0xFF, 0xEC, 0x01, 0x00, 0xFF, 0x12, 0x02, 0xFF, 0x5E, 0x02, 0xFF,
+    0xCC, 0x01, 0x92, 0xFF, 0x40, 0x02, 0x31, 0x19, 0x19, 0x23, 0x0C, 0x00, 0x6F, 0x41, 0x23, 0x41,
+    0x6F, 0x00, 0x0C, 0x16, 0x02, 0x8C, 0x0C, 0x0F, 0x0C, 0x8C, 0x02, 0x15, 0x02, 0x02, 0x0C, 0x0C,
+    0x02, 0x02, 0x32, 0x40, 0x56, 0x28, 0x15, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x32, 0x17, 0x17,
+    0x17, 0x15, 0x17, 0x92, 0x27, 0x5E, 0x31, 0x1F, 0x25, 0x05, 0x00, 0x94, 0xFF, 0x1A, 0x02, 0x00,
+    0x05, 0x14, 0x15, 0x15, 0x30, 0x00, 0x00, 0x15, 0xFF, 0x0C, 0x03, 0x62, 0x94, 0x3A, 0x5F, 0x76,
+    0x15, 0x34, 0x62, 0x14, 0x14, 0x00, 0x50, 0x16, 0xFF, 0xC0, 0x00, 0x53, 0x35, 0x26, 0x01, 0x01,
+    0x26, 0x15, 0x5F, 0x5F, 0x14, 0xFF, 0x22, 0x03, 0xFF, 0xE2, 0x01, 0x93, 0x15, 0x0A, 0x01, 0x5C,
+    0x75, 0x69, 0x67, 0x15, 0x0B, 0x82, 0xFF, 0xE2, 0x03, 0xFF, 0x7A, 0x00, 0x36, 0x22, 0x15, 0x50,
+    0x00, 0x5D, 0x3A, 0x00, 0x50, 0x15, 0x5E, 0xFF, 0x7E, 0x02, 0xFF, 0x42, 0x03, 0x95, 0x53, 0xFF,
+    0x7C, 0x00, 0x32, 0x24, 0x24, 0x24, 0x32, 0xFF, 0x18, 0x0B, 0xFF, 0x18, 0x0F, 0xFF, 0x18, 0x07,
+    0x15, 0x02, 0x0F, 0x4F, 0x34, 0x20, 0x08, 0x15, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x15, 0x08,
+    0x20, 0x34, 0x4F, 0x0F, 0x02, 0x15, 0x30, 0x19, 0xFF, 0x62, 0x03, 0xFF, 0x72, 0x03, 0x36, 0x30,
+    0x07, 0x05, 0x00, 0x08, 0x3A, 0xFF, 0xF2, 0x02, 0xFF, 0x92, 0x02, 0xA0, 0xFF, 0xFC, 0x02, 0x15,
+    0x01, 0x06, 0x33, 0x33, 0x06, 0x01, 0x15, 0x00, 0x00, 0x14, 0x14, 0x00, 0x50, 0x15, 0x05, 0x00,
+    0x08, 0x08, 0x62, 0x34, 0x15, 0x00, 0x00, 0x08, 0x20, 0x05, 0x0C, 0x15, 0x00, 0x00, 0x14, 0x14,
+    0x14, 0x08, 0x15, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x0B, 0x15, 0x05, 0x00, 0x08, 0xFF, 0x42, 0x02,
+    0x64, 0xFF, 0xCC, 0x03, 0x15, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x23, 0x08, 0x00, 0x00, 0x08,
+    0x15, 0x2D, 0x61, 0x03, 0x03, 0x00, 0x2E, 0x15, 0x00, 0x00, 0x02, 0x0C, 0x65, 0x20, 0x15, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x00, 0x15, 0x0F, 0x15, 0x00, 0x00, 0x16, 0x00, 0x00,
+    0x23, 0x48, 0x4B, 0x00, 0x00, 0x15, 0x05, 0x00, 0x08, 0x08, 0x00, 0x05, 0x15, 0x00, 0x00, 0x1D,
+    0x1D, 0x2A, 0x32, 0x15, 0x05, 0x00, 0x08, 0xFF, 0x02, 0x06, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x09,
+    0x15, 0x00, 0x00, 0x1D, 0x7D, 0x00, 0xFF, 0x9C, 0x03, 0x15, 0x72, 0x77, 0x5D, 0x3A, 0x97, 0x83,
+    0x15, 0x0B, 0x0B, 0x00, 0x00, 0x0B, 0x0B, 0x15, 0x2E, 0x00, 0x03, 0x03, 0x00, 0x2E, 0x15, 0x53,
+    0x2E, 0x17, 0x17, 0x2E, 0x53, 0x16, 0x7F, 0x00, 0x61, 0x0F, 0x61, 0x00, 0x7F, 0x15, 0x84, 0x64,
+    0xFF, 0x38, 0x00, 0x0F, 0x64, 0x84, 0x15, 0x36, 0x2A, 0x51, 0x51, 0x2A, 0x36, 0x15, 0x82, 0x95,
+    0x3A, 0x5D, 0x5C, 0xFF, 0x0E, 0x02, 0x23, 0x1E, 0x1E, 0x42, 0x42, 0x15, 0x22, 0x36, 0xFF, 0x78,
+    0x00, 0x67, 0xFF, 0x80, 0x07, 0x55, 0x23, 0x42, 0x42, 0x1E, 0x1E, 0x15, 0x0B, 0x1F, 0x0E, 0x0E,
+    0x1F, 0x0B, 0x07, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x32, 0x0E, 0x1F, 0x0B, 0x15,
+    0x2D, 0x4E, 0x16, 0x16, 0x01, 0x10, 0x15, 0x00, 0x00, 0x09, 0x09, 0x01, 0x0A, 0x15, 0x0A, 0x01,
+    0x09, 0x09, 0x24, 0x74, 0x15, 0x0A, 0x01, 0x09, 0x09, 0x00, 0x00, 0x15, 0x0A, 0x01, 0x16, 0x16,
+    0x4C, 0x0F, 0x15, 0x02, 0x06, 0x00, 0x1D, 0x1D, 0x1D, 0x15, 0xFF, 0xF0, 0x08, 0x6B, 0x71, 0x71,
+    0x3E, 0xFF, 0xF8, 0x07, 0x15, 0x00, 0x00, 0x15, 0x15, 0x01, 0x10, 0x15, 0x09, 0x09, 0x12, 0x12,
+    0x03, 0x03, 0x14, 0x13, 0x70, 0x70, 0xFF, 0xFB, 0x0F, 0xFF, 0xFB, 0x07, 0x15, 0x00, 0x00, 0x1A,
+    0x3D, 0x63, 0x24, 0x15, 0x08, 0x08, 0x00, 0x00, 0x03, 0x03, 0x16, 0x01, 0x01, 0x15, 0x07, 0x15,
+    0x01, 0x10, 0x15, 0x01, 0x01, 0x15, 0x15, 0x01, 0x10, 0x15, 0x0A, 0x01, 0x09, 0x09, 0x01, 0x0A,
+    0x15, 0x3E, 0x3E, 0x2F, 0x2F, 0x07, 0x27, 0x15, 0x27, 0x07, 0x2F, 0x2F, 0x3E, 0x3E, 0x15, 0x01,
+    0x01, 0x02, 0xFF, 0x10, 0x00, 0x23, 0x23, 0x15, 0xFF, 0x30, 0x02, 0x4C, 0x16, 0x16, 0x4E, 0xFF,
+    0x88, 0x01, 0x15, 0x15, 0x2E, 0x00, 0x09, 0x09, 0x09, 0x15, 0x07, 0x01, 0x03, 0x03, 0x01, 0x01,
+    0x15, 0x0C, 0x07, 0x17, 0x17, 0x07, 0x0C, 0x16, 0x0C, 0x01, 0x17, 0x27, 0x17, 0x01, 0x0C, 0x15,
+    0x24, 0x63, 0x3D, 0x3D, 0x63, 0x24, 0x15, 0x9F, 0x6B, 0x6C, 0x56, 0x01, 0x0C, 0x15, 0xFF, 0x08,
+    0x03, 0xFF, 0x88, 0x03, 0x98, 0x7E, 0xFF, 0x38, 0x02, 0xFF, 0x18, 0x02, 0x14, 0x02, 0x0F, 0x65,
+    0x86, 0x41, 0x31, 0x1E, 0x1E, 0x24, 0x41, 0x86, 0x65, 0x0F, 0x02, 0x07, 0x30, 0x22, 0x0B, 0x22,
+    0x30, 0x15, 0x30, 0x22, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2C, 0x05, 0x00, 0x7B,
+    0x08, 0xFF, 0x04, 0x01, 0x31, 0x40, 0x28, 0x24, 0x40, 0x28, 0x1B, 0x40, 0x28, 0x24, 0x03, 0x1B,
+    0x03, 0x1B, 0x03, 0x15, 0x23, 0x23, 0x3F, 0x3F, 0x23, 0x23, 0x15, 0x3C, 0x3C, 0x3F, 0x3F, 0x3C,
+    0x3C, 0x15, 0x19, 0xFF, 0x0A, 0x06, 0xFF, 0x8E, 0x01, 0xFF, 0x60, 0x04, 0x23, 0xFF, 0x06, 0x04,
+    0x21, 0x26, 0x79, 0x15, 0x06, 0x57, 0x57, 0x3F, 0xFF, 0x22, 0x04, 0x57, 0x31, 0x19, 0x5B, 0x31,
+    0x5A, 0x58, 0x24, 0x19, 0x5B, 0x1B, 0x19, 0x5B, 0x24, 0x5A, 0x58, 0x1B, 0x5A, 0x58, 0x23, 0x4B,
+    0x27, 0x27, 0x4B, 0x23, 0x1A, 0x1A, 0x1A, 0x1A, 0x15, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x15,
+    0x44, 0x0B, 0x0B, 0x44, 0x44, 0x0B, 0x16, 0x0E, 0x31, 0x0E, 0x1B, 0x31, 0x0B, 0x31, 0x31, 0x79,
+    0x26, 0x23, 0x28, 0x9C, 0x9C, 0x28, 0x15, 0x27, 0x07, 0x73, 0x73, 0x3C, 0x87, 0x06, 0xFF, 0x20,
+    0x03, 0x06, 0xA0, 0x14, 0x14, 0xFF, 0x26, 0x02, 0x1C, 0x15, 0x91, 0x52, 0x7A, 0x7A, 0x52, 0x91,
+    0x15, 0x8F, 0x35, 0x10, 0x10, 0x35, 0x8F, 0x31, 0x78, 0x78, 0x15, 0xFF, 0x66, 0x04, 0xFF, 0xFF,
+    0x0C, 0x88, 0x88, 0xFF, 0xF3, 0x0F, 0xFF, 0x62, 0x06, 0x15, 0x1F, 0x1F, 0x1B, 0x1B, 0x1F, 0x1F,
+    0x07, 0x05, 0x20, 0xFF, 0x72, 0x02, 0x85, 0x85, 0x7B, 0x20, 0x05, 0x15, 0x87, 0xFF, 0xBA, 0x00,
+    0x8D, 0x8D, 0x35, 0xFF, 0xBC, 0x00, 0x07, 0x26, 0x4D, 0x39, 0x25, 0x26, 0x4D, 0x39, 0x25, 0x15,
+    0x02, 0x02, 0x02, 0x02, 0x3D, 0x3D, 0x15, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x05, 0x20,
+    0xFF, 0xFA, 0x02, 0x2B, 0x2B, 0xFF, 0xB2, 0x02, 0x20, 0x05, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x15, 0x22, 0x31, 0x59, 0x59, 0x31, 0x22, 0x15, 0x25, 0x25, 0x9E, 0x9E, 0x25,
+    0x25, 0x23, 0xFF, 0x32, 0x00, 0xFF, 0x3A, 0x00, 0xFF, 0x2E, 0x00, 0xFF, 0x24, 0x00, 0x23, 0x1D,
+    0xFF, 0x2A, 0x00, 0x2A, 0xFF, 0x14, 0x00, 0x22, 0x0B, 0x1F, 0x0E, 0x07, 0x13, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xFC, 0x07, 0x54, 0x54, 0x52, 0x05, 0x54, 0x16, 0x32, 0x2A, 0x81, 0x81, 0x1E, 0x1E, 0x0E,
+    0x32, 0x48, 0x48, 0x48, 0x23, 0x13, 0xFF, 0x00, 0x0A, 0x6D, 0xFF, 0x00, 0x04, 0x22, 0x44, 0x2A,
+    0x2A, 0x15, 0x89, 0x35, 0x8B, 0x8B, 0x35, 0x89, 0x07, 0x25, 0x39, 0x4D, 0x26, 0x25, 0x39, 0x4D,
+    0x26, 0x07, 0x6E, 0x8A, 0x66, 0x39, 0x90, 0x9B, 0x9A, 0x96, 0x07, 0x6E, 0x8A, 0x66, 0x4B, 0xFF,
+    0x70, 0x06, 0xFF, 0x58, 0x07, 0xFF, 0xCC, 0x05, 0xFF, 0x84, 0x04, 0x07, 0xFF, 0x11, 0x01, 0xFF,
+    0x95, 0x01, 0x66, 0xFF, 0x6A, 0x03, 0x90, 0x9B, 0x9A, 0x96, 0x15, 0x55, 0x56, 0xFF, 0xD8, 0x09,
+    0xFF, 0xD8, 0x08, 0x6D, 0x55, 0x15, 0x01, 0x04, 0x49, 0x33, 0x06, 0x01, 0x15, 0x01, 0x06, 0x33,
+    0x49, 0x04, 0x01, 0x15, 0x01, 0x04, 0x49, 0x49, 0x04, 0x01, 0x15, 0x69, 0x11, 0x60, 0xFF, 0x4E,
+    0x00, 0x0D, 0x68, 0x15, 0x01, 0x04, 0x33, 0x33, 0x04, 0x01, 0x15, 0x10, 0x0D, 0x60, 0x60, 0x0D,
+    0x10, 0x16, 0x10, 0x01, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x14, 0x14, 0x15, 0x52, 0xFF, 0xFE, 0x09,
+    0xFF, 0x02, 0x0B, 0xFF, 0x02, 0x0F, 0xFF, 0xCE, 0x05, 0xFF, 0xCC, 0x00, 0x15, 0x06, 0x04, 0x29,
+    0x37, 0x37, 0x1C, 0x15, 0x06, 0x06, 0x37, 0x29, 0x29, 0x1C, 0x15, 0x06, 0x04, 0x29, 0x29, 0x29,
+    0x1C, 0x15, 0x06, 0x04, 0x37, 0x37, 0x29, 0x1C, 0x23, 0x21, 0x04, 0x06, 0x03, 0x23, 0x1C, 0x06,
+    0x04, 0x18, 0x23, 0x18, 0x04, 0x04, 0x18, 0x23, 0x18, 0x06, 0x06, 0x18, 0x06, 0x02, 0x00, 0x00,
+    0x14, 0x20, 0x05, 0x0C, 0x16, 0x0D, 0x11, 0xFF, 0x31, 0x00, 0x7D, 0x93, 0x11, 0x01, 0x15, 0x07,
+    0x04, 0x18, 0x1C, 0x06, 0x07, 0x15, 0x07, 0x06, 0x1C, 0x18, 0x04, 0x07, 0x15, 0x07, 0x04, 0x18,
+    0x18, 0x04, 0x07, 0x15, 0x07, 0x04, 0x18, 0x18, 0x04, 0x07, 0x15, 0x07, 0x04, 0x1C, 0x1C, 0x04,
+    0x07, 0x15, 0x34, 0x4F, 0x0F, 0x0F, 0x4F, 0x34, 0x15, 0x06, 0x00, 0xFF, 0xE2, 0x02, 0xFF, 0x3A,
+    0x02, 0x00, 0x2E, 0x15, 0x05, 0x04, 0x21, 0x03, 0x06, 0x05, 0x15, 0x05, 0x06, 0x03, 0x21, 0x04,
+    0x05, 0x15, 0x05, 0x04, 0x21, 0x21, 0x04, 0x05, 0x15, 0x05, 0x04, 0x03, 0x03, 0x04, 0x05, 0x15,
+    0x32, 0x5E, 0x51, 0xFF, 0xE1, 0x03, 0xFF, 0x3D, 0x00, 0x32, 0x15, 0x00, 0x00, 0x3B, 0x3B, 0x0C,
+    0x0F, 0x15, 0x06, 0x00, 0x0B, 0x5C, 0x06, 0x67, 0x15, 0x2D, 0x99, 0x4A, 0x2B, 0x01, 0x10, 0x15,
+    0x2D, 0x4E, 0x2B, 0x4A, 0x11, 0x10, 0x15, 0x2D, 0xFF, 0xCA, 0x03, 0x38, 0x38, 0x0D, 0x10, 0x15,
+    0xFF, 0x82, 0x01, 0x99, 0x38, 0x2B, 0x0D, 0x68, 0x15, 0xFF, 0x83, 0x01, 0xFF, 0xCB, 0x03, 0x16,
+    0x16, 0x12, 0xFF, 0xF3, 0x03, 0x15, 0x2D, 0xFF, 0xD2, 0x03, 0x7C, 0x7C, 0x69, 0x51, 0x07, 0x2D,
+    0x4E, 0x16, 0x10, 0x07, 0x16, 0x4C, 0xFF, 0x70, 0x02, 0x15, 0x0A, 0xFF, 0xF8, 0x0B, 0xFF, 0x08,
+    0x0A, 0xFF, 0x08, 0x0E, 0x24, 0x74, 0x15, 0x0A, 0x11, 0x4A, 0x2B, 0x4C, 0x0F, 0x15, 0x0A, 0x01,
+    0x2B, 0x4A, 0xFF, 0x79, 0x02, 0x0F, 0x15, 0x0A, 0x0D, 0x38, 0x38, 0xFF, 0x7A, 0x02, 0x0F, 0x15,
+    0x6A, 0x12, 0x16, 0x16, 0xFF, 0x7B, 0x02, 0xFF, 0x73, 0x00, 0x15, 0x09, 0x45, 0x12, 0x0D, 0x03,
+    0x03, 0x15, 0x09, 0x09, 0x0D, 0x12, 0x21, 0x03, 0x15, 0x09, 0x46, 0x11, 0x11, 0x08, 0x03, 0x15,
+    0x47, 0x47, 0x01, 0x01, 0x43, 0x43, 0x15, 0xFF, 0xE8, 0x01, 0xFF, 0xEA, 0x03, 0x75, 0x76, 0x0D,
+    0x9D, 0x15, 0x0D, 0x11, 0x59, 0xFF, 0x0A, 0x00, 0x0D, 0x68, 0x15, 0x0A, 0x11, 0x47, 0x46, 0x01,
+    0x0A, 0x15, 0x0A, 0x01, 0x46, 0x47, 0x11, 0x0A, 0x15, 0x0A, 0x0D, 0x45, 0x45, 0x0D, 0x0A, 0x15,
+    0x9D, 0x11, 0x45, 0x46, 0x0D, 0xFF, 0xF1, 0x01, 0x15, 0x6A, 0x12, 0x09, 0x09, 0x12, 0x6A, 0x15,
+    0x02, 0x02, 0x8E, 0x8E, 0x02, 0x02, 0x15, 0x10, 0x01, 0x98, 0x7E, 0x01, 0x07, 0x15, 0x07, 0x11,
+    0x43, 0x08, 0x01, 0x01, 0x15, 0x07, 0x01, 0x08, 0x43, 0x11, 0x01, 0x15, 0xFF, 0xFA, 0x01, 0x12,
+    0x21, 0x21, 0x12, 0x0D, 0x15, 0xFF, 0xFB, 0x01, 0x12, 0x03, 0x03, 0x12, 0x12, 0x06, 0x13, 0x9F,
+    0x6B, 0xFF, 0x02, 0x0D, 0xFF, 0x03, 0x07, 0x11, 0x0C, 0x15, 0x1E, 0x1E, 0x2F, 0x2F, 0x07, 0x27,
+    0x06, 0x13, 0xFF, 0xFB, 0x08, 0xFF, 0xFB, 0x09, 0x6C, 0x28, 0x12, 0xFF, 0xFB, 0x00
+};
+
+#endif // TERMINAL8C_FONT_RELEASE
@@ -15,21 +15,69 @@
 // Release 801: Improved double-panel screen management
 // Release 804: Improved power management
 // Release 810: Added support for EXT4
+// Release 821: Added non-blocking busy check and shared SPI bus owner
+// Release 821: Added command scripts
+// Release 821: Added SPI speed per family
+// Release 821: Added timing profile
+// Release 821: Added commands to both halves of large screens
+// Release 821: Added warm resume with GPIO configured once
+// Release 821: Added suspend of the SPI bus
 //
 
 // Library header
 #include "hV_Board.h"
 
+// Owners of the shared SPI bus used by the boards, one bit per owner
+static uint8_t boardBusOwners = 0b00000000;
+
 hV_Board::hV_Board()
 {
     b_fsmPowerScreen = FSM_OFF;
+
+    // One owner per board, for shared SPI bus, from SPI_OWNER_SCREEN
+    b_busOwner = SPI_OWNER_NONE; // More boards than owners, the bus is never released
+    for (uint8_t owner = SPI_OWNER_SCREEN; owner <= SPI_OWNER_MAX; owner += 1)
+    {
+        if (bitRead(boardBusOwners, owner) == 0)
+        {
+            bitSet(boardBusOwners, owner);
+            b_busOwner = owner;
+            break;
+        }
+    }
 }
 
-void hV_Board::b_begin(pins_t board, uint8_t family, uint16_t delayCS)
+hV_Board::~hV_Board()
+{
+    if (b_busOwner <= SPI_OWNER_MAX)
+    {
+        bitClear(boardBusOwners, b_busOwner);
+    }
+}
+
+void hV_Board::b_begin(pins_t board, uint8_t family)
 {
     b_pin = board;
     b_family = family;
-    b_delayCS = delayCS;
+
+    switch (b_family)
+    {
+        case FAMILY_MEDIUM:
+
+            b_timing = timingMedium;
+            break;
+
+        case FAMILY_LARGE:
+
+            b_timing = timingLarge;
+            break;
+
+        default:
+
+            b_timing = timingSmall;
+            break;
+    }
+    b_speedSPI = SPI_SPEED_DEFAULT;
     b_fsmPowerScreen = FSM_OFF;
 }
 
@@ -38,17 +86,36 @@ void hV_Board::setPanelPowerPin(uint8_t panelPowerPin)
     b_pin.panelPower = panelPowerPin;
 }
 
-void hV_Board::b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, uint32_t ms5)
+void hV_Board::setTiming(timing_s timing)
+{
+    b_timing = timing;
+}
+
+timing_s hV_Board::getTiming()
 {
-    delay(ms1); // Wait for power stabilisation
+    return b_timing;
+}
+
+uint32_t hV_Board::b_reset()
+{
+    uint32_t chrono = micros();
+
+    // Wait for power stabilisation, only what is left since power on
+    uint32_t elapsed = millis() - b_chronoPower;
+    if (elapsed < b_timing.resetPower)
+    {
+        delay(b_timing.resetPower - elapsed);
+    }
     digitalWrite(b_pin.panelReset, HIGH); // RESET = HIGH
-    delay(ms2);
+    delay(b_timing.resetHigh);
     digitalWrite(b_pin.panelReset, LOW); // RESET = LOW
-    delay(ms3);
+    delay(b_timing.resetLow);
     digitalWrite(b_pin.panelReset, HIGH); // RESET = HIGH
-    delay(ms4);
+    delay(b_timing.resetReady);
     digitalWrite(b_pin.panelCS, HIGH); // CS = HIGH, unselect
-    delay(ms5);
+    delay(b_timing.resetSelect);
+
+    return micros() - chrono;
 }
 
 void hV_Board::b_waitBusy(bool state)
@@ -56,28 +123,50 @@ void hV_Board::b_waitBusy(bool state)
     // LOW = busy, HIGH = ready
     while (digitalRead(b_pin.panelBusy) != state)
     {
-        delay(32); // non-blocking
+        delay(32); // Blocking, between two polls
     }
 }
 
+bool hV_Board::b_checkBusy(bool state)
+{
+    // LOW = busy, HIGH = ready
+    return (digitalRead(b_pin.panelBusy) != state);
+}
+
 void hV_Board::b_suspend()
 {
-    if ((b_fsmPowerScreen & FSM_GPIO_MASK) == FSM_GPIO_MASK)
+    // Only what is actually powered off
+    if (((b_fsmPowerScreen & FSM_GPIO_MASK) == FSM_GPIO_MASK) and (b_pin.panelPower != NOT_CONNECTED))
     {
         // Optional power circuit
-        if (b_pin.panelPower != NOT_CONNECTED) // generic
+        digitalWrite(b_pin.panelPower, LOW);
+        b_fsmPowerScreen &= ~FSM_GPIO_MASK;
+    }
+}
+
+void hV_Board::b_suspendBus()
+{
+    if ((b_fsmPowerScreen & FSM_BUS_MASK) == FSM_BUS_MASK)
+    {
+        // Flash and SD-card libraries do not register on the bus, so the bus is kept on
+        if ((b_pin.flashCS != NOT_CONNECTED) or (b_pin.cardCS != NOT_CONNECTED) or (b_busOwner == SPI_OWNER_NONE))
         {
-            digitalWrite(b_pin.panelPower, LOW);
+            return;
         }
-        b_fsmPowerScreen &= ~FSM_GPIO_MASK;
+
+        // Bus ended and pins parked only when no other owner is registered
+        hV_HAL_SPI_end(b_busOwner);
+        hV_HAL_SPI_park();
+
+        b_fsmPowerScreen &= ~FSM_BUS_MASK;
     }
 }
 
 void hV_Board::b_resume()
 {
-    // Target FSM_ON
-    // Source FSM_SLEEP -> FSM_SLEEP
-    //        FSM_OFF   -> FSM_SLEEP
+    // Target FSM_GPIO_MASK and FSM_CONFIG_MASK
+    // Source FSM_OFF         -> power on and configure GPIOs
+    //        FSM_CONFIG_MASK -> power on only, after b_suspend()
 
     if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
     {
@@ -87,7 +176,12 @@ void hV_Board::b_resume()
             pinMode(b_pin.panelPower, OUTPUT);
             digitalWrite(b_pin.panelPower, HIGH);
         }
+        b_chronoPower = millis(); // Start of power stabilisation
+        b_fsmPowerScreen |= FSM_GPIO_MASK;
+    }
 
+    if ((b_fsmPowerScreen & FSM_CONFIG_MASK) != FSM_CONFIG_MASK)
+    {
         // Configure GPIOs
         pinMode(b_pin.panelBusy, INPUT);
 
@@ -163,7 +257,7 @@ void hV_Board::b_resume()
 
 #endif // USE_EXT_BOARD
 
-        b_fsmPowerScreen |= FSM_GPIO_MASK;
+        b_fsmPowerScreen |= FSM_CONFIG_MASK;
     }
 }
 
@@ -172,18 +266,18 @@ void hV_Board::b_sendIndexFixed(uint8_t index, uint8_t data, uint32_t size)
     digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
     digitalWrite(b_pin.panelCS, LOW); // CS High = Select Master
 
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
     hV_HAL_SPI_transfer(index);
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
 
     digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
 
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
     for (uint32_t i = 0; i < size; i++)
     {
         hV_HAL_SPI_transfer(data); // b_sendIndexFixed
     }
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
 
     digitalWrite(b_pin.panelCS, HIGH); // CS High = Unselect
 }
@@ -193,18 +287,18 @@ void hV_Board::b_sendIndexFixedSelect(uint8_t index, uint8_t data, uint32_t size
     digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
     b_select(select); // Select half of large screen
 
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
     hV_HAL_SPI_transfer(index);
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
 
     digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
 
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
     for (uint32_t i = 0; i < size; i++)
     {
         hV_HAL_SPI_transfer(data); // b_sendIndexFixed
     }
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
 
     digitalWrite(b_pin.panelCS, HIGH); // CS High = Unselect Master
     if (b_pin.panelCSS != NOT_CONNECTED)
@@ -215,54 +309,34 @@ void hV_Board::b_sendIndexFixedSelect(uint8_t index, uint8_t data, uint32_t size
 
 void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
 {
+    // Large screens, /CSS kept low for the index and the data, so one setup per call
+    bool flagCSS = (b_family == FAMILY_LARGE) and (b_pin.panelCSS != NOT_CONNECTED);
+
     digitalWrite(b_pin.panelDC, LOW); // DC Low
     digitalWrite(b_pin.panelCS, LOW); // CS Low
-    if (b_family == FAMILY_LARGE)
+    if (flagCSS)
     {
-        if (b_pin.panelCSS != NOT_CONNECTED)
-        {
-            digitalWrite(b_pin.panelCSS, LOW);
-        }
-        delayMicroseconds(450); // 450 + 50 = 500
+        digitalWrite(b_pin.panelCSS, LOW); // CSS Low
+        delayMicroseconds(b_timing.setupCSS); // /CSS, 450 + 50 = 500 by default
     }
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
     hV_HAL_SPI_transfer(index);
-    delayMicroseconds(b_delayCS);
-    if (b_family == FAMILY_LARGE)
-    {
-        if (b_pin.panelCSS != NOT_CONNECTED)
-        {
-            delayMicroseconds(450); // 450 + 50 = 500
-            digitalWrite(b_pin.panelCSS, HIGH);
-        }
-    }
+    delayMicroseconds(b_timing.setupCS);
     digitalWrite(b_pin.panelCS, HIGH); // CS High
     digitalWrite(b_pin.panelDC, HIGH); // DC High
     digitalWrite(b_pin.panelCS, LOW); // CS Low
-    if (b_family == FAMILY_LARGE)
-    {
-        if (b_pin.panelCSS != NOT_CONNECTED)
-        {
-            digitalWrite(b_pin.panelCSS, LOW); // CSS Low
-            delayMicroseconds(450); // 450 + 50 = 500
-        }
-    }
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
     for (uint32_t i = 0; i < size; i++)
     {
         hV_HAL_SPI_transfer(data[i]);
     }
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
     digitalWrite(b_pin.panelCS, HIGH); // CS High
-    if (b_family == FAMILY_LARGE)
+    if (flagCSS)
     {
-        if (b_pin.panelCSS != NOT_CONNECTED)
-        {
-            delayMicroseconds(450); // 450 + 50 = 500
-            digitalWrite(b_pin.panelCSS, HIGH);
-        }
+        digitalWrite(b_pin.panelCSS, HIGH); // CSS High
     }
-    delayMicroseconds(b_delayCS);
+    delayMicroseconds(b_timing.setupCS);
 }
 
 // Software SPI Master protocol setup
@@ -271,18 +345,18 @@ void hV_Board::b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32
     digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
     b_select(select); // Select half of large screen
 
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
     hV_HAL_SPI_transfer(index);
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
 
     digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
 
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
     for (uint32_t i = 0; i < size; i++)
     {
         hV_HAL_SPI_transfer(data[i]);
     }
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
 
     digitalWrite(b_pin.panelCS, HIGH); // CS high = Unselect Master
     if (b_pin.panelCSS != NOT_CONNECTED)
@@ -323,11 +397,12 @@ void hV_Board::b_select(uint8_t select)
             break;
     }
 
-    if (b_pin.panelCSS != NOT_CONNECTED)
+    // Setup of /CSS only when it goes low, not when only panelCS changes
+    if ((b_pin.panelCSS != NOT_CONNECTED) and (select != PANEL_CS_MASTER))
     {
-        delayMicroseconds(450); // 450 + 50 = 500
+        delayMicroseconds(b_timing.setupCSS); // /CSS, 450 + 50 = 500 by default
     }
-    delayMicroseconds(b_delayCS); // Longer delay for large screens
+    delayMicroseconds(b_timing.setupCS); // Longer delay for large screens
 }
 
 void hV_Board::b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t select)
@@ -345,20 +420,47 @@ void hV_Board::b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t s
     {
         digitalWrite(b_pin.panelCSS, HIGH);
     }
+
+    if (b_timing.gapCommand > 0)
+    {
+        delayMicroseconds(b_timing.gapCommand);
+    }
 }
 
 void hV_Board::b_sendCommand8(uint8_t command)
 {
     digitalWrite(b_pin.panelDC, LOW);
-    digitalWrite(b_pin.panelCS, LOW);
+    if (b_family == FAMILY_LARGE)
+    {
+        b_select(PANEL_CS_BOTH); // Both halves of large screen
+    }
+    else
+    {
+        digitalWrite(b_pin.panelCS, LOW);
+    }
 
     hV_HAL_SPI_transfer(command);
 
     digitalWrite(b_pin.panelCS, HIGH);
+    if ((b_family == FAMILY_LARGE) and (b_pin.panelCSS != NOT_CONNECTED))
+    {
+        digitalWrite(b_pin.panelCSS, HIGH);
+    }
+
+    if (b_timing.gapCommand > 0)
+    {
+        delayMicroseconds(b_timing.gapCommand);
+    }
 }
 
 void hV_Board::b_sendCommandData8(uint8_t command, uint8_t data)
 {
+    if (b_family == FAMILY_LARGE)
+    {
+        b_sendCommandDataSelect8(command, data, PANEL_CS_BOTH); // Both halves of large screen
+        return;
+    }
+
     digitalWrite(b_pin.panelDC, LOW); // LOW = command
     digitalWrite(b_pin.panelCS, LOW);
 
@@ -368,7 +470,165 @@ void hV_Board::b_sendCommandData8(uint8_t command, uint8_t data)
     hV_HAL_SPI_transfer(data);
 
     digitalWrite(b_pin.panelCS, HIGH);
+
+    if (b_timing.gapCommand > 0)
+    {
+        delayMicroseconds(b_timing.gapCommand);
+    }
+}
+
+//
+// === SPI speed section
+//
+uint32_t hV_Board::setSpeedSPI(uint32_t speed)
+{
+    uint32_t speedMax = SPI_SPEED_MAX_SMALL;
+    switch (b_family)
+    {
+        case FAMILY_MEDIUM:
+
+            speedMax = SPI_SPEED_MAX_MEDIUM;
+            break;
+
+        case FAMILY_LARGE:
+
+            speedMax = SPI_SPEED_MAX_LARGE;
+            break;
+
+        default:
+
+            speedMax = SPI_SPEED_MAX_SMALL;
+            break;
+    }
+
+    b_speedSPI = hV_HAL_min(speed, speedMax);
+    b_applySpeedSPI();
+    return b_speedSPI;
+}
+
+uint32_t hV_Board::getSpeedSPI()
+{
+    return b_speedSPI;
+}
+
+void hV_Board::b_applySpeedSPI()
+{
+    if (hV_HAL_SPI_getSpeed() != b_speedSPI)
+    {
+        hV_HAL_SPI_setSpeed(b_speedSPI);
+    }
+}
+//
+// === End of SPI speed section
+//
+
+//
+// === Script section
+//
+void hV_Board::b_runScript(const uint8_t * script, const uint8_t * reference, const uint8_t * values)
+{
+    bool flagBurst = false;
+    bool flagSelected = false; // panelCS low
+    uint16_t index = 0;
+
+    while (script[index] != SCRIPT_END)
+    {
+        const uint8_t * data = 0;
+        uint8_t number = 0;
+        uint8_t command = script[index + 1];
+
+        switch (script[index])
+        {
+            case SCRIPT_COMMAND:
+
+                number = script[index + 2];
+                data = script + index + 3;
+                index += 3 + number;
+                break;
+
+            case SCRIPT_COMMAND_OTP:
+
+                number = script[index + 2];
+                data = reference + script[index + 3];
+                index += 4;
+                break;
+
+            case SCRIPT_COMMAND_VALUE:
+
+                number = 1;
+                data = values + script[index + 2];
+                index += 3;
+                break;
+
+            case SCRIPT_DELAY:
+
+                delay(script[index + 1]);
+                index += 2;
+                continue;
+
+            case SCRIPT_WAIT_BUSY:
+
+                b_waitBusy(script[index + 1]);
+                index += 2;
+                continue;
+
+            case SCRIPT_BURST:
+
+                flagBurst = (script[index + 1] > 0);
+                index += 2;
+                continue;
+
+            default: // Unknown opcode, flagSelected is false
+
+                return;
+        }
+
+        // Command, same as b_sendCommandData8()
+        digitalWrite(b_pin.panelDC, LOW); // LOW = command
+        if (not flagSelected)
+        {
+            if (b_family == FAMILY_LARGE)
+            {
+                b_select(PANEL_CS_BOTH); // Both halves of large screen, one /CSS setup per burst
+            }
+            else
+            {
+                digitalWrite(b_pin.panelCS, LOW);
+            }
+        }
+
+        hV_HAL_SPI_transfer(command);
+
+        if (number > 0)
+        {
+            digitalWrite(b_pin.panelDC, HIGH); // HIGH = data
+            for (uint8_t i = 0; i < number; i += 1)
+            {
+                hV_HAL_SPI_transfer(data[i]);
+            }
+        }
+
+        // Keep panelCS low only when the next opcode is a command
+        uint8_t next = script[index];
+        flagSelected = flagBurst and ((next == SCRIPT_COMMAND) or (next == SCRIPT_COMMAND_OTP) or (next == SCRIPT_COMMAND_VALUE));
+        if (not flagSelected)
+        {
+            digitalWrite(b_pin.panelCS, HIGH);
+            if ((b_family == FAMILY_LARGE) and (b_pin.panelCSS != NOT_CONNECTED))
+            {
+                digitalWrite(b_pin.panelCSS, HIGH);
+            }
+        }
+
+        if (b_timing.gapCommand > 0)
+        {
+            delayMicroseconds(b_timing.gapCommand);
+        }
+    }
 }
+//
+// === End of Script section
+//
 
 //
 // === Miscellaneous section
@@ -46,6 +46,65 @@
 ///
 #define hV_BOARD_RELEASE 812
 
+///
+/// @name Command script opcodes
+/// @details A script is a sequence of opcodes with their parameters, ended by SCRIPT_END
+/// @note Numbers are sequential and exclusive
+/// @{
+#define SCRIPT_END 0x00 ///< End of script
+#define SCRIPT_COMMAND 0x01 ///< Command, then command, number of bytes and bytes of data
+#define SCRIPT_COMMAND_OTP 0x02 ///< Command with data from reference, then command, number of bytes and offset
+#define SCRIPT_COMMAND_VALUE 0x03 ///< Command with one byte from values, then command and index
+#define SCRIPT_DELAY 0x04 ///< Delay, then duration in ms
+#define SCRIPT_WAIT_BUSY 0x05 ///< Wait for ready, then state HIGH or LOW
+#define SCRIPT_BURST 0x06 ///< Burst mode, then 1 = consecutive commands share one /CS, 0 = one /CS per command, default = 0
+/// @}
+
+///
+/// @name SPI speeds for the screens
+/// @note Maximum speeds for writing, per family of screens
+/// @note Long wires or breadboards may require lower speeds
+/// @{
+#define SPI_SPEED_DEFAULT 8000000 ///< Standard speed, all families
+#define SPI_SPEED_MAX_SMALL 10000000 ///< Maximum speed, small screens
+#define SPI_SPEED_MAX_MEDIUM 20000000 ///< Maximum speed, medium screens
+#define SPI_SPEED_MAX_LARGE 10000000 ///< Maximum speed, large screens
+/// @}
+
+///
+/// @brief Timing profile of the panel
+/// @details Delays for reset, /CS and commands, used by all the functions of hV_Board
+///
+struct timing_s
+{
+    uint16_t resetPower; ///< Delay after panelPower on, before RESET_PIN HIGH, ms, counted from power on
+    uint16_t resetHigh; ///< Delay after RESET_PIN HIGH, ms
+    uint16_t resetLow; ///< Delay after RESET_PIN LOW, ms
+    uint16_t resetReady; ///< Delay after RESET_PIN HIGH again, ms
+    uint16_t resetSelect; ///< Delay after CS_PIN HIGH, ms
+    uint16_t setupCS; ///< Setup and hold of /CS around the index and the data, us
+    uint16_t setupCSS; ///< Additional setup of /CSS for the second half of large screens, once when /CSS goes low, us
+    uint16_t gapCommand; ///< Gap after each command, us
+};
+
+///
+/// @brief Timing profile for small screens
+/// @see ApplicationNote_smallSize_fast-update_v02_20220907
+///
+const timing_s timingSmall = { 5, 5, 10, 5, 5, 0, 0, 0 };
+
+///
+/// @brief Timing profile for medium screens
+/// @see ApplicationNote_EPD343_Mono(E2343PS0Bx)_240320a
+///
+const timing_s timingMedium = { 5, 2, 4, 20, 5, 0, 0, 0 };
+
+///
+/// @brief Timing profile for large screens
+/// @note /CS 50 + /CSS 450 = 500 us
+///
+const timing_s timingLarge = { 5, 2, 4, 20, 5, 50, 450, 0 };
+
 // Objects
 //
 ///
@@ -60,9 +119,17 @@ class hV_Board
   public:
     ///
     /// @brief Constructor
+    /// @note Each board takes one owner of the shared SPI bus, from SPI_OWNER_SCREEN to SPI_OWNER_MAX,
+    /// then SPI_OWNER_NONE
     ///
     hV_Board();
 
+    ///
+    /// @brief Destructor
+    /// @note Releases the owner of the shared SPI bus
+    ///
+    ~hV_Board();
+
     ///
     /// @brief Set panelPower pin
     /// @param panelPowerPin panelPower pin
@@ -77,6 +144,35 @@ class hV_Board
     ///
     pins_t getBoardPins();
 
+    ///
+    /// @brief Set the SPI speed for the screen
+    /// @param speed SPI speed in Hz, default = SPI_SPEED_DEFAULT
+    /// @return SPI speed set, limited to the maximum for the family of the screen
+    /// @note Applied at once, and at each update for screens sharing the SPI bus
+    /// @warning setSpeedSPI() should be called after begin()
+    ///
+    uint32_t setSpeedSPI(uint32_t speed = SPI_SPEED_DEFAULT);
+
+    ///
+    /// @brief Get the SPI speed for the screen
+    /// @return SPI speed in Hz
+    ///
+    uint32_t getSpeedSPI();
+
+    ///
+    /// @brief Set the timing profile of the panel
+    /// @param timing timing profile
+    /// @note For tuning only, as shorter delays may prevent the panel from working
+    /// @warning setTiming() should be called after begin()
+    ///
+    void setTiming(timing_s timing);
+
+    ///
+    /// @brief Get the timing profile of the panel
+    /// @return timing profile, selected by begin() for the family of the screen
+    ///
+    timing_s getTiming();
+
     /// @cond
   protected:
 
@@ -84,23 +180,18 @@ class hV_Board
     /// @brief Initialisation
     /// @param board board configuration
     /// @param family screen family, default = FAMILY_SMALL
-    /// @param delayCS delay for /CS, default = 50 ms
-    /// @note Typical values are
-    /// + FAMILY_SMALL and 0 ms
-    /// + FAMILY_MEDIUM and 50 ms
-    /// + FAMILY_LARGE and 50 ms
+    /// @note Timing profile selected for the family, single source of the delays,
+    /// see timingSmall, timingMedium and timingLarge
     ///
-    void b_begin(pins_t board, uint8_t family = FAMILY_SMALL, uint16_t delayCS = 50);
+    void b_begin(pins_t board, uint8_t family = FAMILY_SMALL);
 
     ///
     /// @brief General reset
-    /// @param ms1 delay after PNLON_PIN, ms
-    /// @param ms2 delay after RESET_PIN HIGH, ms
-    /// @param ms3 delay after RESET_PIN LOW, ms
-    /// @param ms4 delay after RESET_PIN HIGH, ms
-    /// @param ms5 delay after CS_PIN CSS_PIN HIGH, ms
+    /// @note Delays from the timing profile, resetPower only for what is left since power on,
+    /// so a second reset, as after reading the OTP, skips it
+    /// @return duration of the reset, us
     ///
-    void b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, uint32_t ms5);
+    uint32_t b_reset();
 
     ///
     /// @brief Send fixed value through SPI
@@ -148,10 +239,19 @@ class hV_Board
     ///
     void b_waitBusy(bool state = HIGH);
 
+    ///
+    /// @brief Check busy
+    /// @details Non-blocking alternative to b_waitBusy()
+    /// @param state ready state, HIGH = default, LOW
+    /// @return true if panelBusy signal has not reached state yet
+    ///
+    bool b_checkBusy(bool state = HIGH);
+
     ///
     /// @brief Send a command
     /// @param command command
     /// @note panelDC is kept high, to be changed manually after
+    /// @note On large screens, b_sendCommand8() sends to both sub-panels
     ///
     void b_sendCommand8(uint8_t command);
 
@@ -160,6 +260,7 @@ class hV_Board
     /// @param command command
     /// @param data uint8_t data
     /// @note panelDC is kept high, to be changed manually after
+    /// @note On large screens, b_sendCommandData8() sends to both sub-panels
     ///
     void b_sendCommandData8(uint8_t command, uint8_t data);
 
@@ -172,27 +273,60 @@ class hV_Board
     ///
     void b_sendCommandDataSelect8(uint8_t command, uint8_t data, uint8_t select = PANEL_CS_BOTH);
 
+    ///
+    /// @brief Run a command script
+    /// @param script bytecode, ended by SCRIPT_END
+    /// @param reference data for SCRIPT_COMMAND_OTP, typically OTP, default = none
+    /// @param values data for SCRIPT_COMMAND_VALUE, computed at run-time, default = none
+    /// @note Each command is framed as b_sendCommandData8(), panelDC low for command and high for data.
+    /// @note With burst mode, consecutive commands are sent with panelCS kept low,
+    /// so only for controllers that accept it.
+    /// @note On large screens, commands are sent to both sub-panels
+    ///
+    void b_runScript(const uint8_t * script, const uint8_t * reference = 0, const uint8_t * values = 0);
+
     ///
     /// @brief Suspend GPIOs
-    /// @details Turn off and set low all GPIOs
+    /// @details Turn off the optional power circuit
+    /// @note FSM_GPIO_MASK cleared only if panelPower is connected, as nothing is powered off otherwise
     ///
     void b_suspend();
 
+    ///
+    /// @brief Suspend the SPI bus
+    /// @details Release the bus and park the SPI pins if no other owner uses the bus
+    /// @note FSM_BUS_MASK cleared, the next resume() starts the bus again
+    /// @note Bus kept on and FSM_BUS_MASK kept if flashCS or cardCS is connected,
+    /// as Flash and SD-card libraries do not register on the bus, or without owner
+    ///
+    void b_suspendBus();
+
+    ///
+    /// @brief Apply the SPI speed of the screen
+    /// @note Only if different from the current speed, as another screen may share the SPI bus
+    ///
+    void b_applySpeedSPI();
+
     ///
     /// @brief Resume GPIOs
-    /// @details Turn on and configure all GPIOs
+    /// @details Turn on the optional power circuit,
+    /// and configure all GPIOs the first time only, as FSM_CONFIG_MASK is kept by b_suspend()
     ///
     void b_resume();
 
     pins_t b_pin;
-    uint16_t b_delayCS = 50; // ms
+    timing_s b_timing = timingSmall;
+    uint32_t b_speedSPI = SPI_SPEED_DEFAULT; // Hz
     uint8_t b_family;
     uint8_t b_fsmPowerScreen = FSM_OFF;
+    uint32_t b_chronoPower = 0; // Time of power on, ms, for resetPower
+    uint8_t b_busOwner; // Owner of the shared SPI bus, SPI_OWNER_SCREEN to SPI_OWNER_MAX or SPI_OWNER_NONE
 
   private:
     /// @brief Select one half of large screens
     /// @param select default = PANEL_CS_BOTH, otherwise PANEL_CS_MASTER or PANEL_CS_SLAVE
     /// @note Valid only for 9.69 and 11.98" screens
+    /// @note setupCSS only when /CSS goes low, so not for PANEL_CS_MASTER
     ///
     void b_select(uint8_t select = PANEL_CS_BOTH);
 
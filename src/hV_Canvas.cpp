@@ -0,0 +1,226 @@
+//
+// hV_Canvas.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See hV_Canvas.h for references
+//
+// Release 821: Initial release
+//
+
+// Library header
+#include "hV_Canvas.h"
+
+// Code
+hV_Canvas::hV_Canvas()
+{
+    c_buffer = 0; // nullptr
+    c_stride = 0;
+    c_format = BITMAP_ROW_MSB;
+}
+
+void hV_Canvas::begin(uint8_t * buffer, uint16_t dx, uint16_t dy, uint8_t format)
+{
+    c_buffer = buffer;
+    c_format = (format == BITMAP_COLUMN_MSB) ? BITMAP_COLUMN_MSB : BITMAP_ROW_MSB;
+    c_stride = (c_format == BITMAP_COLUMN_MSB) ? (dy + 7) / 8 : (dx + 7) / 8;
+
+    v_screenSizeH = dx;
+    v_screenSizeV = dy;
+    v_screenDiagonal = 0;
+    v_screenMarginH = 0;
+    v_screenMarginV = 0;
+    v_screenColourBits = 1;
+    v_orientation = 0;
+    v_penSolid = false;
+    v_flagRead = true; // s_getPoint() for invertRectangle()
+    v_flagStorage = false;
+    v_flagEnergy = false;
+
+    hV_Screen_Buffer::begin(); // Fonts
+    s_resetViewport();
+}
+
+STRING_TYPE hV_Canvas::WhoAmI()
+{
+    return formatString("Canvas %ix%i", v_screenSizeH, v_screenSizeV);
+}
+
+void hV_Canvas::flush()
+{
+    ;
+}
+
+void hV_Canvas::setOrientation(uint8_t orientation)
+{
+    (void)orientation; // Orientation 0 only
+}
+
+const uint8_t * hV_Canvas::getBuffer()
+{
+    return c_buffer;
+}
+
+uint16_t hV_Canvas::getStride()
+{
+    return c_stride;
+}
+
+uint8_t hV_Canvas::getFormat()
+{
+    return c_format;
+}
+
+void hV_Canvas::stamp(hV_Screen_Buffer * screen, uint16_t x0, uint16_t y0, uint8_t mode,
+                      uint16_t frontColour, uint16_t backColour)
+{
+    if (c_buffer == 0)
+    {
+        return;
+    }
+
+    switch (mode)
+    {
+        case CANVAS_OR:
+
+            screen->drawBitmap(x0, y0, v_screenSizeH, v_screenSizeV, c_buffer, c_stride, myColours.black, myColours.white, true, c_format);
+            break;
+
+        case CANVAS_AND_NOT:
+
+            screen->drawBitmap(x0, y0, v_screenSizeH, v_screenSizeV, c_buffer, c_stride, myColours.white, myColours.white, true, c_format);
+            break;
+
+        case CANVAS_TRANSPARENT:
+
+            screen->drawBitmap(x0, y0, v_screenSizeH, v_screenSizeV, c_buffer, c_stride, frontColour, backColour, true, c_format);
+            break;
+
+        default: // CANVAS_COPY
+
+            screen->drawBitmap(x0, y0, v_screenSizeH, v_screenSizeV, c_buffer, c_stride, frontColour, backColour, false, c_format);
+            break;
+    }
+}
+
+void hV_Canvas::s_setOrientation(uint8_t orientation)
+{
+    (void)orientation; // Orientation 0 only
+    v_orientation = 0;
+}
+
+bool hV_Canvas::s_orientCoordinates(uint16_t & x1, uint16_t & y1)
+{
+    return ((x1 < v_screenSizeH) and (y1 < v_screenSizeV)) ? RESULT_SUCCESS : RESULT_ERROR;
+}
+
+void hV_Canvas::s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+{
+    if ((c_buffer == 0) or (s_orientCoordinates(x1, y1) == RESULT_ERROR))
+    {
+        return;
+    }
+
+    // Convert combined colours into basic colours, same as the screen
+    if (colour == myColours.grey)
+    {
+        colour = ((x1 + y1) % 2 == 0) ? myColours.black : myColours.white;
+    }
+
+    // Line and position along the line
+    if (c_format == BITMAP_COLUMN_MSB)
+    {
+        hV_HAL_swap(x1, y1);
+    }
+
+    uint8_t * target = c_buffer + (uint32_t)y1 * c_stride + (x1 >> 3);
+    if (colour == myColours.black)
+    {
+        bitSet(*target, 7 - (x1 & 0x07));
+    }
+    else if (colour == myColours.white)
+    {
+        bitClear(*target, 7 - (x1 & 0x07));
+    }
+}
+
+uint16_t hV_Canvas::s_getPoint(uint16_t x1, uint16_t y1)
+{
+    if ((c_buffer == 0) or (s_orientCoordinates(x1, y1) == RESULT_ERROR))
+    {
+        return myColours.white;
+    }
+
+    // Line and position along the line
+    if (c_format == BITMAP_COLUMN_MSB)
+    {
+        hV_HAL_swap(x1, y1);
+    }
+
+    uint8_t value = c_buffer[(uint32_t)y1 * c_stride + (x1 >> 3)];
+    return bitRead(value, 7 - (x1 & 0x07)) ? myColours.black : myColours.white;
+}
+
+void hV_Canvas::s_fillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if ((c_buffer == 0) or ((colour != myColours.black) and (colour != myColours.white) and (colour != myColours.grey)))
+    {
+        return;
+    }
+
+    x2 = hV_HAL_min(x2, v_screenSizeH - 1);
+    y2 = hV_HAL_min(y2, v_screenSizeV - 1);
+    if ((x1 > x2) or (y1 > y2))
+    {
+        return;
+    }
+
+    // Lines and positions along the lines
+    if (c_format == BITMAP_COLUMN_MSB)
+    {
+        hV_HAL_swap(x1, y1);
+        hV_HAL_swap(x2, y2);
+    }
+
+    // Bytes along the line, from MSB = first pixel
+    uint16_t z1 = x1 >> 3;
+    uint16_t z2 = x2 >> 3;
+    uint8_t mask1 = 0xff >> (x1 & 0x07);
+    uint8_t mask2 = 0xff << (7 - (x2 & 0x07));
+    if (z1 == z2)
+    {
+        mask1 &= mask2;
+        mask2 = mask1;
+    }
+
+    for (uint16_t y = y1; y <= y2; y += 1)
+    {
+        uint8_t * row = c_buffer + (uint32_t)y * c_stride; // Row or column
+        uint8_t bits = 0x00; // white
+
+        if (colour == myColours.black)
+        {
+            bits = 0xff;
+        }
+        else if (colour == myColours.grey)
+        {
+            bits = (y % 2 == 0) ? 0xaa : 0x55; // black for even sum of coordinates
+        }
+
+        row[z1] = (row[z1] & ~mask1) | (bits & mask1);
+        if (z2 > z1)
+        {
+            memset(row + z1 + 1, bits, z2 - z1 - 1);
+        }
+        row[z2] = (row[z2] & ~mask2) | (bits & mask2);
+    }
+}
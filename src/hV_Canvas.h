@@ -0,0 +1,197 @@
+///
+/// @file hV_Canvas.h
+/// @brief Off-screen canvas with composition into a screen
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n A canvas provides the graphic and text primitives of the screen on its own small buffer.
+/// Recurring elements like icons, digits or headers are drawn once into a canvas,
+/// then stamped into the frame-buffer of the screen at each refresh.
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+// Checks
+#if (hV_SCREEN_BUFFER_RELEASE < 812)
+#error Required hV_SCREEN_BUFFER_RELEASE 812
+#endif // hV_SCREEN_BUFFER_RELEASE
+
+#ifndef hV_CANVAS_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_CANVAS_RELEASE 821
+
+///
+/// @brief Size of the buffer of a canvas
+/// @param dx width
+/// @param dy height
+/// @return number of bytes, for both row-major and column-major formats
+///
+#define CANVAS_BYTES(dx, dy) hV_HAL_max((((dx) + 7) / 8) * (dy), (((dy) + 7) / 8) * (dx))
+
+///
+/// @name Composition modes
+/// @details Pixels of the canvas drawn into the screen
+/// @{
+#define CANVAS_COPY 0x00 ///< Black pixels with front colour, white pixels with back colour
+#define CANVAS_OR 0x01 ///< Black pixels in black, white pixels unchanged
+#define CANVAS_AND_NOT 0x02 ///< Black pixels in white, white pixels unchanged
+#define CANVAS_TRANSPARENT 0x03 ///< Black pixels with front colour, white pixels unchanged
+/// @}
+
+// Objects
+//
+///
+/// @brief Class for off-screen canvas
+/// @details The canvas uses a buffer provided by the caller, one bit per pixel, 1 = black.
+/// The buffer is row-major or column-major, most significant bit first, as BITMAP_ROW_MSB or BITMAP_COLUMN_MSB.
+/// @note No memory is allocated by the canvas.
+/// @note Stamping copies whole bytes when the format is the one returned by bitmapFormat() for the screen.
+/// @note The canvas keeps orientation 0, the orientation of the screen applies when stamped.
+/// @note Grey is a checker-board aligned on the canvas, so stamp at even coordinates to match grey of the screen.
+///
+/// @code {.cpp}
+/// uint8_t bufferIcon[CANVAS_BYTES(32, 32)];
+/// hV_Canvas myIcon;
+///
+/// myIcon.begin(bufferIcon, 32, 32, myScreen.bitmapFormat());
+/// myIcon.clear(myColours.white);
+/// myIcon.circle(15, 15, 12, myColours.black);
+///
+/// myIcon.stamp(&myScreen, 10, 10, CANVAS_OR);
+/// myScreen.flush();
+/// @endcode
+///
+class hV_Canvas : public hV_Screen_Buffer
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Canvas();
+
+    /// @name General
+    /// @{
+
+    ///
+    /// @brief Initialisation
+    /// @param buffer buffer provided by the caller, CANVAS_BYTES(dx, dy) bytes
+    /// @param dx width
+    /// @param dy height
+    /// @param format BITMAP_ROW_MSB or BITMAP_COLUMN_MSB, default = BITMAP_ROW_MSB
+    /// @note The content of the buffer is kept, use clear() to initialise it
+    ///
+    void begin(uint8_t * buffer, uint16_t dx, uint16_t dy, uint8_t format = BITMAP_ROW_MSB);
+
+    ///
+    /// @brief Who Am I
+    /// @return Who Am I string
+    ///
+    virtual STRING_TYPE WhoAmI();
+
+    ///
+    /// @brief Flush, nothing to do for a canvas
+    ///
+    virtual void flush();
+
+    ///
+    /// @brief Set orientation, not available
+    /// @param orientation ignored, the canvas keeps orientation 0
+    ///
+    virtual void setOrientation(uint8_t orientation);
+
+    ///
+    /// @brief Get the buffer
+    /// @return pointer to the buffer, in the format of the canvas
+    ///
+    const uint8_t * getBuffer();
+
+    ///
+    /// @brief Get the number of bytes per row or per column
+    /// @return bytes
+    ///
+    uint16_t getStride();
+
+    ///
+    /// @brief Get the format of the buffer
+    /// @return BITMAP_ROW_MSB or BITMAP_COLUMN_MSB
+    ///
+    uint8_t getFormat();
+
+    /// @}
+
+    /// @name Composition
+    /// @{
+
+    ///
+    /// @brief Draw the canvas into a screen
+    /// @param screen target screen
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param mode CANVAS_COPY, CANVAS_OR, CANVAS_AND_NOT or CANVAS_TRANSPARENT, default = CANVAS_COPY
+    /// @param frontColour 16-bit colour for black pixels, CANVAS_COPY and CANVAS_TRANSPARENT only, default = black
+    /// @param backColour 16-bit colour for white pixels, CANVAS_COPY only, default = white
+    /// @note Same as drawBitmap(), so clip rectangle and viewport of the screen apply
+    ///
+    void stamp(hV_Screen_Buffer * screen, uint16_t x0, uint16_t y0, uint8_t mode = CANVAS_COPY,
+               uint16_t frontColour = myColours.black, uint16_t backColour = myColours.white);
+
+    /// @}
+
+  protected:
+    /// @cond
+
+    void s_setOrientation(uint8_t orientation);
+    bool s_orientCoordinates(uint16_t & x1, uint16_t & y1);
+    void s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour);
+    uint16_t s_getPoint(uint16_t x1, uint16_t y1);
+
+    ///
+    /// @brief Fill a rectangle by bytes
+    /// @note Same parameters as hV_Screen_Buffer::s_fillRectangle()
+    ///
+    void s_fillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    uint8_t * c_buffer;
+    uint16_t c_stride;
+    uint8_t c_format;
+
+    /// @endcond
+};
+
+#endif // hV_CANVAS_RELEASE
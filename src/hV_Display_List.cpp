@@ -0,0 +1,729 @@
+//
+// hV_Display_List.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See hV_Display_List.h for references
+//
+// Release 821: Initial release
+//
+
+// Library header
+#include "hV_Display_List.h"
+
+// Code
+hV_Display_List::hV_Display_List()
+{
+    d_buffer = 0; // nullptr
+    d_data = 0; // nullptr
+    d_size = 0;
+    d_length = 0;
+    d_count = 0;
+    d_overflow = false;
+}
+
+void hV_Display_List::begin(uint8_t * buffer, uint16_t size)
+{
+    d_buffer = buffer;
+    d_data = buffer;
+    d_size = size;
+    reset();
+}
+
+bool hV_Display_List::load(const uint8_t * data, uint16_t length)
+{
+    d_buffer = 0; // nullptr, read-only
+    d_data = data;
+    d_size = length;
+    d_length = length;
+    d_count = 0;
+    d_overflow = false;
+
+    // Walk through the records to check the stream
+    uint16_t index = 0;
+    while (index < d_length)
+    {
+        uint16_t size = d_recordSize(index);
+        if ((size == 0) or (index + size > d_length))
+        {
+            d_length = index;
+            return RESULT_ERROR;
+        }
+        index += size;
+        d_count += 1;
+    }
+
+    return RESULT_SUCCESS;
+}
+
+void hV_Display_List::reset()
+{
+    d_length = 0;
+    d_count = 0;
+    d_overflow = false;
+}
+
+const uint8_t * hV_Display_List::getData()
+{
+    return d_data;
+}
+
+uint16_t hV_Display_List::getSize()
+{
+    return d_length;
+}
+
+uint16_t hV_Display_List::getCount()
+{
+    return d_count;
+}
+
+bool hV_Display_List::getOverflow()
+{
+    return d_overflow;
+}
+
+//
+// === Recording section
+//
+bool hV_Display_List::d_reserve(uint8_t code, uint16_t size)
+{
+    // Read-only list or not enough space
+    if ((d_buffer == 0) or ((uint32_t)d_length + 1 + size > d_size))
+    {
+        d_overflow = true;
+        return false;
+    }
+
+    d_buffer[d_length] = code;
+    d_length += 1;
+    d_count += 1;
+    return true;
+}
+
+void hV_Display_List::d_add8(uint8_t value)
+{
+    d_buffer[d_length] = value;
+    d_length += 1;
+}
+
+void hV_Display_List::d_add16(uint16_t value)
+{
+    d_buffer[d_length] = (uint8_t)(value & 0xff);
+    d_buffer[d_length + 1] = (uint8_t)(value >> 8);
+    d_length += 2;
+}
+
+uint16_t hV_Display_List::d_get16(uint16_t index)
+{
+    return (uint16_t)d_data[index] | ((uint16_t)d_data[index + 1] << 8);
+}
+
+void hV_Display_List::clear(uint16_t colour)
+{
+    if (d_reserve(DISPLAY_LIST_CLEAR, 2))
+    {
+        d_add16(colour);
+    }
+}
+
+void hV_Display_List::setOrientation(uint8_t orientation)
+{
+    if (d_reserve(DISPLAY_LIST_ORIENTATION, 1))
+    {
+        d_add8(orientation);
+    }
+}
+
+void hV_Display_List::point(uint16_t x1, uint16_t y1, uint16_t colour)
+{
+    if (d_reserve(DISPLAY_LIST_POINT, 6))
+    {
+        d_add16(x1);
+        d_add16(y1);
+        d_add16(colour);
+    }
+}
+
+void hV_Display_List::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if (d_reserve(DISPLAY_LIST_LINE, 10))
+    {
+        d_add16(x1);
+        d_add16(y1);
+        d_add16(x2);
+        d_add16(y2);
+        d_add16(colour);
+    }
+}
+
+void hV_Display_List::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+{
+    line(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+}
+
+void hV_Display_List::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if (d_reserve(DISPLAY_LIST_RECTANGLE, 10))
+    {
+        d_add16(x1);
+        d_add16(y1);
+        d_add16(x2);
+        d_add16(y2);
+        d_add16(colour);
+    }
+}
+
+void hV_Display_List::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+{
+    rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+}
+
+void hV_Display_List::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour)
+{
+    if (d_reserve(DISPLAY_LIST_CIRCLE, 8))
+    {
+        d_add16(x0);
+        d_add16(y0);
+        d_add16(radius);
+        d_add16(colour);
+    }
+}
+
+void hV_Display_List::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+{
+    if (d_reserve(DISPLAY_LIST_TRIANGLE, 14))
+    {
+        d_add16(x1);
+        d_add16(y1);
+        d_add16(x2);
+        d_add16(y2);
+        d_add16(x3);
+        d_add16(y3);
+        d_add16(colour);
+    }
+}
+
+void hV_Display_List::setPenSolid(bool flag)
+{
+    if (d_reserve(DISPLAY_LIST_PEN_SOLID, 1))
+    {
+        d_add8(flag);
+    }
+}
+
+void hV_Display_List::selectFont(uint8_t font)
+{
+    if (d_reserve(DISPLAY_LIST_FONT_SELECT, 1))
+    {
+        d_add8(font);
+    }
+}
+
+void hV_Display_List::setFontSolid(bool flag)
+{
+    if (d_reserve(DISPLAY_LIST_FONT_SOLID, 1))
+    {
+        d_add8(flag);
+    }
+}
+
+void hV_Display_List::setFontSpaceX(uint8_t number)
+{
+    if (d_reserve(DISPLAY_LIST_FONT_SPACE_X, 1))
+    {
+        d_add8(number);
+    }
+}
+
+void hV_Display_List::d_addText(uint8_t code, uint16_t x0, uint16_t y0, const char * text, size_t length, uint16_t textColour, uint16_t backColour)
+{
+    length = hV_HAL_min(length, 255);
+
+    if (d_reserve(code, 9 + length))
+    {
+        d_add16(x0);
+        d_add16(y0);
+        d_add16(textColour);
+        d_add16(backColour);
+        d_add8(length);
+        memcpy(d_buffer + d_length, text, length);
+        d_length += length;
+    }
+}
+
+void hV_Display_List::gText(uint16_t x0, uint16_t y0, STRING_CONST_TYPE text, uint16_t textColour, uint16_t backColour)
+{
+    d_addText(DISPLAY_LIST_TEXT, x0, y0, text.c_str(), text.length(), textColour, backColour);
+}
+
+void hV_Display_List::gText(uint16_t x0, uint16_t y0, const char * text, uint16_t textColour, uint16_t backColour)
+{
+    d_addText(DISPLAY_LIST_TEXT, x0, y0, text, strlen(text), textColour, backColour);
+}
+
+void hV_Display_List::gTextLarge(uint16_t x0, uint16_t y0, STRING_CONST_TYPE text, uint16_t textColour, uint16_t backColour)
+{
+    d_addText(DISPLAY_LIST_TEXT_LARGE, x0, y0, text.c_str(), text.length(), textColour, backColour);
+}
+
+void hV_Display_List::gTextLarge(uint16_t x0, uint16_t y0, const char * text, uint16_t textColour, uint16_t backColour)
+{
+    d_addText(DISPLAY_LIST_TEXT_LARGE, x0, y0, text, strlen(text), textColour, backColour);
+}
+//
+// === End of Recording section
+//
+
+//
+// === Replay section
+//
+uint16_t hV_Display_List::d_recordSize(uint16_t index)
+{
+    uint16_t result = 0;
+
+    switch (d_data[index])
+    {
+        case DISPLAY_LIST_CLEAR:
+
+            result = 1 + 2;
+            break;
+
+        case DISPLAY_LIST_POINT:
+
+            result = 1 + 6;
+            break;
+
+        case DISPLAY_LIST_LINE:
+        case DISPLAY_LIST_RECTANGLE:
+
+            result = 1 + 10;
+            break;
+
+        case DISPLAY_LIST_CIRCLE:
+
+            result = 1 + 8;
+            break;
+
+        case DISPLAY_LIST_TRIANGLE:
+
+            result = 1 + 14;
+            break;
+
+        case DISPLAY_LIST_TEXT:
+        case DISPLAY_LIST_TEXT_LARGE:
+
+            // Length of text at offset 9
+            result = ((uint32_t)index + 9 < d_length) ? 1 + 9 + d_data[index + 9] : 0;
+            break;
+
+        case DISPLAY_LIST_PEN_SOLID:
+        case DISPLAY_LIST_FONT_SELECT:
+        case DISPLAY_LIST_FONT_SOLID:
+        case DISPLAY_LIST_FONT_SPACE_X:
+        case DISPLAY_LIST_ORIENTATION:
+
+            result = 1 + 1;
+            break;
+
+        default: // DISPLAY_LIST_END and unknown records
+
+            result = 0;
+            break;
+    }
+
+    return result;
+}
+
+void hV_Display_List::d_beginContext(hV_Screen_Buffer * screen, context_s & context)
+{
+    // States without getter start identical for both lists
+    context.index = 0;
+    context.font = screen->getFont();
+    context.spaceX = screen->getFontSpaceX();
+    context.fontSolid = false;
+    context.penSolid = false;
+    context.orientation = screen->getOrientation();
+}
+
+bool hV_Display_List::d_sameContext(context_s & context1, context_s & context2)
+{
+    return (context1.font == context2.font) and (context1.spaceX == context2.spaceX)
+           and (context1.fontSolid == context2.fontSolid) and (context1.penSolid == context2.penSolid)
+           and (context1.orientation == context2.orientation);
+}
+
+bool hV_Display_List::d_clipBand(hV_Screen_Buffer * screen, area_s band)
+{
+    uint16_t sizeX = screen->screenSizeX();
+    uint16_t sizeY = screen->screenSizeY();
+    uint16_t y1 = hV_HAL_min(band.y1, sizeY);
+    uint16_t y2 = hV_HAL_min(band.y2, sizeY - 1);
+    uint16_t dy = (y1 <= y2) ? y2 - y1 + 1 : 0;
+
+    // Viewport with the same origin, popViewport() restores the clip rectangle
+    bool result = (screen->pushViewport(0, 0, sizeX, sizeY) == RESULT_SUCCESS);
+    screen->setClip(0, y1, sizeX, dy);
+
+    return result;
+}
+
+bool hV_Display_List::d_recordArea(hV_Screen_Buffer * screen, context_s & context, area_s & area)
+{
+    uint16_t index = context.index + 1; // Skip code
+    bool result = true;
+
+    switch (d_data[context.index])
+    {
+        case DISPLAY_LIST_CLEAR:
+
+            area = { 0, 0, 0xffff, 0xffff };
+            break;
+
+        case DISPLAY_LIST_POINT:
+
+            area.x1 = d_get16(index);
+            area.y1 = d_get16(index + 2);
+            area.x2 = area.x1;
+            area.y2 = area.y1;
+            break;
+
+        case DISPLAY_LIST_LINE:
+        case DISPLAY_LIST_RECTANGLE:
+
+            area.x1 = d_get16(index);
+            area.y1 = d_get16(index + 2);
+            area.x2 = area.x1;
+            area.y2 = area.y1;
+            mergeArea(area, { d_get16(index + 4), d_get16(index + 6), d_get16(index + 4), d_get16(index + 6) });
+            break;
+
+        case DISPLAY_LIST_CIRCLE:
+        {
+            uint16_t x0 = d_get16(index);
+            uint16_t y0 = d_get16(index + 2);
+            uint16_t radius = d_get16(index + 4);
+
+            area.x1 = (x0 > radius) ? x0 - radius : 0;
+            area.y1 = (y0 > radius) ? y0 - radius : 0;
+            area.x2 = x0 + radius;
+            area.y2 = y0 + radius;
+            break;
+        }
+
+        case DISPLAY_LIST_TRIANGLE:
+
+            area.x1 = d_get16(index);
+            area.y1 = d_get16(index + 2);
+            area.x2 = area.x1;
+            area.y2 = area.y1;
+            mergeArea(area, { d_get16(index + 4), d_get16(index + 6), d_get16(index + 4), d_get16(index + 6) });
+            mergeArea(area, { d_get16(index + 8), d_get16(index + 10), d_get16(index + 8), d_get16(index + 10) });
+            break;
+
+        case DISPLAY_LIST_TEXT:
+        case DISPLAY_LIST_TEXT_LARGE:
+        {
+            uint8_t scale = (d_data[context.index] == DISPLAY_LIST_TEXT_LARGE) ? 2 : 1;
+            const char * text = (const char *)(d_data + index + 9);
+            uint8_t length = d_data[index + 8];
+
+            // Sizes from the font of the screen, including user fonts
+            if (screen->getFont() != context.font)
+            {
+                screen->selectFont(context.font);
+            }
+            if (screen->getFontSpaceX() != context.spaceX)
+            {
+                screen->setFontSpaceX(context.spaceX);
+            }
+
+            area.x1 = d_get16(index);
+            area.y1 = d_get16(index + 2);
+            area.x2 = area.x1 + screen->stringSizeX(text, length) * scale;
+            area.y2 = area.y1 + screen->characterSizeY() * scale - 1;
+            area.x2 -= (area.x2 > area.x1) ? 1 : 0;
+            break;
+        }
+
+        case DISPLAY_LIST_FONT_SELECT:
+
+            context.font = d_data[index];
+            result = false;
+            break;
+
+        case DISPLAY_LIST_FONT_SPACE_X:
+
+            context.spaceX = d_data[index];
+            result = false;
+            break;
+
+        case DISPLAY_LIST_FONT_SOLID:
+
+            context.fontSolid = (d_data[index] > 0);
+            result = false;
+            break;
+
+        case DISPLAY_LIST_PEN_SOLID:
+
+            context.penSolid = (d_data[index] > 0);
+            result = false;
+            break;
+
+        case DISPLAY_LIST_ORIENTATION:
+
+            context.orientation = d_data[index];
+            result = false;
+            break;
+
+        default: // State records
+
+            result = false;
+            break;
+    }
+
+    return result;
+}
+
+void hV_Display_List::d_execute(hV_Screen_Buffer * screen, uint16_t index)
+{
+    uint8_t code = d_data[index];
+    index += 1; // Skip code
+
+    switch (code)
+    {
+        case DISPLAY_LIST_CLEAR:
+
+            screen->clear(d_get16(index));
+            break;
+
+        case DISPLAY_LIST_POINT:
+
+            screen->point(d_get16(index), d_get16(index + 2), d_get16(index + 4));
+            break;
+
+        case DISPLAY_LIST_LINE:
+
+            screen->line(d_get16(index), d_get16(index + 2), d_get16(index + 4), d_get16(index + 6), d_get16(index + 8));
+            break;
+
+        case DISPLAY_LIST_RECTANGLE:
+
+            screen->rectangle(d_get16(index), d_get16(index + 2), d_get16(index + 4), d_get16(index + 6), d_get16(index + 8));
+            break;
+
+        case DISPLAY_LIST_CIRCLE:
+
+            screen->circle(d_get16(index), d_get16(index + 2), d_get16(index + 4), d_get16(index + 6));
+            break;
+
+        case DISPLAY_LIST_TRIANGLE:
+
+            screen->triangle(d_get16(index), d_get16(index + 2), d_get16(index + 4), d_get16(index + 6), d_get16(index + 8), d_get16(index + 10), d_get16(index + 12));
+            break;
+
+        case DISPLAY_LIST_TEXT:
+        case DISPLAY_LIST_TEXT_LARGE:
+        {
+            // Characters read from the stream, no copy
+            const char * text = (const char *)(d_data + index + 9);
+            uint8_t length = d_data[index + 8];
+
+            if (code == DISPLAY_LIST_TEXT)
+            {
+                screen->gText(d_get16(index), d_get16(index + 2), text, length, d_get16(index + 4), d_get16(index + 6));
+            }
+            else
+            {
+                screen->gTextLarge(d_get16(index), d_get16(index + 2), text, length, d_get16(index + 4), d_get16(index + 6));
+            }
+            break;
+        }
+
+        case DISPLAY_LIST_PEN_SOLID:
+
+            screen->setPenSolid(d_data[index] > 0);
+            break;
+
+        case DISPLAY_LIST_FONT_SELECT:
+
+            screen->selectFont(d_data[index]);
+            break;
+
+        case DISPLAY_LIST_FONT_SOLID:
+
+            screen->setFontSolid(d_data[index] > 0);
+            break;
+
+        case DISPLAY_LIST_FONT_SPACE_X:
+
+            screen->setFontSpaceX(d_data[index]);
+            break;
+
+        case DISPLAY_LIST_ORIENTATION:
+
+            screen->setOrientation(d_data[index]);
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+void hV_Display_List::replay(hV_Screen_Buffer * screen)
+{
+    uint16_t index = 0;
+
+    while (index < d_length)
+    {
+        uint16_t size = d_recordSize(index);
+        if (size == 0)
+        {
+            break;
+        }
+
+        d_execute(screen, index);
+        index += size;
+    }
+}
+
+void hV_Display_List::replayBand(hV_Screen_Buffer * screen, uint16_t y1, uint16_t y2)
+{
+    context_s context;
+    area_s band = { 0, hV_HAL_min(y1, y2), 0xffff, hV_HAL_max(y1, y2) };
+    area_s area;
+    bool flagClip = false; // Clip rectangle set to the band
+    bool flagViewport = false; // Viewport opened for the band
+
+    d_beginContext(screen, context);
+
+    while (context.index < d_length)
+    {
+        uint16_t size = d_recordSize(context.index);
+        if (size == 0)
+        {
+            break;
+        }
+
+        if (d_recordArea(screen, context, area) == false)
+        {
+            // State records are always executed
+            d_execute(screen, context.index);
+
+            // setOrientation() resets the viewports and the clip rectangle
+            if (d_data[context.index] == DISPLAY_LIST_ORIENTATION)
+            {
+                flagClip = false;
+                flagViewport = false;
+            }
+        }
+        else if (overlapArea(area, band))
+        {
+            if (flagClip == false)
+            {
+                flagViewport = d_clipBand(screen, band);
+                flagClip = true;
+            }
+
+            // clear() ignores the clip rectangle, band filled instead
+            if (d_data[context.index] == DISPLAY_LIST_CLEAR)
+            {
+                uint16_t colour = d_get16(context.index + 1);
+                screen->patternRectangle(0, band.y1, screen->screenSizeX() - 1, hV_HAL_min(band.y2, screen->screenSizeY() - 1),
+                                         PATTERN_SOLID, colour, colour);
+            }
+            else
+            {
+                d_execute(screen, context.index);
+            }
+        }
+        context.index += size;
+    }
+
+    // Clip rectangle of the caller
+    if (flagViewport)
+    {
+        screen->popViewport();
+    }
+    else if (flagClip)
+    {
+        screen->resetClip();
+    }
+}
+
+uint16_t hV_Display_List::compare(hV_Display_List & previous, area_s * areas, uint16_t number, hV_Screen_Buffer * screen)
+{
+    context_s contextNew;
+    context_s contextOld;
+    uint16_t result = 0;
+
+    if (number == 0)
+    {
+        return 0;
+    }
+
+    uint8_t oldFont = screen->getFont();
+    uint8_t oldSpaceX = screen->getFontSpaceX();
+    d_beginContext(screen, contextNew);
+    d_beginContext(screen, contextOld);
+
+    while ((contextNew.index < d_length) or (contextOld.index < previous.d_length))
+    {
+        uint16_t sizeNew = (contextNew.index < d_length) ? d_recordSize(contextNew.index) : 0;
+        uint16_t sizeOld = (contextOld.index < previous.d_length) ? previous.d_recordSize(contextOld.index) : 0;
+
+        if ((sizeNew == 0) and (sizeOld == 0))
+        {
+            break;
+        }
+
+        // Same record and same state, no change
+        bool flagSame = (sizeNew == sizeOld) and d_sameContext(contextNew, contextOld);
+        flagSame = flagSame and (memcmp(d_data + contextNew.index, previous.d_data + contextOld.index, sizeNew) == 0);
+
+        area_s areaNew, areaOld;
+        bool flagNew = (sizeNew > 0) and d_recordArea(screen, contextNew, areaNew);
+        bool flagOld = (sizeOld > 0) and previous.d_recordArea(screen, contextOld, areaOld);
+
+        if ((flagSame == false) and (flagNew or flagOld))
+        {
+            area_s area = flagNew ? areaNew : areaOld;
+            if (flagNew and flagOld)
+            {
+                mergeArea(area, areaOld);
+            }
+
+            if (result < number)
+            {
+                areas[result] = area;
+                result += 1;
+            }
+            else
+            {
+                mergeArea(areas[number - 1], area);
+            }
+        }
+
+        contextNew.index += sizeNew;
+        contextOld.index += sizeOld;
+    }
+
+    // Font of the screen
+    screen->selectFont(oldFont);
+    screen->setFontSpaceX(oldSpaceX);
+
+    return result;
+}
+//
+// === End of Replay section
+//
@@ -0,0 +1,300 @@
+///
+/// @file hV_Display_List.h
+/// @brief Display list for graphics and text primitives
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The display list records the primitives of hV_Screen_Buffer into a compact byte stream.
+/// The stream can be replayed into the frame-buffer, replayed band by band,
+/// and compared with another display list to identify the changed areas.
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+// Checks
+#if (hV_SCREEN_BUFFER_RELEASE < 812)
+#error Required hV_SCREEN_BUFFER_RELEASE 812
+#endif // hV_SCREEN_BUFFER_RELEASE
+
+#ifndef hV_DISPLAY_LIST_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_DISPLAY_LIST_RELEASE 821
+
+///
+/// @name Display list records
+/// @details Each record starts with the code, followed by the parameters
+/// * Coordinates and colours are uint16_t, little-endian
+/// * Flags and numbers are uint8_t
+/// * Text is a uint8_t length followed by the characters
+/// @note Numbers are sequential and exclusive
+/// @{
+#define DISPLAY_LIST_END 0x00 ///< End of list
+#define DISPLAY_LIST_CLEAR 0x01 ///< clear(colour)
+#define DISPLAY_LIST_POINT 0x02 ///< point(x1, y1, colour)
+#define DISPLAY_LIST_LINE 0x03 ///< line(x1, y1, x2, y2, colour)
+#define DISPLAY_LIST_RECTANGLE 0x04 ///< rectangle(x1, y1, x2, y2, colour)
+#define DISPLAY_LIST_CIRCLE 0x05 ///< circle(x0, y0, radius, colour)
+#define DISPLAY_LIST_TRIANGLE 0x06 ///< triangle(x1, y1, x2, y2, x3, y3, colour)
+#define DISPLAY_LIST_TEXT 0x07 ///< gText(x0, y0, text, textColour, backColour)
+#define DISPLAY_LIST_TEXT_LARGE 0x08 ///< gTextLarge(x0, y0, text, textColour, backColour)
+#define DISPLAY_LIST_PEN_SOLID 0x09 ///< setPenSolid(flag)
+#define DISPLAY_LIST_FONT_SELECT 0x0a ///< selectFont(font)
+#define DISPLAY_LIST_FONT_SOLID 0x0b ///< setFontSolid(flag)
+#define DISPLAY_LIST_FONT_SPACE_X 0x0c ///< setFontSpaceX(number)
+#define DISPLAY_LIST_ORIENTATION 0x0d ///< setOrientation(orientation)
+/// @}
+
+// Objects
+//
+///
+/// @brief Class for display list
+/// @details The display list records the primitives into a buffer provided by the caller.
+/// @note No memory is allocated by the display list.
+///
+/// @code {.cpp}
+/// uint8_t bufferList[512];
+/// hV_Display_List myList;
+///
+/// myList.begin(bufferList, sizeof(bufferList));
+/// myList.selectFont(Font_Terminal8x12);
+/// myList.gText(10, 10, "Hello");
+/// myList.rectangle(0, 0, 99, 49, myColours.black);
+///
+/// myList.replay(&myScreen);
+/// myScreen.flush();
+/// @endcode
+///
+class hV_Display_List
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Display_List();
+
+    /// @name General
+    /// @{
+
+    ///
+    /// @brief Initialisation for recording
+    /// @param buffer buffer provided by the caller
+    /// @param size size of the buffer, in bytes
+    /// @note The list is emptied
+    ///
+    void begin(uint8_t * buffer, uint16_t size);
+
+    ///
+    /// @brief Use a display list recorded previously
+    /// @param data recorded stream, for example a constant blob
+    /// @param length number of bytes of the stream
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The list is read-only after load()
+    ///
+    bool load(const uint8_t * data, uint16_t length);
+
+    ///
+    /// @brief Empty the list
+    ///
+    void reset();
+
+    ///
+    /// @brief Get the recorded stream
+    /// @return pointer to the stream
+    ///
+    const uint8_t * getData();
+
+    ///
+    /// @brief Get the size of the recorded stream
+    /// @return number of bytes
+    ///
+    uint16_t getSize();
+
+    ///
+    /// @brief Get the number of records
+    /// @return number of records
+    ///
+    uint16_t getCount();
+
+    ///
+    /// @brief Check whether the last records were dropped
+    /// @return true if the buffer was too small or the list is read-only
+    ///
+    bool getOverflow();
+
+    /// @}
+
+    /// @name Recording
+    /// @note Same parameters as hV_Screen_Buffer
+    /// @{
+
+    void clear(uint16_t colour = myColours.white);
+    void setOrientation(uint8_t orientation);
+    void point(uint16_t x1, uint16_t y1, uint16_t colour);
+    void line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+    void dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
+    void rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+    void dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
+    void circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour);
+    void triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
+    void setPenSolid(bool flag = true);
+    void selectFont(uint8_t font);
+    void setFontSolid(bool flag = true);
+    void setFontSpaceX(uint8_t number = 1);
+    void gText(uint16_t x0, uint16_t y0, STRING_CONST_TYPE text, uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+    void gText(uint16_t x0, uint16_t y0, const char * text, uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+    void gTextLarge(uint16_t x0, uint16_t y0, STRING_CONST_TYPE text, uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+    void gTextLarge(uint16_t x0, uint16_t y0, const char * text, uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    /// @}
+
+    /// @name Replay
+    /// @{
+
+    ///
+    /// @brief Replay the display list into the frame-buffer
+    /// @param screen target screen
+    /// @note Call flush() afterwards to update the screen
+    ///
+    void replay(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Replay the primitives of the display list within a band
+    /// @param screen target screen
+    /// @param y1 top of the band, y-axis
+    /// @param y2 bottom of the band, y-axis
+    /// @note Only the primitives intersecting the band are drawn, state records are always replayed
+    /// @note Primitives are clipped to the band, clear() fills the band only
+    /// @note The clip rectangle of the screen is restored afterwards, except after a setOrientation() record
+    ///
+    void replayBand(hV_Screen_Buffer * screen, uint16_t y1, uint16_t y2);
+
+    ///
+    /// @brief Compare with a previous display list
+    /// @param previous previous display list
+    /// @param[out] areas array of changed areas
+    /// @param number size of the areas array
+    /// @param screen screen, for the sizes of the fonts
+    /// @return number of changed areas, 0 if both lists are identical
+    /// @note Records are compared one by one, with the area of each record merged with the area of the record it replaces
+    /// @note A record is changed if its bytes or the state set by the previous records differ
+    /// @note If more areas are required than available, the last one is extended to include the remaining ones
+    /// @note The font of the screen is restored afterwards
+    ///
+    uint16_t compare(hV_Display_List & previous, area_s * areas, uint16_t number, hV_Screen_Buffer * screen);
+
+    /// @}
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Context for walking through the list
+    ///
+    struct context_s
+    {
+        uint16_t index; ///< position in the stream
+        uint8_t font; ///< selected font
+        uint8_t spaceX; ///< additional spaces between two characters
+        bool fontSolid; ///< opaque text
+        bool penSolid; ///< filled shapes
+        uint8_t orientation; ///< orientation
+    };
+
+    ///
+    /// @brief Initialise a context with the state of the screen
+    /// @param screen screen
+    /// @param[out] context context
+    ///
+    void d_beginContext(hV_Screen_Buffer * screen, context_s & context);
+
+    ///
+    /// @brief Compare the states of two contexts
+    /// @return true if all the states are identical
+    ///
+    bool d_sameContext(context_s & context1, context_s & context2);
+
+    ///
+    /// @brief Set the clip rectangle to the band
+    /// @param screen target screen
+    /// @param band band, y-axis only
+    /// @return true if a viewport was opened, false if only the clip rectangle was set
+    ///
+    bool d_clipBand(hV_Screen_Buffer * screen, area_s band);
+
+    ///
+    /// @brief Get the size of a record
+    /// @param index position of the record in the stream
+    /// @return size of the record in bytes, 0 if invalid
+    ///
+    uint16_t d_recordSize(uint16_t index);
+
+    ///
+    /// @brief Get the area covered by a record
+    /// @param screen screen, for the size of the font
+    /// @param[out] context context, updated by state records
+    /// @param[out] area area covered by the record
+    /// @return true if the record draws, false for state records
+    /// @note The font of the context is selected on the screen for text records
+    ///
+    bool d_recordArea(hV_Screen_Buffer * screen, context_s & context, area_s & area);
+
+    ///
+    /// @brief Execute a record
+    /// @param screen target screen
+    /// @param index position of the record in the stream
+    ///
+    void d_execute(hV_Screen_Buffer * screen, uint16_t index);
+
+    bool d_reserve(uint8_t code, uint16_t size);
+    void d_add8(uint8_t value);
+    void d_add16(uint16_t value);
+    uint16_t d_get16(uint16_t index);
+    void d_addText(uint8_t code, uint16_t x0, uint16_t y0, const char * text, size_t length, uint16_t textColour, uint16_t backColour);
+
+    uint8_t * d_buffer;
+    const uint8_t * d_data;
+    uint16_t d_size;
+    uint16_t d_length;
+    uint16_t d_count;
+    bool d_overflow;
+
+    /// @endcond
+};
+
+#endif // hV_DISPLAY_LIST_RELEASE
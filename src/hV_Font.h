@@ -93,6 +93,19 @@ struct width_s
 ///   - b2 = 0x-4 = d4 = bold
 ///   - b10 = 0x-0..0x-3 = d0..d3 = variant number
 ///
+/// @n Glyph definition, monospaced Terminal fonts
+/// * Each glyph takes bytes = maxWidth * roundUp(height, 8)
+/// * Columns from left to right, each column with roundUp(height, 8) bytes from top to bottom
+/// * Within a byte, bit 0 is the top pixel
+///
+/// @n Glyph definition, compressed Terminal fonts
+/// * Generated by extras/Fonts/Terminal_Compress.py
+/// * offsets: number + 1 entries, glyph n from table[offsets[n]] to table[offsets[n + 1]]
+/// * Empty glyph: no record
+/// * Header byte: first column << 4 | (number of columns - 1), blank columns before and after removed
+/// * Then for each column, either an index in the dictionary or 0xff followed by the roundUp(height, 8) bytes of the column
+/// * Decoded glyphs have the same definition as the monospaced Terminal fonts
+///
 /// @warning font_s.table needs to be uint8_t instead of unsigned short
 /// @n Otherwise on TM4C129, font_s.table written as uint16_t
 ///
@@ -103,6 +116,10 @@ struct font_s
     uint8_t maxWidth; ///< maximum width in pixels from *width array
     uint8_t first; ///< number of first character, usually 32
     uint8_t number; ///< number of characters, usually 96 or 224
+    const uint8_t * table; ///< glyph definitions, number * bytes
+    uint8_t bytes; ///< bytes per glyph
+    const uint16_t * offsets; ///< compressed glyphs only, offsets of the glyphs in table, 0 = uncompressed
+    const uint8_t * dictionary; ///< compressed glyphs only, columns referenced by index
 };
 
 #endif // USE_FONT_TERMINAL
@@ -20,6 +20,12 @@
 // All rights reserved
 //
 // Release 803: Added types for string and frame-buffer
+// Release 821: Added functions with const char *
+// Release 821: Added table of fonts and user fonts
+// Release 821: Added compressed fonts with cache of decoded glyphs
+// Release 821: Fixed number of characters to fit, with spaces between characters
+// Release 821: Kept 1 pixel between characters by default
+// Release 821: Fixed error value of addFont()
 //
 
 // Configuration
@@ -32,14 +38,62 @@
 #include "hV_Font_Terminal.h"
 
 // Code
+///
+/// @brief Table of Terminal fonts
+/// @note kind, height, maxWidth, first, number, table, bytes, offsets, dictionary
+/// @note offsets and dictionary set to 0 = nullptr for uncompressed fonts
+///
+static const font_s fontTerminal[] =
+{
+#if (MAX_FONT_SIZE > 0)
+    { 0x40, 8, 6, 32, 224, &Terminal6x8e[0][0], sizeof(Terminal6x8e[0]), 0, 0 },
+#if (FONT_TERMINAL_COMPRESSED > 0)
+#if (MAX_FONT_SIZE > 1)
+    { 0x40, 12, 8, 32, 224, Terminal8x12c, 16, Terminal8x12c_offsets, &Terminal8x12c_dictionary[0][0] },
+#if (MAX_FONT_SIZE > 2)
+    { 0x40, 16, 12, 32, 224, Terminal12x16c, 24, Terminal12x16c_offsets, &Terminal12x16c_dictionary[0][0] },
+#if (MAX_FONT_SIZE > 3)
+    { 0x40, 24, 16, 32, 224, Terminal16x24c, 48, Terminal16x24c_offsets, &Terminal16x24c_dictionary[0][0] },
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+#else
+#if (MAX_FONT_SIZE > 1)
+    { 0x40, 12, 8, 32, 224, &Terminal8x12e[0][0], sizeof(Terminal8x12e[0]), 0, 0 },
+#if (MAX_FONT_SIZE > 2)
+    { 0x40, 16, 12, 32, 224, &Terminal12x16e[0][0], sizeof(Terminal12x16e[0]), 0, 0 },
+#if (MAX_FONT_SIZE > 3)
+    { 0x40, 24, 16, 32, 224, &Terminal16x24e[0][0], sizeof(Terminal16x24e[0]), 0, 0 },
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+#endif // FONT_TERMINAL_COMPRESSED
+#endif // end MAX_FONT_SIZE > 0
+};
+
+///
+/// @brief Number of Terminal fonts
+///
+#define FONT_TERMINAL_NUMBER (sizeof(fontTerminal) / sizeof(fontTerminal[0]))
+
 // Font functions
 // hV_Font_Terminal::hV_Font_Terminal()
 void hV_Font_Terminal::f_begin()
 {
     f_fontSize = 0;
-    f_fontNumber = MAX_FONT_SIZE;
+    f_fontNumber = FONT_TERMINAL_NUMBER;
     f_fontSolid = true;
     f_fontSpaceX = 1;
+    f_fontSpaceY = 0;
+
+#if (FONT_TERMINAL_COMPRESSED > 0)
+    // Empty cache, ages as a permutation
+    for (uint8_t index = 0; index < FONT_CACHE_SIZE; index += 1)
+    {
+        f_cache[index].table = 0; // nullptr
+        f_cache[index].age = index;
+    }
+#endif // FONT_TERMINAL_COMPRESSED
 
     // Take first font
     f_selectFont(0);
@@ -47,7 +101,35 @@ void hV_Font_Terminal::f_begin()
 
 uint8_t hV_Font_Terminal::f_addFont(font_s fontName)
 {
-    return f_fontNumber;
+    // Check room and glyph definition
+    if ((f_fontNumber >= FONT_TERMINAL_NUMBER + MAX_FONT_USER) or (fontName.table == 0))
+    {
+        return FONT_ERROR;
+    }
+
+    // Deduce bytes per glyph if not provided
+    if (fontName.bytes == 0)
+    {
+        fontName.bytes = fontName.maxWidth * ((fontName.height + 7) / 8);
+    }
+
+    // Compressed glyphs require the cache
+    if (fontName.offsets != 0)
+    {
+#if (FONT_TERMINAL_COMPRESSED > 0)
+        if ((fontName.dictionary == 0) or (fontName.bytes > FONT_CACHE_GLYPH_SIZE))
+        {
+            return FONT_ERROR;
+        }
+#else
+        return FONT_ERROR;
+#endif // FONT_TERMINAL_COMPRESSED
+    }
+
+    f_fontUser[f_fontNumber - FONT_TERMINAL_NUMBER] = fontName;
+    f_fontNumber += 1;
+
+    return f_fontNumber - 1;
 }
 
 void hV_Font_Terminal::f_setFontSolid(bool flag)
@@ -57,42 +139,34 @@ void hV_Font_Terminal::f_setFontSolid(bool flag)
 
 void hV_Font_Terminal::f_selectFont(uint8_t size)
 {
-    if (size < MAX_FONT_SIZE)
+    if (f_fontNumber == 0)
+    {
+        return;
+    }
+
+    if (size < f_fontNumber)
     {
         f_fontSize = size;
     }
     else
     {
-        f_fontSize = MAX_FONT_SIZE - 1;
+        f_fontSize = f_fontNumber - 1;
     }
 
-    switch (f_fontSize)
+    // Descriptor cached, including pointer to glyph definitions
+    if (f_fontSize < FONT_TERMINAL_NUMBER)
     {
-        case 0:
-            // kind, height, maxWidth, first, number
-            f_font = { 0x40, 8, 6, 32, 224 };
-            break;
-
-        case 1:
-            f_font = { 0x40, 12, 8, 32, 224 };
-            break;
-
-        case 2:
-            f_font = { 0x40, 16, 12, 32, 224 };
-            break;
-
-        case 3:
-            f_font = { 0x40, 24, 16, 32, 224 };
-            break;
-
-        default:
-            break;
+        f_font = fontTerminal[f_fontSize];
+    }
+    else
+    {
+        f_font = f_fontUser[f_fontSize - FONT_TERMINAL_NUMBER];
     }
 }
 
 uint8_t hV_Font_Terminal::f_fontMax()
 {
-    return MAX_FONT_SIZE;
+    return f_fontNumber;
 }
 
 void hV_Font_Terminal::f_setFontSpaceX(uint8_t number)
@@ -107,38 +181,98 @@ void hV_Font_Terminal::f_setFontSpaceY(uint8_t number)
 
 uint8_t hV_Font_Terminal::f_getCharacter(uint8_t character, uint16_t index)
 {
-#if (MAX_FONT_SIZE > 0)
-    if (f_fontSize == 0)
-    {
-        return Terminal6x8e[character][index];
-    }
-#if (MAX_FONT_SIZE > 1)
-    else if (f_fontSize == 1)
-    {
-        return Terminal8x12e[character][index];
-    }
-#if (MAX_FONT_SIZE > 2)
-    else if (f_fontSize == 2)
+    return f_getGlyph(character)[index];
+}
+
+const uint8_t * hV_Font_Terminal::f_getGlyph(uint8_t character)
+{
+#if (FONT_TERMINAL_COMPRESSED > 0)
+
+    if (f_font.offsets != 0)
     {
-        return Terminal12x16e[character][index];
+        uint8_t found = FONT_CACHE_SIZE;
+        uint8_t oldest = 0;
+
+        for (uint8_t index = 0; index < FONT_CACHE_SIZE; index += 1)
+        {
+            if ((f_cache[index].table == f_font.table) and (f_cache[index].character == character))
+            {
+                found = index;
+                break;
+            }
+            if (f_cache[index].age > f_cache[oldest].age)
+            {
+                oldest = index;
+            }
+        }
+
+        // Miss, least recently used entry replaced
+        if (found == FONT_CACHE_SIZE)
+        {
+            found = oldest;
+            f_decodeGlyph(character, f_cache[found].glyph);
+            f_cache[found].table = f_font.table;
+            f_cache[found].character = character;
+        }
+
+        // Most recently used
+        for (uint8_t index = 0; index < FONT_CACHE_SIZE; index += 1)
+        {
+            if (f_cache[index].age < f_cache[found].age)
+            {
+                f_cache[index].age += 1;
+            }
+        }
+        f_cache[found].age = 0;
+
+        return f_cache[found].glyph;
     }
-#if (MAX_FONT_SIZE > 3)
-    else if (f_fontSize == 3)
+
+#endif // FONT_TERMINAL_COMPRESSED
+
+    return f_font.table + (uint16_t)character * f_font.bytes;
+}
+
+#if (FONT_TERMINAL_COMPRESSED > 0)
+
+void hV_Font_Terminal::f_decodeGlyph(uint8_t character, uint8_t * glyph)
+{
+    uint8_t rows = (f_font.height + 7) / 8; // Bytes per column
+    const uint8_t * pointer = f_font.table + f_font.offsets[character];
+    const uint8_t * end = f_font.table + f_font.offsets[character + 1];
+
+    memset(glyph, 0x00, f_font.bytes);
+
+    // Empty glyph
+    if (pointer == end)
     {
-        return Terminal16x24e[character][index];
+        return;
     }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-    else
+
+    uint8_t column = pointer[0] >> 4;
+    uint8_t number = (pointer[0] & 0x0f) + 1;
+    pointer += 1;
+
+    for (uint8_t index = 0; index < number; index += 1)
     {
-        return 0;
+        if (pointer[0] == 0xff) // Raw column
+        {
+            memcpy(glyph + (column + index) * rows, pointer + 1, rows);
+            pointer += 1 + rows;
+        }
+        else // Column from dictionary
+        {
+            memcpy(glyph + (column + index) * rows, f_font.dictionary + pointer[0] * rows, rows);
+            pointer += 1;
+        }
     }
-#endif // end MAX_FONT_SIZE > 0
 }
 
+#endif // FONT_TERMINAL_COMPRESSED
+
 uint16_t hV_Font_Terminal::f_characterSizeX(uint8_t character)
 {
+    (void)character; // Monospaced font
     return f_font.maxWidth;
 }
 
@@ -149,32 +283,38 @@ uint16_t hV_Font_Terminal::f_characterSizeY()
 
 uint16_t hV_Font_Terminal::f_stringSizeX(STRING_CONST_TYPE text)
 {
-    uint16_t textWidth = 0;
-    uint8_t textLength = 0;
+    return f_stringSizeX(text.c_str(), text.length());
+}
 
-    textLength = text.length();
+uint16_t hV_Font_Terminal::f_stringSizeX(const char * text, size_t length)
+{
+    uint16_t textWidth = 0;
 
-    textWidth = (f_font.maxWidth + f_fontSpaceX) * textLength;
+    // Monospaced font, the characters are not read
+    (void)text;
+    textWidth = (f_font.maxWidth + f_fontSpaceX) * length;
 
     return textWidth;
 }
 
 uint8_t hV_Font_Terminal::f_stringLengthToFitX(STRING_CONST_TYPE text, uint16_t pixels)
 {
-    uint8_t index = 0;
-    uint16_t textWidth = 0;
-    uint8_t textLength = 0;
+    return f_stringLengthToFitX(text.c_str(), text.length(), pixels);
+}
 
-    textLength = text.length();
+uint8_t hV_Font_Terminal::f_stringLengthToFitX(const char * text, size_t length, uint16_t pixels)
+{
+    uint8_t textLength = hV_HAL_min(length, 255);
+    uint16_t pitch = f_font.maxWidth + f_fontSpaceX;
+    (void)text; // Monospaced font, the characters are not read
 
-    // Monospaced font
-    index = pixels / f_font.maxWidth - 1;
-    if (index > textLength)
+    if (pitch == 0)
     {
-        index = textLength;
+        return textLength;
     }
 
-    return index;
+    // Monospaced font, same measure as f_stringSizeX()
+    return hV_HAL_min(pixels / pitch, textLength);
 }
 
 uint8_t hV_Font_Terminal::f_getFontKind()
@@ -67,6 +67,17 @@
 ///
 #if (MAX_FONT_SIZE > 0)
 #include "Terminal6x8e.h"
+#if (FONT_TERMINAL_COMPRESSED > 0)
+#if (MAX_FONT_SIZE > 1)
+#include "Terminal8x12c.h"
+#if (MAX_FONT_SIZE > 2)
+#include "Terminal12x16c.h"
+#if (MAX_FONT_SIZE > 3)
+#include "Terminal16x24c.h"
+#endif
+#endif
+#endif
+#else
 #if (MAX_FONT_SIZE > 1)
 #include "Terminal8x12e.h"
 #if (MAX_FONT_SIZE > 2)
@@ -76,6 +87,7 @@
 #endif
 #endif
 #endif
+#endif // FONT_TERMINAL_COMPRESSED
 #endif
 
 ///
@@ -90,6 +102,34 @@ enum fontNumber_e
     Font_Terminal16x24,
 };
 
+#ifndef MAX_FONT_USER
+///
+/// @brief Maximum number of user fonts added with addFont()
+///
+#define MAX_FONT_USER 2
+#endif // MAX_FONT_USER
+
+///
+/// @brief Error value returned by addFont(), as 0 is a valid font number
+///
+#define FONT_ERROR 0xff
+
+#if (FONT_TERMINAL_COMPRESSED > 0)
+#ifndef FONT_CACHE_SIZE
+///
+/// @brief Number of decoded glyphs kept in cache
+/// @note Each entry takes FONT_CACHE_GLYPH_SIZE + 4 bytes of SRAM
+///
+#define FONT_CACHE_SIZE 8
+#endif // FONT_CACHE_SIZE
+
+///
+/// @brief Maximum size of a decoded glyph
+/// @details Terminal16x24 = 16 columns x 3 bytes
+///
+#define FONT_CACHE_GLYPH_SIZE 48
+#endif // FONT_TERMINAL_COMPRESSED
+
 ///
 /// @brief Class for font as header file
 ///
@@ -119,7 +159,8 @@ class hV_Font_Terminal
     ///
     /// @brief Use a font
     /// @param fontName name of the font
-    /// @return number of the font, 0 otherwise
+    /// @return number of the font, FONT_ERROR otherwise
+    /// @note Up to MAX_FONT_USER fonts, with the same glyph definition as the Terminal fonts
     /// @warning Definition for this method is compulsory.
     /// @note Previously setFontSize()
     /// @n @b More: @ref Fonts
@@ -174,6 +215,14 @@ class hV_Font_Terminal
     ///
     uint16_t f_stringSizeX(STRING_CONST_TYPE text);
 
+    ///
+    /// @brief String size, x-axis
+    /// @param text characters to evaluate
+    /// @param length number of characters
+    /// @return horizontal size of the string for current font, in pixels
+    ///
+    uint16_t f_stringSizeX(const char * text, size_t length);
+
     ///
     /// @brief Number of characters to fit a size, x-axis
     /// @param text string to evaluate
@@ -183,6 +232,15 @@ class hV_Font_Terminal
     ///
     uint8_t f_stringLengthToFitX(STRING_CONST_TYPE text, uint16_t pixels);
 
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text characters to evaluate
+    /// @param length number of characters
+    /// @param pixels number of pixels to fit in
+    /// @return number of characters to be displayed inside the pixels
+    ///
+    uint8_t f_stringLengthToFitX(const char * text, size_t length, uint16_t pixels);
+
     ///
     /// @brief Number of fonts
     /// @return number of fonts available
@@ -211,11 +269,43 @@ class hV_Font_Terminal
     ///
     uint8_t f_getCharacter(uint8_t character, uint16_t index);
 
+    ///
+    /// @brief Get definition of a glyph
+    /// @param character character number, from 0 = first character of the font
+    /// @return pointer to the glyph definition, bytes from f_font.bytes
+    /// @note For compressed fonts, the glyph is decoded into the cache
+    /// @warning The pointer is valid until the next call
+    ///
+    const uint8_t * f_getGlyph(uint8_t character);
+
+#if (FONT_TERMINAL_COMPRESSED > 0)
+    ///
+    /// @brief Decode a compressed glyph
+    /// @param character character number, from 0 = first character of the font
+    /// @param[out] glyph buffer for the glyph definition, f_font.bytes bytes
+    ///
+    void f_decodeGlyph(uint8_t character, uint8_t * glyph);
+
+    ///
+    /// @brief Entry of the cache of decoded glyphs
+    ///
+    struct glyphCache_s
+    {
+        const uint8_t * table; ///< font, 0 = empty entry
+        uint8_t character; ///< character number
+        uint8_t age; ///< 0 = most recently used
+        uint8_t glyph[FONT_CACHE_GLYPH_SIZE]; ///< decoded glyph
+    };
+
+    glyphCache_s f_cache[FONT_CACHE_SIZE]; ///< cache of decoded glyphs, least recently used replaced
+#endif // FONT_TERMINAL_COMPRESSED
+
     ///
     /// @name Variables for font management
     /// @{
     ///
     font_s f_font; ///< font
+    font_s f_fontUser[MAX_FONT_USER]; ///< fonts added with f_addFont()
     uint8_t f_fontNumber; ///< number of fonts available, 0.._fontNumber-1
     uint8_t f_fontSize; ///< actual font selected
     uint8_t f_fontSpaceX; ///< pixels between two characters, horizontal axis
@@ -25,6 +25,9 @@
 // Release 804: Improved power management
 // Release 805: Improved stability
 // Release 810: Added patches for some platforms
+// Release 821: Added owners for shared SPI bus
+// Release 821: Added change of SPI speed
+// Release 821: Added parking of SPI pins
 //
 
 // Library header
@@ -102,11 +105,19 @@ void waitFor(uint8_t pin, uint8_t state)
 // === SPI section
 //
 bool flagSPI = false; // Some SPI implementations require unique initialisation
+uint8_t ownerSPI = 0b00000000; // One bit per owner
+uint32_t speedSPI = 8000000; // Hz
 
-void hV_HAL_SPI_begin(uint32_t speed)
+void hV_HAL_SPI_begin(uint32_t speed, uint8_t owner)
 {
+    if (owner <= SPI_OWNER_MAX)
+    {
+        bitSet(ownerSPI, owner);
+    }
+
     if (flagSPI != true)
     {
+        speedSPI = speed;
         _settingScreen = {speed, MSBFIRST, SPI_MODE0};
 
 #if defined(ENERGIA)
@@ -142,15 +153,80 @@ void hV_HAL_SPI_begin(uint32_t speed)
     }
 }
 
-void hV_HAL_SPI_end()
+void hV_HAL_SPI_end(uint8_t owner, bool flagForce)
 {
-    if (flagSPI != false)
+    if (owner <= SPI_OWNER_MAX)
+    {
+        bitClear(ownerSPI, owner);
+    }
+    else if (flagForce == false)
+    {
+        return; // Not registered
+    }
+
+    // Other owners are kept registered when forced, and start the bus again with hV_HAL_SPI_begin()
+    if ((flagSPI != false) and ((ownerSPI == 0) or flagForce))
     {
         SPI.end();
         flagSPI = false;
     }
 }
 
+bool hV_HAL_SPI_park()
+{
+    if ((flagSPI == true) or (ownerSPI != 0))
+    {
+        return false; // Bus still on or still owned
+    }
+
+#if defined(ARDUINO_XIAO_ESP32C3)
+
+    uint8_t pinSPI[3] = {8, 10, 9}; // SCK MOSI MISO
+
+#elif defined(ARDUINO_ESP32_PICO)
+
+    uint8_t pinSPI[3] = {14, 13, 12}; // SCK MOSI MISO
+
+#else // General case
+
+    uint8_t pinSPI[3] = {SCK, MOSI, MISO};
+
+#endif // SPI specifics
+
+    pinMode(pinSPI[0], OUTPUT);
+    digitalWrite(pinSPI[0], LOW);
+    pinMode(pinSPI[1], OUTPUT);
+    digitalWrite(pinSPI[1], LOW);
+    pinMode(pinSPI[2], INPUT);
+
+    return true;
+}
+
+void hV_HAL_SPI_setSpeed(uint32_t speed)
+{
+    speedSPI = speed;
+    _settingScreen = {speed, MSBFIRST, SPI_MODE0};
+
+    if (flagSPI == true)
+    {
+#if defined(ENERGIA)
+
+        SPI.setClockDivider(SPI_CLOCK_MAX / min(SPI_CLOCK_MAX, _settingScreen.clock));
+
+#else
+
+        SPI.endTransaction();
+        SPI.beginTransaction(_settingScreen);
+
+#endif // ENERGIA
+    }
+}
+
+uint32_t hV_HAL_SPI_getSpeed()
+{
+    return speedSPI;
+}
+
 uint8_t hV_HAL_SPI_transfer(uint8_t data)
 {
     return SPI.transfer(data);
@@ -222,7 +298,7 @@ void hV_HAL_Wire_transfer(uint8_t address, uint8_t * dataWrite, size_t sizeWrite
     {
         memset(dataRead, 0x00, sizeRead);
         Wire.requestFrom(address, sizeRead);
-        while (Wire.available() < sizeRead)
+        while ((size_t)Wire.available() < sizeRead)
         {
             delay(4);
         }
@@ -61,6 +61,16 @@
 
 #define mySerial Serial
 
+///
+/// @name Owners of the shared SPI bus
+/// @note Devices not registered, eg. Flash or SD-card libraries, are not known to the bus
+/// @{
+#define SPI_OWNER_OTHER 0 ///< Default owner, sketch and other devices
+#define SPI_OWNER_SCREEN 1 ///< First owner for screens, one per screen
+#define SPI_OWNER_MAX 7 ///< Last owner
+#define SPI_OWNER_NONE 0xff ///< No owner, the bus is never released
+/// @}
+
 ///
 /// @brief General initialisation
 ///
@@ -79,15 +89,45 @@ void waitFor(uint8_t pin, uint8_t state = HIGH);
 /// @note Other parameters are
 /// * Bit order: MSBFIRST
 /// * Data mode: SPI_MODE0
+/// @param owner owner of the bus, SPI_OWNER_OTHER to SPI_OWNER_MAX, default = SPI_OWNER_OTHER
 /// @note With check for unique initialisation
+/// @note Each owner registers on the bus, so the bus remains on while it has at least one owner
+/// @note SPI_OWNER_NONE starts the bus without registering
 ///
-void hV_HAL_SPI_begin(uint32_t speed = 8000000);
+void hV_HAL_SPI_begin(uint32_t speed = 8000000, uint8_t owner = SPI_OWNER_OTHER);
 
 ///
 /// @brief End SPI
+/// @param owner owner of the bus, SPI_OWNER_OTHER to SPI_OWNER_MAX, default = SPI_OWNER_OTHER
+/// @param flagForce true = end the bus even if other owners are registered, default = false
 /// @note With check for unique deinitialisation
+/// @note The bus is ended only when the last owner releases it, unless forced
+/// @note SPI_OWNER_NONE ends the bus only when forced
+/// @note Forcing is required before using the SPI pins for 3-wire SPI
+///
+void hV_HAL_SPI_end(uint8_t owner = SPI_OWNER_OTHER, bool flagForce = false);
+
+///
+/// @brief Park the SPI pins
+/// @details Clock and data out as outputs low, data in as input
+/// @return true if parked, false if the bus is still on or has a registered owner
+/// @note Call hV_HAL_SPI_end() before, hV_HAL_SPI_begin() configures the pins again
+/// @note Chip select pins are not changed, so the devices on the bus remain unselected
+///
+bool hV_HAL_SPI_park();
+
+///
+/// @brief Change the SPI speed
+/// @param speed SPI speed in Hz
+/// @note Applied at once if SPI is started, otherwise by the next hV_HAL_SPI_begin()
+///
+void hV_HAL_SPI_setSpeed(uint32_t speed);
+
+///
+/// @brief Get the SPI speed
+/// @return SPI speed in Hz
 ///
-void hV_HAL_SPI_end();
+uint32_t hV_HAL_SPI_getSpeed();
 
 ///
 /// @brief Combined write and read of a single byte
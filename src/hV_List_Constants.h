@@ -114,6 +114,7 @@
 #define FSM_SLEEP 0x10 ///< Bus on, GPIO and Power off or undefined
 #define FSM_GPIO_MASK 0x01 ///< Mask for GPIO on or defined
 #define FSM_BUS_MASK 0x10 ///< Mask for bus on
+#define FSM_CONFIG_MASK 0x02 ///< Mask for GPIO configured, kept while the panel is powered off
 /// @}
 
 ///
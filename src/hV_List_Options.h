@@ -94,6 +94,19 @@
 #define MAX_FONT_SIZE 64
 #endif
 
+///
+/// @brief 4b- Compressed Terminal fonts
+/// @details Terminal 8x12, 12x16 and 16x24 fonts stored compressed in MCU Flash
+/// * 0 = uncompressed, default
+/// * 1 = compressed, ~9 kB saved with MAX_FONT_SIZE 4, glyphs decoded through a cache in SRAM
+///
+/// @note Only for USE_FONT_TERMINAL
+/// @see FONT_CACHE_SIZE in hV_Font_Terminal.h
+///
+#ifndef FONT_TERMINAL_COMPRESSED
+#define FONT_TERMINAL_COMPRESSED 0
+#endif // FONT_TERMINAL_COMPRESSED
+
 ///
 /// @name 5- Set SRAM memory
 /// @details From internal MCU or external SPI
@@ -21,6 +21,18 @@
 // Release 703: Improved orientation function
 // Release 801: Improved functions names consistency
 // Release 805: Added large variant for gText()
+// Release 821: Added text functions with const char * and string view
+// Release 821: Added generic glyph drawing based on font table
+// Release 821: Added scaled text with rectangle spans
+// Release 821: Added spaces between characters to text
+// Release 821: Changed text to advance by the width plus the spaces between characters, default 1 pixel as measured
+// Release 821: Added monochrome bitmap
+// Release 821: Added clip rectangle and viewports
+// Release 821: Added pattern fill and invert
+// Release 821: Added preferred bitmap format
+// Release 821: Added getter for spaces between characters
+// Release 821: Added getter for pen opaque
+// Release 821: Added generic invert based on read-back of points
 //
 
 // Library header
@@ -34,7 +46,11 @@ hV_Screen_Buffer::hV_Screen_Buffer()
     f_fontNumber = 0;
     f_fontSolid = true;
     f_fontSpaceX = 1;
+    f_fontSpaceY = 0;
     v_penSolid = false;
+    v_flagRead = false;
+    v_viewport = { 0, 0, { 0, 0, -1, -1 }, { 0, 0, -1, -1 } };
+    v_viewportNumber = 0;
 }
 
 void hV_Screen_Buffer::begin()
@@ -44,13 +60,13 @@ void hV_Screen_Buffer::begin()
 
 void hV_Screen_Buffer::clear(uint16_t colour)
 {
+    // Full screen, regardless of viewport and clip rectangle
     uint8_t oldOrientation = v_orientation;
-    bool oldPenSolid = v_penSolid;
-    setOrientation(0);
-    setPenSolid();
-    rectangle(0, 0, screenSizeX() - 1, screenSizeY() - 1, colour);
-    setOrientation(oldOrientation);
-    setPenSolid(oldPenSolid);
+    v_orientation = 0;
+    s_setOrientation(v_orientation);
+    s_fillRectangle(0, 0, screenSizeX() - 1, screenSizeY() - 1, colour);
+    v_orientation = oldOrientation;
+    s_setOrientation(v_orientation);
 }
 
 void hV_Screen_Buffer::flush()
@@ -90,6 +106,8 @@ void hV_Screen_Buffer::setOrientation(uint8_t orientation)
             s_setOrientation(v_orientation);
             break;
     }
+
+    s_resetViewport();
 }
 
 uint8_t hV_Screen_Buffer::getOrientation()
@@ -218,39 +236,18 @@ void hV_Screen_Buffer::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
 
 void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
-    if ((x1 == x2) and (y1 == y2))
-    {
-        s_setPoint(x1, y1, colour);
-    }
-    else if (x1 == x2)
-    {
-        if (y1 > y2)
-        {
-            hV_HAL_swap(y1, y2);
-        }
-        for (uint16_t y = y1; y <= y2; y++)
-        {
-            s_setPoint(x1, y, colour);
-        }
-    }
-    else if (y1 == y2)
+    int32_t wx1 = (int16_t)x1;
+    int32_t wx2 = (int16_t)x2;
+    int32_t wy1 = (int16_t)y1;
+    int32_t wy2 = (int16_t)y2;
+
+    if ((wx1 == wx2) or (wy1 == wy2))
     {
-        if (x1 > x2)
-        {
-            hV_HAL_swap(x1, x2);
-        }
-        for (uint16_t x = x1; x <= x2; x++)
-        {
-            s_setPoint(x, y1, colour);
-        }
+        // Vertical or horizontal, trimmed as a span
+        s_clipRectangle(wx1, wy1, wx2, wy2, colour);
     }
     else
     {
-        int16_t wx1 = (int16_t)x1;
-        int16_t wx2 = (int16_t)x2;
-        int16_t wy1 = (int16_t)y1;
-        int16_t wy2 = (int16_t)y2;
-
         bool flag = abs(wy2 - wy1) > abs(wx2 - wx1);
         if (flag)
         {
@@ -264,10 +261,10 @@ void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
             hV_HAL_swap(wy1, wy2);
         }
 
-        int16_t dx = wx2 - wx1;
-        int16_t dy = abs(wy2 - wy1);
-        int16_t err = dx / 2;
-        int16_t ystep;
+        int32_t dx = wx2 - wx1;
+        int32_t dy = abs(wy2 - wy1);
+        int32_t err = dx / 2;
+        int32_t ystep;
 
         if (wy1 < wy2)
         {
@@ -278,15 +275,29 @@ void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
             ystep = -1;
         }
 
+        // Trimmed along the major axis, relative to the viewport
+        int32_t low = flag ? v_viewport.clip.y1 - v_viewport.y0 : v_viewport.clip.x1 - v_viewport.x0;
+        int32_t high = flag ? v_viewport.clip.y2 - v_viewport.y0 : v_viewport.clip.x2 - v_viewport.x0;
+        wx2 = hV_HAL_min(wx2, high);
+        if (wx1 < low)
+        {
+            // Same error term as after low - wx1 steps
+            int32_t steps = low - wx1;
+            int32_t jumps = (steps * dy - err + dx - 1) / dx;
+            wy1 += ystep * jumps;
+            err += jumps * dx - steps * dy;
+            wx1 = low;
+        }
+
         for (; wx1 <= wx2; wx1++)
         {
             if (flag)
             {
-                s_setPoint(wy1, wx1, colour);
+                s_clipPoint(wy1, wx1, colour);
             }
             else
             {
-                s_setPoint(wx1, wy1, colour);
+                s_clipPoint(wx1, wy1, colour);
             }
 
             err -= dy;
@@ -304,9 +315,14 @@ void hV_Screen_Buffer::setPenSolid(bool flag)
     v_penSolid = flag;
 }
 
+bool hV_Screen_Buffer::getPenSolid()
+{
+    return v_penSolid;
+}
+
 void hV_Screen_Buffer::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
-    s_setPoint(x1, y1, colour);
+    s_clipPoint((int16_t)x1, (int16_t)y1, colour);
 }
 
 void hV_Screen_Buffer::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
@@ -320,24 +336,273 @@ void hV_Screen_Buffer::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
     }
     else
     {
-        if (x1 > x2)
+        s_clipRectangle((int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, colour);
+    }
+}
+
+void hV_Screen_Buffer::s_fillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        for (uint16_t y = y1; y <= y2; y++)
         {
-            hV_HAL_swap(x1, x2);
+            s_setPoint(x, y, colour);
         }
-        if (y1 > y2)
+    }
+}
+
+void hV_Screen_Buffer::drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                  const uint8_t * bitmap, uint16_t stride,
+                                  uint16_t frontColour, uint16_t backColour,
+                                  bool flagTransparent, uint8_t format)
+{
+    if ((bitmap == 0) or (dx == 0) or (dy == 0))
+    {
+        return;
+    }
+
+    bool flagColumn = ((format & BITMAP_COLUMN_MSB) == BITMAP_COLUMN_MSB);
+
+    // Bytes per row or per column
+    if (stride == 0)
+    {
+        stride = flagColumn ? (dy + 7) / 8 : (dx + 7) / 8;
+    }
+
+    // Trimmed to the clip rectangle, relative to the viewport
+    int32_t left = (int16_t)x0;
+    int32_t top = (int16_t)y0;
+    int32_t i1 = hV_HAL_max(v_viewport.clip.x1 - v_viewport.x0 - left, 0);
+    int32_t i2 = hV_HAL_min(v_viewport.clip.x2 - v_viewport.x0 - left, dx - 1);
+    int32_t j1 = hV_HAL_max(v_viewport.clip.y1 - v_viewport.y0 - top, 0);
+    int32_t j2 = hV_HAL_min(v_viewport.clip.y2 - v_viewport.y0 - top, dy - 1);
+    if ((i1 > i2) or (j1 > j2))
+    {
+        return;
+    }
+
+    // First visible line along the major axis, first visible bit along the minor axis
+    bitmap += (uint32_t)(flagColumn ? i1 : j1) * stride;
+    uint16_t offset = flagColumn ? j1 : i1;
+
+    s_drawBitmap(v_viewport.x0 + left + i1, v_viewport.y0 + top + j1, i2 - i1 + 1, j2 - j1 + 1,
+                 bitmap, stride, offset, frontColour, backColour, flagTransparent, format);
+}
+
+uint8_t hV_Screen_Buffer::bitmapFormat()
+{
+    return BITMAP_ROW_MSB;
+}
+
+void hV_Screen_Buffer::s_drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                    const uint8_t * bitmap, uint16_t stride, uint16_t offset,
+                                    uint16_t frontColour, uint16_t backColour,
+                                    bool flagTransparent, uint8_t format)
+{
+    bool flagColumn = ((format & BITMAP_COLUMN_MSB) == BITMAP_COLUMN_MSB);
+    bool flagLSB = ((format & BITMAP_ROW_LSB) == BITMAP_ROW_LSB);
+
+    for (uint16_t j = 0; j < dy; j += 1)
+    {
+        for (uint16_t i = 0; i < dx; i += 1)
         {
-            hV_HAL_swap(y1, y2);
+            uint16_t major = flagColumn ? i : j;
+            uint16_t minor = (flagColumn ? j : i) + offset;
+            uint8_t value = bitmap[(uint32_t)major * stride + (minor >> 3)];
+
+            if (bitRead(value, flagLSB ? (minor & 0x07) : 7 - (minor & 0x07)))
+            {
+                s_setPoint(x0 + i, y0 + j, frontColour);
+            }
+            else if (flagTransparent == false)
+            {
+                s_setPoint(x0 + i, y0 + j, backColour);
+            }
         }
-        for (uint16_t x = x1; x <= x2; x++)
+    }
+}
+
+void hV_Screen_Buffer::patternRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                        uint64_t pattern, uint16_t frontColour, uint16_t backColour,
+                                        bool flagTransparent)
+{
+    int32_t wx1 = (int16_t)x1;
+    int32_t wy1 = (int16_t)y1;
+    int32_t wx2 = (int16_t)x2;
+    int32_t wy2 = (int16_t)y2;
+
+    if (s_clipArea(wx1, wy1, wx2, wy2) == RESULT_SUCCESS)
+    {
+        s_fillPattern(wx1, wy1, wx2, wy2, pattern, frontColour, backColour, flagTransparent);
+    }
+}
+
+void hV_Screen_Buffer::invertRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint64_t pattern)
+{
+    int32_t wx1 = (int16_t)x1;
+    int32_t wy1 = (int16_t)y1;
+    int32_t wx2 = (int16_t)x2;
+    int32_t wy2 = (int16_t)y2;
+
+    if (s_clipArea(wx1, wy1, wx2, wy2) == RESULT_SUCCESS)
+    {
+        s_invertRectangle(wx1, wy1, wx2, wy2, pattern);
+    }
+}
+
+void hV_Screen_Buffer::s_fillPattern(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                     uint64_t pattern, uint16_t frontColour, uint16_t backColour,
+                                     bool flagTransparent)
+{
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        for (uint16_t y = y1; y <= y2; y++)
+        {
+            // Row y % 8 as byte, column x % 8 as bit, from the most significant
+            if ((pattern >> (63 - 8 * (y % 8) - (x % 8))) & 0x01)
+            {
+                s_setPoint(x, y, frontColour);
+            }
+            else if (flagTransparent == false)
+            {
+                s_setPoint(x, y, backColour);
+            }
+        }
+    }
+}
+
+uint16_t hV_Screen_Buffer::s_getPoint(uint16_t x1, uint16_t y1)
+{
+    // No read-back of the frame-buffer, see screens for an implementation
+    (void)x1;
+    (void)y1;
+    return myColours.white;
+}
+
+void hV_Screen_Buffer::s_invertRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint64_t pattern)
+{
+    if (v_flagRead == false)
+    {
+        return;
+    }
+
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        for (uint16_t y = y1; y <= y2; y++)
         {
-            for (uint16_t y = y1; y <= y2; y++)
+            // Same pattern layout as s_fillPattern()
+            if ((pattern >> (63 - 8 * (y % 8) - (x % 8))) & 0x01)
             {
-                s_setPoint(x, y, colour);
+                s_setPoint(x, y, (s_getPoint(x, y) == myColours.black) ? myColours.white : myColours.black);
             }
         }
     }
 }
 
+//
+// === Clip section
+//
+void hV_Screen_Buffer::setClip(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    int32_t x1 = v_viewport.x0 + (int16_t)x0;
+    int32_t y1 = v_viewport.y0 + (int16_t)y0;
+
+    v_viewport.clip.x1 = hV_HAL_max(x1, v_viewport.area.x1);
+    v_viewport.clip.y1 = hV_HAL_max(y1, v_viewport.area.y1);
+    v_viewport.clip.x2 = hV_HAL_min(x1 + dx - 1, v_viewport.area.x2);
+    v_viewport.clip.y2 = hV_HAL_min(y1 + dy - 1, v_viewport.area.y2);
+}
+
+void hV_Screen_Buffer::resetClip()
+{
+    v_viewport.clip = v_viewport.area;
+}
+
+bool hV_Screen_Buffer::pushViewport(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if (v_viewportNumber >= VIEWPORT_MAX)
+    {
+        return RESULT_ERROR;
+    }
+
+    v_viewports[v_viewportNumber] = v_viewport;
+    v_viewportNumber += 1;
+
+    // New origin, bounds within the previous clip rectangle
+    v_viewport.x0 += (int16_t)x0;
+    v_viewport.y0 += (int16_t)y0;
+    v_viewport.area.x1 = hV_HAL_max(v_viewport.x0, v_viewport.clip.x1);
+    v_viewport.area.y1 = hV_HAL_max(v_viewport.y0, v_viewport.clip.y1);
+    v_viewport.area.x2 = hV_HAL_min(v_viewport.x0 + dx - 1, v_viewport.clip.x2);
+    v_viewport.area.y2 = hV_HAL_min(v_viewport.y0 + dy - 1, v_viewport.clip.y2);
+    v_viewport.clip = v_viewport.area;
+
+    return RESULT_SUCCESS;
+}
+
+bool hV_Screen_Buffer::popViewport()
+{
+    if (v_viewportNumber == 0)
+    {
+        return RESULT_ERROR;
+    }
+
+    v_viewportNumber -= 1;
+    v_viewport = v_viewports[v_viewportNumber];
+
+    return RESULT_SUCCESS;
+}
+
+void hV_Screen_Buffer::s_resetViewport()
+{
+    v_viewportNumber = 0;
+    v_viewport.x0 = 0;
+    v_viewport.y0 = 0;
+    v_viewport.area = { 0, 0, (int16_t)(screenSizeX() - 1), (int16_t)(screenSizeY() - 1) };
+    v_viewport.clip = v_viewport.area;
+}
+
+void hV_Screen_Buffer::s_clipPoint(int32_t x1, int32_t y1, uint16_t colour)
+{
+    x1 += v_viewport.x0;
+    y1 += v_viewport.y0;
+
+    if ((x1 >= v_viewport.clip.x1) and (x1 <= v_viewport.clip.x2) and (y1 >= v_viewport.clip.y1) and (y1 <= v_viewport.clip.y2))
+    {
+        s_setPoint(x1, y1, colour);
+    }
+}
+
+void hV_Screen_Buffer::s_clipRectangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t colour)
+{
+    if (s_clipArea(x1, y1, x2, y2) == RESULT_SUCCESS)
+    {
+        s_fillRectangle(x1, y1, x2, y2, colour);
+    }
+}
+
+bool hV_Screen_Buffer::s_clipArea(int32_t & x1, int32_t & y1, int32_t & x2, int32_t & y2)
+{
+    if (x1 > x2)
+    {
+        hV_HAL_swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        hV_HAL_swap(y1, y2);
+    }
+
+    x1 = hV_HAL_max(x1 + v_viewport.x0, v_viewport.clip.x1);
+    y1 = hV_HAL_max(y1 + v_viewport.y0, v_viewport.clip.y1);
+    x2 = hV_HAL_min(x2 + v_viewport.x0, v_viewport.clip.x2);
+    y2 = hV_HAL_min(y2 + v_viewport.y0, v_viewport.clip.y2);
+
+    return ((x1 <= x2) and (y1 <= y2)) ? RESULT_SUCCESS : RESULT_ERROR;
+}
+//
+// === End of Clip section
+//
+
 void hV_Screen_Buffer::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
 {
     rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
@@ -462,17 +727,17 @@ void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
         bool b = true;
 
         // Graham Scan + Andrew's Monotone Chain Algorithm
-        // Sort by ascending y
+        // Sort by ascending y, coordinates relative to the viewport may be negative
         while (b)
         {
             b = false;
-            if ((b == false) and (y1 > y2))
+            if ((b == false) and ((int16_t)y1 > (int16_t)y2))
             {
                 hV_HAL_swap(x1, x2);
                 hV_HAL_swap(y1, y2);
                 b = true;
             }
-            if ((b == false) and (y2 > y3))
+            if ((b == false) and ((int16_t)y2 > (int16_t)y3))
             {
                 hV_HAL_swap(x3, x2);
                 hV_HAL_swap(y3, y2);
@@ -490,7 +755,7 @@ void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
         }
         else
         {
-            uint16_t x4 = (uint16_t)((int32_t)x1 + (y2 - y1) * (x3 - x1) / (y3 - y1));
+            uint16_t x4 = (uint16_t)((int32_t)(int16_t)x1 + (int32_t)((int16_t)y2 - (int16_t)y1) * ((int16_t)x3 - (int16_t)x1) / ((int16_t)y3 - (int16_t)y1));
             uint16_t y4 = y2;
 
             s_triangleArea(x1, y1, x2, y2, x4, y4, colour);
@@ -564,24 +829,63 @@ uint16_t hV_Screen_Buffer::characterSizeX(uint8_t character)
 
 uint16_t hV_Screen_Buffer::characterSizeY()
 {
-    return f_characterSizeY();
+    return f_characterSizeY() + f_fontSpaceY;
 }
 
 uint16_t hV_Screen_Buffer::stringSizeX(String text)
 {
-    return f_stringSizeX(text);
+    return f_stringSizeX(text.c_str(), text.length());
+}
+
+uint16_t hV_Screen_Buffer::stringSizeX(const char * text)
+{
+    return f_stringSizeX(text, strlen(text));
+}
+
+uint16_t hV_Screen_Buffer::stringSizeX(const char * text, size_t length)
+{
+    return f_stringSizeX(text, length);
 }
 
 uint8_t hV_Screen_Buffer::stringLengthToFitX(String text, uint16_t pixels)
 {
-    return f_stringLengthToFitX(text, pixels);
+    return f_stringLengthToFitX(text.c_str(), text.length(), pixels);
+}
+
+uint8_t hV_Screen_Buffer::stringLengthToFitX(const char * text, uint16_t pixels)
+{
+    return f_stringLengthToFitX(text, strlen(text), pixels);
+}
+
+uint8_t hV_Screen_Buffer::stringLengthToFitX(const char * text, size_t length, uint16_t pixels)
+{
+    return f_stringLengthToFitX(text, length, pixels);
+}
+
+#if defined(hV_HAS_STRING_VIEW)
+
+uint16_t hV_Screen_Buffer::stringSizeX(std::string_view text)
+{
+    return f_stringSizeX(text.data(), text.length());
+}
+
+uint8_t hV_Screen_Buffer::stringLengthToFitX(std::string_view text, uint16_t pixels)
+{
+    return f_stringLengthToFitX(text.data(), text.length(), pixels);
 }
 
+#endif // hV_HAS_STRING_VIEW
+
 void hV_Screen_Buffer::setFontSpaceX(uint8_t number)
 {
     f_setFontSpaceX(number);
 }
 
+uint8_t hV_Screen_Buffer::getFontSpaceX()
+{
+    return f_fontSpaceX;
+}
+
 void hV_Screen_Buffer::setFontSpaceY(uint8_t number)
 {
     f_setFontSpaceY(number);
@@ -597,158 +901,107 @@ void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
                              uint16_t textColour,
                              uint16_t backColour)
 {
-#if (FONT_MODE == USE_FONT_TERMINAL)
+    gText(x0, y0, text.c_str(), text.length(), textColour, backColour);
+}
 
-    uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             const char * text,
+                             uint16_t textColour,
+                             uint16_t backColour)
+{
+    gText(x0, y0, text, strlen(text), textColour, backColour);
+}
 
-#if (MAX_FONT_SIZE > 0)
+#if defined(hV_HAS_STRING_VIEW)
 
-    if (f_fontSize == 0)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             std::string_view text,
+                             uint16_t textColour,
+                             uint16_t backColour)
+{
+    gText(x0, y0, text.data(), text.length(), textColour, backColour);
+}
 
-            for (i = 0; i < 6; i++)
-            {
-                line = f_getCharacter(c, i);
+#endif // hV_HAS_STRING_VIEW
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 6 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 6 * k + i, y0 + j, backColour);
-                    }
-                }
-            }
-        }
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             const char * text, size_t length,
+                             uint16_t textColour,
+                             uint16_t backColour)
+{
+    uint16_t x = x0;
+
+    for (size_t k = 0; k < length; k += 1)
+    {
+        s_gCharacter(x, y0, (uint8_t)text[k], textColour, backColour);
+        x += f_font.maxWidth + f_fontSpaceX;
     }
+}
 
-#if (MAX_FONT_SIZE > 1)
+void hV_Screen_Buffer::gTextUTF8(uint16_t x0, uint16_t y0,
+                                 const char * text,
+                                 uint16_t textColour,
+                                 uint16_t backColour)
+{
+    uint16_t x = x0;
+    size_t length = strlen(text);
+    size_t index = 0;
+    uint8_t c;
 
-    else if (f_fontSize == 1)
+    // Characters decoded on the fly, no intermediate copy
+    while ((c = utf2isoNext(text, length, index)) != 0x00)
     {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
+        s_gCharacter(x, y0, c, textColour, backColour);
+        x += f_font.maxWidth + f_fontSpaceX;
+    }
+}
 
-            for (i = 0; i < 8; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
+void hV_Screen_Buffer::s_gCharacter(uint16_t x0, uint16_t y0,
+                                    uint8_t character,
+                                    uint16_t textColour,
+                                    uint16_t backColour)
+{
+#if (FONT_MODE == USE_FONT_TERMINAL)
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 8 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if ((f_fontSolid) and (j < 4))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
-            }
-        }
+    // Characters outside the font are skipped
+    if ((character < f_font.first) or (character - f_font.first >= f_font.number))
+    {
+        return;
+    }
+
+    // Glyph trimmed to the clip rectangle
+    int32_t left = v_viewport.x0 + (int16_t)x0;
+    int32_t top = v_viewport.y0 + (int16_t)y0;
+    int32_t i1 = hV_HAL_max(v_viewport.clip.x1 - left, 0);
+    int32_t i2 = hV_HAL_min(v_viewport.clip.x2 - left, f_font.maxWidth - 1);
+    int32_t j1 = hV_HAL_max(v_viewport.clip.y1 - top, 0);
+    int32_t j2 = hV_HAL_min(v_viewport.clip.y2 - top, f_font.height - 1);
+    if ((i1 > i2) or (j1 > j2))
+    {
+        return;
     }
 
-#if (MAX_FONT_SIZE > 2)
+    uint8_t c = character - f_font.first;
+    uint8_t rows = (f_font.height + 7) / 8; // Bytes per column
+    const uint8_t * glyph = f_getGlyph(c); // Single indexed access, or decoded through the cache
 
-    else if (f_fontSize == 2)
+    for (int32_t i = i1; i <= i2; i += 1)
     {
+        const uint8_t * column = glyph + i * rows;
 
-        for (k = 0; k < text.length(); k++)
+        for (int32_t j = j1; j <= j2; j += 1)
         {
-            c = text.charAt(k) - ' ';
-
-            for (i = 0; i < 12; i++)
+            if (bitRead(column[j >> 3], j & 0x07))
             {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
-
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
+                s_setPoint(left + i, top + j, textColour);
             }
-        }
-    }
-#if (MAX_FONT_SIZE > 3)
-
-    else if (f_fontSize == 3)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
-            for (i = 0; i < 16; i++)
+            else if (f_fontSolid)
             {
-                line = f_getCharacter(c, 3 * i);
-                line1 = f_getCharacter(c, 3 * i + 1);
-                line2 = f_getCharacter(c, 3 * i + 2);
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j, backColour);
-                    }
-                    if (bitRead(line2, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, backColour);
-                    }
-                }
+                s_setPoint(left + i, top + j, backColour);
             }
         }
     }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-#endif // end MAX_FONT_SIZE > 0
+
 #endif // FONT_MODE
 }
 
@@ -757,176 +1010,151 @@ void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
                                   uint16_t textColour,
                                   uint16_t backColour)
 {
-#if (FONT_MODE == USE_FONT_TERMINAL)
+    gTextLarge(x0, y0, text.c_str(), text.length(), textColour, backColour);
+}
 
-    uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
+void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
+                                  const char * text,
+                                  uint16_t textColour,
+                                  uint16_t backColour)
+{
+    gTextLarge(x0, y0, text, strlen(text), textColour, backColour);
+}
 
-    uint8_t ix = 2;
-    uint8_t iy = 2;
+#if defined(hV_HAS_STRING_VIEW)
 
-    bool oldPenSolid = v_penSolid;
-    setPenSolid(true);
+void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
+                                  std::string_view text,
+                                  uint16_t textColour,
+                                  uint16_t backColour)
+{
+    gTextLarge(x0, y0, text.data(), text.length(), textColour, backColour);
+}
 
-#if (MAX_FONT_SIZE > 0)
+#endif // hV_HAS_STRING_VIEW
 
-    if (f_fontSize == 0)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            x = x0 + 6 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
+                                  const char * text, size_t length,
+                                  uint16_t textColour,
+                                  uint16_t backColour)
+{
+    gTextScaled(x0, y0, text, length, 2, 2, textColour, backColour);
+}
 
-            for (i = 0; i < 6; i++)
-            {
-                line = f_getCharacter(c, i);
+void hV_Screen_Buffer::gTextScaled(uint16_t x0, uint16_t y0,
+                                   String text,
+                                   uint8_t scaleX, uint8_t scaleY,
+                                   uint16_t textColour,
+                                   uint16_t backColour)
+{
+    gTextScaled(x0, y0, text.c_str(), text.length(), scaleX, scaleY, textColour, backColour);
+}
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y + j * iy, ix, iy, backColour);
-                    }
-                }
-            }
-        }
-    }
+void hV_Screen_Buffer::gTextScaled(uint16_t x0, uint16_t y0,
+                                   const char * text,
+                                   uint8_t scaleX, uint8_t scaleY,
+                                   uint16_t textColour,
+                                   uint16_t backColour)
+{
+    gTextScaled(x0, y0, text, strlen(text), scaleX, scaleY, textColour, backColour);
+}
 
-#if (MAX_FONT_SIZE > 1)
+#if defined(hV_HAS_STRING_VIEW)
 
-    else if (f_fontSize == 1)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            x = x0 + 8 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+void hV_Screen_Buffer::gTextScaled(uint16_t x0, uint16_t y0,
+                                   std::string_view text,
+                                   uint8_t scaleX, uint8_t scaleY,
+                                   uint16_t textColour,
+                                   uint16_t backColour)
+{
+    gTextScaled(x0, y0, text.data(), text.length(), scaleX, scaleY, textColour, backColour);
+}
 
-            for (i = 0; i < 8; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
+#endif // hV_HAS_STRING_VIEW
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, textColour);
-                    }
-                    else if ((f_fontSolid) and (j < 4))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, backColour);
-                    }
-                }
-            }
-        }
-    }
+void hV_Screen_Buffer::gTextScaled(uint16_t x0, uint16_t y0,
+                                   const char * text, size_t length,
+                                   uint8_t scaleX, uint8_t scaleY,
+                                   uint16_t textColour,
+                                   uint16_t backColour)
+{
+    uint16_t x = x0;
 
-#if (MAX_FONT_SIZE > 2)
+    scaleX = hV_HAL_max(scaleX, 1);
+    scaleY = hV_HAL_max(scaleY, 1);
 
-    else if (f_fontSize == 2)
+    for (size_t k = 0; k < length; k += 1)
     {
+        s_gCharacterScaled(x, y0, (uint8_t)text[k], scaleX, scaleY, textColour, backColour);
+        x += (f_font.maxWidth + f_fontSpaceX) * scaleX;
+    }
+}
 
-        for (k = 0; k < text.length(); k++)
-        {
-            x = x0 + 12 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+void hV_Screen_Buffer::s_gCharacterScaled(uint16_t x0, uint16_t y0,
+                                          uint8_t character,
+                                          uint8_t scaleX, uint8_t scaleY,
+                                          uint16_t textColour,
+                                          uint16_t backColour)
+{
+#if (FONT_MODE == USE_FONT_TERMINAL)
 
-            for (i = 0; i < 12; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
+    // Characters outside the font are skipped
+    if ((character < f_font.first) or (character - f_font.first >= f_font.number))
+    {
+        return;
+    }
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, backColour);
-                    }
-                }
-            }
-        }
+    // Glyph outside the clip rectangle
+    int32_t left = (int16_t)x0;
+    int32_t top = (int16_t)y0;
+    if ((v_viewport.x0 + left > v_viewport.clip.x2) or (v_viewport.x0 + left + f_font.maxWidth * scaleX - 1 < v_viewport.clip.x1)
+            or (v_viewport.y0 + top > v_viewport.clip.y2) or (v_viewport.y0 + top + f_font.height * scaleY - 1 < v_viewport.clip.y1))
+    {
+        return;
     }
 
-#if (MAX_FONT_SIZE > 3)
+    uint8_t rows = (f_font.height + 7) / 8; // Bytes per column
+    const uint8_t * glyph = f_getGlyph(character - f_font.first);
 
-    else if (f_fontSize == 3)
+    uint8_t i = 0;
+    while (i < f_font.maxWidth)
     {
-        for (k = 0; k < text.length(); k++)
+        const uint8_t * column = glyph + i * rows;
+
+        // Identical columns drawn together
+        uint8_t width = 1;
+        while ((i + width < f_font.maxWidth) and (memcmp(column, column + width * rows, rows) == 0))
+        {
+            width += 1;
+        }
+
+        int32_t x1 = left + i * scaleX;
+        int32_t x2 = x1 + width * scaleX - 1;
+
+        // Vertical runs of identical pixels
+        uint8_t j = 0;
+        while (j < f_font.height)
         {
-            x = x0 + 16 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+            bool state = bitRead(column[j >> 3], j & 0x07);
+            uint8_t run = 1;
+            while ((j + run < f_font.height) and (bitRead(column[(j + run) >> 3], (j + run) & 0x07) == state))
+            {
+                run += 1;
+            }
 
-            for (i = 0; i < 16; i++)
+            if (state)
             {
-                line = f_getCharacter(c, 3 * i);
-                line1 = f_getCharacter(c, 3 * i + 1);
-                line2 = f_getCharacter(c, 3 * i + 2);
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line2, j))
-                    {
-                        dRectangle(x + i * ix, y0 + (16 + j) * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + (16 + j) * iy, ix, iy, backColour);
-                    }
-                }
+                s_clipRectangle(x1, top + j * scaleY, x2, top + (j + run) * scaleY - 1, textColour);
             }
+            else if (f_fontSolid)
+            {
+                s_clipRectangle(x1, top + j * scaleY, x2, top + (j + run) * scaleY - 1, backColour);
+            }
+            j += run;
         }
-    }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-#endif // end MAX_FONT_SIZE > 0
 
-    setPenSolid(oldPenSolid);
+        i += width;
+    }
 
 #endif // FONT_MODE
 }
@@ -57,6 +57,48 @@
 #error FONT_MODE not defined
 #endif // FONT_MODE
 
+// String view, C++17 and later
+#if defined(__has_include)
+#if __has_include(<string_view>) && (__cplusplus >= 201703L)
+#include <string_view>
+///
+/// @brief Availability of std::string_view
+///
+#define hV_HAS_STRING_VIEW
+#endif // __has_include
+#endif // __has_include
+
+///
+/// @name Bitmap formats
+/// @details One bit per pixel, 1 = front colour, 0 = back colour
+/// * Row-major: each row of the bitmap starts on a new byte
+/// * Column-major: each column of the bitmap starts on a new byte
+/// @{
+#define BITMAP_ROW_MSB 0x00 ///< Row-major, most significant bit on the left, eg. PBM
+#define BITMAP_ROW_LSB 0x01 ///< Row-major, least significant bit on the left, eg. XBM
+#define BITMAP_COLUMN_MSB 0x02 ///< Column-major, most significant bit on top
+#define BITMAP_COLUMN_LSB 0x03 ///< Column-major, least significant bit on top, eg. Terminal fonts
+/// @}
+
+///
+/// @name Viewports
+/// @{
+#define VIEWPORT_MAX 4 ///< Depth of the stack of viewports
+/// @}
+
+///
+/// @name Patterns
+/// @details 8 x 8 pixels, row 0 as most significant byte, column 0 as most significant bit
+/// @note Patterns are anchored to the screen, so adjacent areas match
+/// @{
+#define PATTERN_SOLID 0xffffffffffffffffULL ///< All pixels
+#define PATTERN_GREY_LIGHT 0x8822882288228822ULL ///< 1 pixel out of 4
+#define PATTERN_GREY_MEDIUM 0xaa55aa55aa55aa55ULL ///< 1 pixel out of 2, checker-board
+#define PATTERN_GREY_DARK 0x77dd77dd77dd77ddULL ///< 3 pixels out of 4
+#define PATTERN_HATCH 0x8040201008040201ULL ///< Diagonal lines
+#define PATTERN_CROSS 0x8142241818244281ULL ///< Crossed diagonal lines
+/// @}
+
 ///
 /// @brief Generic buffered screen class
 /// @details This class provides the text and graphic primitives for the buffered screen
@@ -197,6 +239,12 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void setPenSolid(bool flag = true);
 
+    ///
+    /// @brief Get pen opaque
+    /// @return true = opaque = solid, false = wire frame
+    ///
+    virtual bool getPenSolid();
+
     ///
     /// @brief Draw triangle, rectangle coordinates
     /// @param x1 first point coordinate, x-axis
@@ -246,6 +294,105 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void point(uint16_t x1, uint16_t y1, uint16_t colour);
 
+    ///
+    /// @brief Draw a monochrome bitmap
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width of the bitmap
+    /// @param dy height of the bitmap
+    /// @param bitmap bitmap, one bit per pixel
+    /// @param stride number of bytes per row or per column, default = 0 = deduced from dx or dy
+    /// @param frontColour 16-bit colour for bits set, default = black
+    /// @param backColour 16-bit colour for bits cleared, default = white
+    /// @param flagTransparent true = bits cleared not drawn, default = false
+    /// @param format BITMAP_ROW_MSB, BITMAP_ROW_LSB, BITMAP_COLUMN_MSB or BITMAP_COLUMN_LSB, default = BITMAP_ROW_MSB
+    /// @note Same result as drawing each pixel with point()
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                            const uint8_t * bitmap, uint16_t stride = 0,
+                            uint16_t frontColour = myColours.black, uint16_t backColour = myColours.white,
+                            bool flagTransparent = false, uint8_t format = BITMAP_ROW_MSB);
+
+    ///
+    /// @brief Best format for drawBitmap()
+    /// @return BITMAP_ROW_MSB or BITMAP_COLUMN_MSB, default = BITMAP_ROW_MSB
+    /// @note Bitmaps with this format are drawn faster, as for the current orientation they follow the frame-buffer
+    ///
+    virtual uint8_t bitmapFormat();
+
+    ///
+    /// @brief Fill a rectangle with a pattern
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param pattern 8 x 8 pattern, eg. PATTERN_GREY_LIGHT
+    /// @param frontColour 16-bit colour for bits set, default = black
+    /// @param backColour 16-bit colour for bits cleared, default = white
+    /// @param flagTransparent true = bits cleared not drawn, default = false
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void patternRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                  uint64_t pattern, uint16_t frontColour = myColours.black, uint16_t backColour = myColours.white,
+                                  bool flagTransparent = false);
+
+    ///
+    /// @brief Invert the pixels of a rectangle
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param pattern pixels to invert, default = PATTERN_SOLID = all
+    /// @note Requires a screen with access to the frame-buffer, otherwise does nothing
+    ///
+    /// @n @b More: @ref Coordinate
+    ///
+    virtual void invertRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint64_t pattern = PATTERN_SOLID);
+
+    /// @}
+
+    /// @name Clip and viewports
+    /// @details Coordinates of the graphic and text primitives are relative to the origin of the current viewport.
+    /// Lines, spans, glyphs and bitmaps are trimmed to the clip rectangle before drawing.
+    /// @note setOrientation() resets the viewports and the clip rectangle to the full screen
+    /// @{
+
+    ///
+    /// @brief Set the clip rectangle
+    /// @param x0 top left coordinate, x-axis, relative to the viewport
+    /// @param y0 top left coordinate, y-axis, relative to the viewport
+    /// @param dx width
+    /// @param dy height
+    /// @note Clip rectangle limited to the current viewport
+    ///
+    virtual void setClip(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Reset the clip rectangle to the current viewport
+    ///
+    virtual void resetClip();
+
+    ///
+    /// @brief Open a viewport
+    /// @param x0 origin of the viewport, x-axis, relative to the current viewport
+    /// @param y0 origin of the viewport, y-axis, relative to the current viewport
+    /// @param dx width
+    /// @param dy height
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The viewport is limited to the current clip rectangle, which is restored by popViewport()
+    /// @note Up to VIEWPORT_MAX viewports
+    ///
+    virtual bool pushViewport(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Close the current viewport
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    ///
+    virtual bool popViewport();
+
     /// @}
 
     /// @name Text
@@ -266,7 +413,7 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     /// @brief Add a font
     /// @param fontName name of the font
-    /// @return number of the font, 0 otherwise
+    /// @return number of the font, FONT_ERROR = 0xff otherwise
     /// @note Previously selectFont()
     /// @n @b More: @ref Fonts
     ///
@@ -281,12 +428,20 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     /// @brief Set additional spaces between two characters, horizontal axis
     /// @param number of spaces default = 1 pixel
+    /// @note Initial value is 1, used by text functions and measures, 0 for the glyphs side by side
     ///
     virtual void setFontSpaceX(uint8_t number = 1);
 
+    ///
+    /// @brief Get additional spaces between two characters, horizontal axis
+    /// @return number of spaces, in pixels
+    ///
+    virtual uint8_t getFontSpaceX();
+
     ///
     /// @brief Set additional spaces between two characters, vertical axis
     /// @param number of spaces default = 1 pixel
+    /// @note Initial value is 0, used between lines by hV_Text_Layout
     ///
     virtual void setFontSpaceY(uint8_t number = 1);
 
@@ -305,6 +460,7 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     /// @brief Character size, y-axis
     /// @return vertical size for current font, in pixels
+    /// @note With setSpaceY included
     /// @note Previously fontSizeY()
     /// @n @b More: @ref Fonts
     ///
@@ -318,6 +474,35 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual uint16_t stringSizeX(String text);
 
+    ///
+    /// @brief String size, x-axis
+    /// @param text null-terminated string to evaluate
+    /// @return horizontal size of the string for current font, in pixels
+    /// @note No memory allocation
+    ///
+    virtual uint16_t stringSizeX(const char * text);
+
+    ///
+    /// @brief String size, x-axis
+    /// @param text characters to evaluate
+    /// @param length number of characters
+    /// @return horizontal size of the string for current font, in pixels
+    /// @note No memory allocation
+    ///
+    virtual uint16_t stringSizeX(const char * text, size_t length);
+
+#if defined(hV_HAS_STRING_VIEW)
+
+    ///
+    /// @brief String size, x-axis
+    /// @param text string view to evaluate
+    /// @return horizontal size of the string for current font, in pixels
+    /// @note No memory allocation
+    ///
+    virtual uint16_t stringSizeX(std::string_view text);
+
+#endif // hV_HAS_STRING_VIEW
+
     ///
     /// @brief Number of characters to fit a size, x-axis
     /// @param text string to evaluate
@@ -327,6 +512,38 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual uint8_t stringLengthToFitX(String text, uint16_t pixels);
 
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text null-terminated string to evaluate
+    /// @param pixels number of pixels to fit in
+    /// @return number of characters to be displayed inside the pixels
+    /// @note No memory allocation
+    ///
+    virtual uint8_t stringLengthToFitX(const char * text, uint16_t pixels);
+
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text characters to evaluate
+    /// @param length number of characters
+    /// @param pixels number of pixels to fit in
+    /// @return number of characters to be displayed inside the pixels
+    /// @note No memory allocation
+    ///
+    virtual uint8_t stringLengthToFitX(const char * text, size_t length, uint16_t pixels);
+
+#if defined(hV_HAS_STRING_VIEW)
+
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text string view to evaluate
+    /// @param pixels number of pixels to fit in
+    /// @return number of characters to be displayed inside the pixels
+    /// @note No memory allocation
+    ///
+    virtual uint8_t stringLengthToFitX(std::string_view text, uint16_t pixels);
+
+#endif // hV_HAS_STRING_VIEW
+
     ///
     /// @brief Number of fonts
     /// @return number of fonts available
@@ -351,6 +568,69 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
                        uint16_t textColour = myColours.black,
                        uint16_t backColour = myColours.white);
 
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with selection of size, null-terminated string
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text null-terminated string
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No memory allocation
+    ///
+    virtual void gText(uint16_t x0, uint16_t y0,
+                       const char * text,
+                       uint16_t textColour = myColours.black,
+                       uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with selection of size, characters and length
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text characters
+    /// @param length number of characters
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @note No memory allocation
+    /// @note All parameters are required, to avoid ambiguity with the other variants
+    ///
+    virtual void gText(uint16_t x0, uint16_t y0,
+                       const char * text, size_t length,
+                       uint16_t textColour,
+                       uint16_t backColour);
+
+#if defined(hV_HAS_STRING_VIEW)
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with selection of size, string view
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text string view
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No memory allocation
+    ///
+    virtual void gText(uint16_t x0, uint16_t y0,
+                       std::string_view text,
+                       uint16_t textColour = myColours.black,
+                       uint16_t backColour = myColours.white);
+
+#endif // hV_HAS_STRING_VIEW
+
+    ///
+    /// @brief Draw UTF-8 Text (pixel coordinates)
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text UTF-8 null-terminated string
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note Characters are converted to ISO-8859-1 on the fly, with no intermediate copy
+    /// @see utf2isoNext()
+    ///
+    virtual void gTextUTF8(uint16_t x0, uint16_t y0,
+                           const char * text,
+                           uint16_t textColour = myColours.black,
+                           uint16_t backColour = myColours.white);
+
     ///
     /// @brief Draw ASCII Text (pixel coordinates) with selection of size
     /// @param x0 point coordinate, x-axis
@@ -366,6 +646,131 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
                             String text,
                             uint16_t textColour = myColours.black,
                             uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with selection of size, null-terminated string
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text null-terminated string
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No memory allocation
+    ///
+    virtual void gTextLarge(uint16_t x0, uint16_t y0,
+                            const char * text,
+                            uint16_t textColour = myColours.black,
+                            uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with selection of size, characters and length
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text characters
+    /// @param length number of characters
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @note No memory allocation
+    /// @note All parameters are required, to avoid ambiguity with the other variants
+    ///
+    virtual void gTextLarge(uint16_t x0, uint16_t y0,
+                            const char * text, size_t length,
+                            uint16_t textColour,
+                            uint16_t backColour);
+
+#if defined(hV_HAS_STRING_VIEW)
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with selection of size, string view
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text string view
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No memory allocation
+    ///
+    virtual void gTextLarge(uint16_t x0, uint16_t y0,
+                            std::string_view text,
+                            uint16_t textColour = myColours.black,
+                            uint16_t backColour = myColours.white);
+
+#endif // hV_HAS_STRING_VIEW
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) scaled by integer factors
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text text string
+    /// @param scaleX scale factor, x-axis, 1..
+    /// @param scaleY scale factor, y-axis, 1..
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note Each column of the glyph is drawn as vertical runs, each run as a filled rectangle
+    /// @note The pen state is not modified
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    virtual void gTextScaled(uint16_t x0, uint16_t y0,
+                             String text,
+                             uint8_t scaleX, uint8_t scaleY,
+                             uint16_t textColour = myColours.black,
+                             uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) scaled by integer factors, null-terminated string
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text null-terminated string
+    /// @param scaleX scale factor, x-axis, 1..
+    /// @param scaleY scale factor, y-axis, 1..
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No memory allocation
+    ///
+    virtual void gTextScaled(uint16_t x0, uint16_t y0,
+                             const char * text,
+                             uint8_t scaleX, uint8_t scaleY,
+                             uint16_t textColour = myColours.black,
+                             uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) scaled by integer factors, characters and length
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text characters
+    /// @param length number of characters
+    /// @param scaleX scale factor, x-axis, 1..
+    /// @param scaleY scale factor, y-axis, 1..
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @note No memory allocation
+    /// @note All parameters are required, to avoid ambiguity with the other variants
+    ///
+    virtual void gTextScaled(uint16_t x0, uint16_t y0,
+                             const char * text, size_t length,
+                             uint8_t scaleX, uint8_t scaleY,
+                             uint16_t textColour,
+                             uint16_t backColour);
+
+#if defined(hV_HAS_STRING_VIEW)
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) scaled by integer factors, string view
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text string view
+    /// @param scaleX scale factor, x-axis, 1..
+    /// @param scaleY scale factor, y-axis, 1..
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No memory allocation
+    ///
+    virtual void gTextScaled(uint16_t x0, uint16_t y0,
+                             std::string_view text,
+                             uint8_t scaleX, uint8_t scaleY,
+                             uint16_t textColour = myColours.black,
+                             uint16_t backColour = myColours.white);
+
+#endif // hV_HAS_STRING_VIEW
     /// @}
 
     //
@@ -405,6 +810,113 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour) = 0; // compulsory
 
+    ///
+    /// @brief Fill a rectangle
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note x1 <= x2 and y1 <= y2, logical coordinates
+    /// @note Default is point by point, screens may provide a faster implementation
+    ///
+    virtual void s_fillRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Draw a monochrome bitmap
+    /// @note Same parameters as drawBitmap(), screen coordinates, with stride provided
+    /// @note offset is the first bit of each row or column, for bitmaps trimmed by the clip rectangle
+    /// @note Default is point by point, screens may provide a faster implementation
+    ///
+    virtual void s_drawBitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                              const uint8_t * bitmap, uint16_t stride, uint16_t offset,
+                              uint16_t frontColour, uint16_t backColour,
+                              bool flagTransparent, uint8_t format);
+
+    ///
+    /// @brief Fill a rectangle with a pattern
+    /// @note Same parameters as patternRectangle(), screen coordinates
+    /// @note x1 <= x2 and y1 <= y2, logical coordinates
+    /// @note Default is point by point, screens may provide a faster implementation
+    ///
+    virtual void s_fillPattern(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                               uint64_t pattern, uint16_t frontColour, uint16_t backColour,
+                               bool flagTransparent);
+
+    ///
+    /// @brief Get point
+    /// @param x1 x coordinate
+    /// @param y1 y coordinate
+    /// @return colour 16-bit colour
+    /// @note Only called when v_flagRead is true
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual uint16_t s_getPoint(uint16_t x1, uint16_t y1);
+
+    ///
+    /// @brief Invert the pixels of a rectangle
+    /// @note Same parameters as invertRectangle(), screen coordinates
+    /// @note Default is point by point with s_getPoint() and s_setPoint(),
+    /// only if the screen reads its frame-buffer, v_flagRead = true, otherwise does nothing
+    ///
+    virtual void s_invertRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint64_t pattern);
+
+    // Clip and viewports
+    ///
+    /// @brief Rectangle, inclusive, empty if x1 > x2 or y1 > y2
+    ///
+    struct clip_s
+    {
+        int16_t x1; ///< top left coordinate, x-axis
+        int16_t y1; ///< top left coordinate, y-axis
+        int16_t x2; ///< bottom right coordinate, x-axis
+        int16_t y2; ///< bottom right coordinate, y-axis
+    };
+
+    ///
+    /// @brief Viewport, screen coordinates
+    ///
+    struct viewport_s
+    {
+        int16_t x0; ///< origin, x-axis
+        int16_t y0; ///< origin, y-axis
+        clip_s area; ///< bounds of the viewport
+        clip_s clip; ///< clip rectangle, within the bounds
+    };
+
+    ///
+    /// @brief Reset the viewports and the clip rectangle to the full screen
+    ///
+    void s_resetViewport();
+
+    ///
+    /// @brief Draw a point within the clip rectangle
+    /// @param x1 point coordinate, x-axis, relative to the viewport
+    /// @param y1 point coordinate, y-axis, relative to the viewport
+    /// @param colour 16-bit colour
+    ///
+    void s_clipPoint(int32_t x1, int32_t y1, uint16_t colour);
+
+    ///
+    /// @brief Fill a rectangle trimmed to the clip rectangle
+    /// @param x1 first corner, x-axis, relative to the viewport
+    /// @param y1 first corner, y-axis, relative to the viewport
+    /// @param x2 opposite corner, x-axis, relative to the viewport
+    /// @param y2 opposite corner, y-axis, relative to the viewport
+    /// @param colour 16-bit colour
+    ///
+    void s_clipRectangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t colour);
+
+    ///
+    /// @brief Trim a rectangle to the clip rectangle
+    /// @param[in,out] x1 first corner, x-axis, relative to the viewport, then top left, screen coordinates
+    /// @param[in,out] y1 first corner, y-axis, relative to the viewport, then top left, screen coordinates
+    /// @param[in,out] x2 opposite corner, x-axis, relative to the viewport, then bottom right, screen coordinates
+    /// @param[in,out] y2 opposite corner, y-axis, relative to the viewport, then bottom right, screen coordinates
+    /// @return RESULT_SUCCESS = false = area not empty, RESULT_ERROR = true = area empty
+    ///
+    bool s_clipArea(int32_t & x1, int32_t & y1, int32_t & x2, int32_t & y2);
+
     // Write and Read
 
     // Other functions
@@ -430,6 +942,28 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     uint8_t s_getCharacter(uint8_t character, uint8_t index);
 
+    ///
+    /// @brief Draw one character with the current font
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param character character 32~255
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    ///
+    void s_gCharacter(uint16_t x0, uint16_t y0, uint8_t character, uint16_t textColour, uint16_t backColour);
+
+    ///
+    /// @brief Draw one character with the current font, scaled
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param character character 32~255
+    /// @param scaleX scale factor, x-axis
+    /// @param scaleY scale factor, y-axis
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    ///
+    void s_gCharacterScaled(uint16_t x0, uint16_t y0, uint8_t character, uint8_t scaleX, uint8_t scaleY, uint16_t textColour, uint16_t backColour);
+
     uint8_t * s_newImage;
 
     // Variables provided by hV_Screen_Virtual
@@ -437,6 +971,9 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     uint16_t v_screenSizeH, v_screenSizeV, v_screenDiagonal, v_screenMarginH, v_screenMarginV;
     uint8_t v_orientation, v_intensity;
     uint16_t v_screenColourBits;
+    viewport_s v_viewport;
+    viewport_s v_viewports[VIEWPORT_MAX];
+    uint8_t v_viewportNumber;
 
     //
     // === Touch section
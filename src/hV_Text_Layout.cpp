@@ -0,0 +1,272 @@
+//
+// hV_Text_Layout.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See hV_Text_Layout.h for references
+//
+// Release 821: Initial release
+//
+
+// Library header
+#include "hV_Text_Layout.h"
+
+// Code
+hV_Text_Layout::hV_Text_Layout()
+{
+    l_lines = 0; // nullptr
+    l_size = 0;
+    l_number = 0;
+    l_options = LAYOUT_LEFT;
+    l_area = { 0, 0, 0, 0 };
+    l_valid = false;
+    l_cached = false;
+    l_overflow = false;
+}
+
+void hV_Text_Layout::begin(layoutLine_s * lines, uint8_t number)
+{
+    l_lines = lines;
+    l_size = number;
+    l_number = 0;
+    l_valid = false;
+}
+
+void hV_Text_Layout::setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    l_area.x1 = x0;
+    l_area.y1 = y0;
+    l_area.x2 = x0 + hV_HAL_max(dx, 1) - 1;
+    l_area.y2 = y0 + hV_HAL_max(dy, 1) - 1;
+}
+
+void hV_Text_Layout::setOptions(uint8_t options)
+{
+    l_options = options;
+}
+
+uint8_t hV_Text_Layout::layout(hV_Screen_Buffer * screen, STRING_CONST_TYPE text)
+{
+    return layout(screen, text.c_str(), text.length());
+}
+
+uint8_t hV_Text_Layout::layout(hV_Screen_Buffer * screen, const char * text)
+{
+    return layout(screen, text, strlen(text));
+}
+
+uint8_t hV_Text_Layout::layout(hV_Screen_Buffer * screen, const char * text, size_t length)
+{
+    length = hV_HAL_min(length, 0xffff);
+
+    key_s key;
+    memset(&key, 0x00, sizeof(key_s)); // Padding included in comparison
+    key.hash = hashString(text, length);
+    key.length = length;
+    key.font = screen->getFont();
+    key.options = l_options;
+    key.pitchX = screen->characterSizeX();
+    key.pitchY = screen->characterSizeY();
+    key.area = l_area;
+
+    // Same text, font and box as previous call
+    l_cached = l_valid and (memcmp(&key, &l_key, sizeof(key_s)) == 0);
+    if (l_cached)
+    {
+        return l_number;
+    }
+
+    l_key = key;
+    l_valid = true;
+    l_number = 0;
+    l_overflow = false;
+
+    if ((l_lines == 0) or (key.pitchX == 0) or (key.pitchY == 0))
+    {
+        return 0;
+    }
+
+    uint16_t dx = l_area.x2 - l_area.x1 + 1;
+    uint16_t dy = l_area.y2 - l_area.y1 + 1;
+    uint8_t fit = hV_HAL_min(dx / key.pitchX, 255); // Characters per line
+    uint8_t lines = hV_HAL_min(hV_HAL_max(dy / key.pitchY, 1), l_size); // Lines per box
+
+    if (fit == 0)
+    {
+        l_overflow = (length > 0);
+        return 0;
+    }
+
+    size_t position = 0;
+    while ((position < length) and (l_number < lines))
+    {
+        // End of paragraph
+        size_t end = position;
+        while ((end < length) and (text[end] != '\n'))
+        {
+            end += 1;
+        }
+
+        size_t next;
+        size_t cut;
+        if (end - position > fit)
+        {
+            // Break at the last space within the line, otherwise within the word
+            size_t space = position + fit;
+            while ((space > position) and (text[space] != ' '))
+            {
+                space -= 1;
+            }
+
+            if (space > position)
+            {
+                cut = space - position;
+                next = space + 1;
+            }
+            else
+            {
+                cut = fit;
+                next = position + fit;
+            }
+
+            // Spaces at the beginning of the next line removed
+            while ((next < end) and (text[next] == ' '))
+            {
+                next += 1;
+            }
+            if (next == end)
+            {
+                next = end + 1;
+            }
+        }
+        else
+        {
+            cut = end - position;
+            next = end + 1;
+        }
+
+        // Spaces at the end of the line removed
+        while ((cut > 0) and (text[position + cut - 1] == ' '))
+        {
+            cut -= 1;
+        }
+
+        layoutLine_s & line = l_lines[l_number];
+        line.offset = position;
+        line.length = cut;
+        line.ellipsis = false;
+        line.y = l_area.y1 + l_number * key.pitchY;
+        l_number += 1;
+
+        position = next;
+    }
+
+    // Text left
+    l_overflow = (position < length);
+    if (l_overflow and (l_number > 0) and ((l_options & LAYOUT_ELLIPSIS) == LAYOUT_ELLIPSIS))
+    {
+        layoutLine_s & line = l_lines[l_number - 1];
+        uint8_t room = (fit > 3) ? fit - 3 : 0;
+
+        line.length = hV_HAL_min(line.length, room);
+        while ((line.length > 0) and (text[line.offset + line.length - 1] == ' '))
+        {
+            line.length -= 1;
+        }
+        line.ellipsis = (fit >= 3);
+    }
+
+    for (uint8_t index = 0; index < l_number; index += 1)
+    {
+        l_align(l_lines[index]);
+    }
+
+    return l_number;
+}
+
+void hV_Text_Layout::l_align(layoutLine_s & line)
+{
+    uint16_t dx = l_area.x2 - l_area.x1 + 1;
+    uint16_t width = (line.length + (line.ellipsis ? 3 : 0)) * l_key.pitchX;
+    uint16_t margin = (dx > width) ? dx - width : 0;
+
+    switch (l_options & 0x03)
+    {
+        case LAYOUT_CENTRE:
+
+            line.x = l_area.x1 + margin / 2;
+            break;
+
+        case LAYOUT_RIGHT:
+
+            line.x = l_area.x1 + margin;
+            break;
+
+        default:
+
+            line.x = l_area.x1;
+            break;
+    }
+}
+
+void hV_Text_Layout::draw(hV_Screen_Buffer * screen, STRING_CONST_TYPE text, uint16_t textColour, uint16_t backColour)
+{
+    draw(screen, text.c_str(), textColour, backColour);
+}
+
+void hV_Text_Layout::draw(hV_Screen_Buffer * screen, const char * text, uint16_t textColour, uint16_t backColour)
+{
+    for (uint8_t index = 0; index < l_number; index += 1)
+    {
+        layoutLine_s & line = l_lines[index];
+
+        screen->gText(line.x, line.y, text + line.offset, line.length, textColour, backColour);
+        if (line.ellipsis)
+        {
+            screen->gText(line.x + line.length * l_key.pitchX, line.y, "...", 3, textColour, backColour);
+        }
+    }
+}
+
+uint8_t hV_Text_Layout::getNumber()
+{
+    return l_number;
+}
+
+layoutLine_s hV_Text_Layout::getLine(uint8_t index)
+{
+    if (index >= l_number)
+    {
+        return { 0, 0, 0, 0, false };
+    }
+    return l_lines[index];
+}
+
+uint16_t hV_Text_Layout::getPitchX()
+{
+    return l_key.pitchX;
+}
+
+uint16_t hV_Text_Layout::getPitchY()
+{
+    return l_key.pitchY;
+}
+
+bool hV_Text_Layout::getOverflow()
+{
+    return l_overflow;
+}
+
+bool hV_Text_Layout::isCached()
+{
+    return l_cached;
+}
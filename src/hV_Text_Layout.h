@@ -0,0 +1,246 @@
+///
+/// @file hV_Text_Layout.h
+/// @brief Text layout with word wrap, alignment and ellipsis
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The layout breaks a text into lines at word boundaries for the width of a box,
+/// aligns each line and truncates the last line with an ellipsis when the text does not fit.
+/// The result is kept with a hash of the text, so a layout of the same text is not computed again.
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+// Checks
+#if (hV_SCREEN_BUFFER_RELEASE < 812)
+#error Required hV_SCREEN_BUFFER_RELEASE 812
+#endif // hV_SCREEN_BUFFER_RELEASE
+
+#ifndef hV_TEXT_LAYOUT_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_TEXT_LAYOUT_RELEASE 821
+
+///
+/// @name Layout options
+/// @note Alignment and ellipsis are combined with or, eg. LAYOUT_CENTRE | LAYOUT_ELLIPSIS
+/// @{
+#define LAYOUT_LEFT 0x00 ///< Lines aligned to the left of the box
+#define LAYOUT_CENTRE 0x01 ///< Lines centred in the box
+#define LAYOUT_RIGHT 0x02 ///< Lines aligned to the right of the box
+#define LAYOUT_ELLIPSIS 0x10 ///< Last line truncated with ... if the text does not fit
+/// @}
+
+///
+/// @brief Line of a layout
+///
+struct layoutLine_s
+{
+    uint16_t x; ///< position of the first glyph, x-axis
+    uint16_t y; ///< position of the first glyph, y-axis
+    uint16_t offset; ///< first character of the line in the text
+    uint8_t length; ///< number of characters of the line
+    bool ellipsis; ///< line followed by ...
+};
+
+// Objects
+//
+///
+/// @brief Class for text layout
+/// @details The lines are stored into an array provided by the caller.
+/// @note No memory is allocated by the layout.
+/// @note Glyph k of a line is at x + k * getPitchX(), so each line is drawn by a single gText()
+///
+/// @code {.cpp}
+/// layoutLine_s linesLayout[4];
+/// hV_Text_Layout myLayout;
+///
+/// myLayout.begin(linesLayout, 4);
+/// myLayout.setArea(10, 10, 120, 60);
+/// myLayout.setOptions(LAYOUT_CENTRE | LAYOUT_ELLIPSIS);
+///
+/// myScreen.selectFont(Font_Terminal8x12);
+/// myLayout.layout(&myScreen, text);
+/// myLayout.draw(&myScreen, text);
+/// myScreen.flush();
+/// @endcode
+///
+class hV_Text_Layout
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Text_Layout();
+
+    ///
+    /// @brief Initialisation
+    /// @param lines array of lines provided by the caller
+    /// @param number size of the array
+    ///
+    void begin(layoutLine_s * lines, uint8_t number);
+
+    ///
+    /// @brief Define the box
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width
+    /// @param dy height
+    ///
+    void setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Define the options
+    /// @param options alignment and ellipsis, default = LAYOUT_LEFT
+    ///
+    void setOptions(uint8_t options = LAYOUT_LEFT);
+
+    ///
+    /// @brief Break the text into lines with the selected font of the screen
+    /// @param screen screen, for the font
+    /// @param text text string
+    /// @return number of lines
+    /// @note Lines are broken at spaces and at '\n'. Words longer than a line are broken.
+    /// @note Lines are separated by characterSizeY(), with setFontSpaceY() included
+    ///
+    uint8_t layout(hV_Screen_Buffer * screen, STRING_CONST_TYPE text);
+
+    ///
+    /// @brief Break the text into lines, null-terminated string
+    /// @param screen screen, for the font
+    /// @param text null-terminated string
+    /// @return number of lines
+    ///
+    uint8_t layout(hV_Screen_Buffer * screen, const char * text);
+
+    ///
+    /// @brief Break the text into lines, characters and length
+    /// @param screen screen, for the font
+    /// @param text characters
+    /// @param length number of characters
+    /// @return number of lines
+    /// @note If the text, the font and the box are the same as for the previous call, the previous lines are kept
+    ///
+    uint8_t layout(hV_Screen_Buffer * screen, const char * text, size_t length);
+
+    ///
+    /// @brief Draw the lines
+    /// @param screen target screen
+    /// @param text same text as for layout()
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    ///
+    void draw(hV_Screen_Buffer * screen, STRING_CONST_TYPE text, uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw the lines, characters
+    /// @param screen target screen
+    /// @param text same text as for layout()
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    ///
+    void draw(hV_Screen_Buffer * screen, const char * text, uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Get the number of lines
+    /// @return number of lines of the latest layout
+    ///
+    uint8_t getNumber();
+
+    ///
+    /// @brief Get a line
+    /// @param index line number, 0..getNumber()-1
+    /// @return line
+    ///
+    layoutLine_s getLine(uint8_t index);
+
+    ///
+    /// @brief Distance between two glyphs, x-axis
+    /// @return pixels
+    ///
+    uint16_t getPitchX();
+
+    ///
+    /// @brief Distance between two lines, y-axis
+    /// @return pixels
+    ///
+    uint16_t getPitchY();
+
+    ///
+    /// @brief Check whether the text was truncated
+    /// @return true if the text does not fit in the box
+    ///
+    bool getOverflow();
+
+    ///
+    /// @brief Check whether the latest layout was taken from the cache
+    /// @return true if the lines were kept from the previous call
+    ///
+    bool isCached();
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Key of a layout
+    ///
+    struct key_s
+    {
+        uint32_t hash; ///< hash of the text
+        uint16_t length; ///< length of the text
+        uint8_t font; ///< selected font
+        uint8_t options; ///< alignment and ellipsis
+        uint16_t pitchX; ///< distance between two glyphs, x-axis
+        uint16_t pitchY; ///< distance between two lines, y-axis
+        area_s area; ///< box
+    };
+
+    void l_align(layoutLine_s & line);
+
+    layoutLine_s * l_lines;
+    uint8_t l_size;
+    uint8_t l_number;
+    uint8_t l_options;
+    area_s l_area;
+    key_s l_key;
+    bool l_valid, l_cached, l_overflow;
+
+    /// @endcond
+};
+
+#endif // hV_TEXT_LAYOUT_RELEASE
@@ -0,0 +1,90 @@
+//
+// hV_Transpose.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See hV_Transpose.h for references
+//
+// Release 821: Initial release
+//
+
+// Library header
+#include "hV_Transpose.h"
+
+#if (TRANSPOSE_MODE == TRANSPOSE_SSE2)
+#include <emmintrin.h>
+#elif (TRANSPOSE_MODE == TRANSPOSE_NEON)
+#include <arm_neon.h>
+#endif // TRANSPOSE_MODE
+
+// Code
+uint64_t transpose8x8(uint64_t value)
+{
+    uint64_t t;
+
+    // Exchange 1x1, 2x2 then 4x4 blocks across the diagonal
+    t = (value ^ (value >> 7)) & 0x00aa00aa00aa00aaULL;
+    value = value ^ t ^ (t << 7);
+    t = (value ^ (value >> 14)) & 0x0000cccc0000ccccULL;
+    value = value ^ t ^ (t << 14);
+    t = (value ^ (value >> 28)) & 0x00000000f0f0f0f0ULL;
+    value = value ^ t ^ (t << 28);
+
+    return value;
+}
+
+void transpose8x8(const uint8_t * source, size_t strideSource, uint8_t * destination, size_t strideDestination)
+{
+    uint64_t value = 0;
+
+    // Row 0 as most significant byte
+    for (uint8_t row = 0; row < 8; row += 1)
+    {
+        value = (value << 8) | source[row * strideSource];
+    }
+
+#if (TRANSPOSE_MODE == TRANSPOSE_SSE2)
+
+    // Byte i = row 7 - i, so the mask of the most significant bits has row 0 as bit 7
+    __m128i work = _mm_cvtsi64_si128((long long)value);
+
+    for (uint8_t column = 0; column < 8; column += 1)
+    {
+        destination[column * strideDestination] = (uint8_t)_mm_movemask_epi8(work);
+        work = _mm_slli_epi64(work, 1);
+    }
+
+#elif (TRANSPOSE_MODE == TRANSPOSE_NEON)
+
+    // Lane i = row 7 - i, shifted to bit i
+    static const int8_t weights[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const int8x8_t shift = vld1_s8(weights);
+    uint8x8_t work = vcreate_u8(value);
+
+    for (uint8_t column = 0; column < 8; column += 1)
+    {
+        destination[column * strideDestination] = vaddv_u8(vshl_u8(vshr_n_u8(work, 7), shift));
+        work = vshl_n_u8(work, 1);
+    }
+
+#else
+
+    value = transpose8x8(value);
+
+    // Column 0 as most significant byte
+    for (uint8_t column = 0; column < 8; column += 1)
+    {
+        destination[column * strideDestination] = (uint8_t)(value >> (56 - 8 * column));
+    }
+
+#endif // TRANSPOSE_MODE
+}
@@ -0,0 +1,91 @@
+///
+/// @file hV_Transpose.h
+/// @brief Transpose of 8x8 bit matrices
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The frame-buffer packs 8 pixels of a line per byte, while row-major images pack 8 pixels of a row per byte.
+/// Converting between both requires to transpose blocks of 8 x 8 bits.
+///
+/// @n Implementations
+/// * Portable: 64-bit SWAR, three exchange stages
+/// * Host with SSE2: eight byte masks
+/// * Host with NEON, AArch64: eight lane sums
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef hV_TRANSPOSE_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_TRANSPOSE_RELEASE 821
+
+///
+/// @name Implementation of the transpose
+/// @note Selected at compilation, TRANSPOSE_MODE may be defined before to force the portable version
+/// @{
+#define TRANSPOSE_SWAR 0 ///< Portable, 64-bit SWAR
+#define TRANSPOSE_SSE2 1 ///< x86 with SSE2
+#define TRANSPOSE_NEON 2 ///< AArch64 with NEON
+
+#ifndef TRANSPOSE_MODE
+#if defined(__SSE2__) && defined(__x86_64__)
+#define TRANSPOSE_MODE TRANSPOSE_SSE2 ///< Selected option
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define TRANSPOSE_MODE TRANSPOSE_NEON ///< Selected option
+#else
+#define TRANSPOSE_MODE TRANSPOSE_SWAR ///< Selected option
+#endif // __SSE2__
+#endif // TRANSPOSE_MODE
+/// @}
+
+///
+/// @brief Transpose a 8x8 bit matrix, portable version
+/// @param value 8 rows, row 0 as most significant byte, column 0 as most significant bit
+/// @return 8 columns, column 0 as most significant byte, row 0 as most significant bit
+/// @note Bit (r, c) moves to bit (c, r)
+///
+uint64_t transpose8x8(uint64_t value);
+
+///
+/// @brief Transpose a 8x8 bit matrix between two buffers
+/// @param source first row of the source, 8 rows of 1 byte
+/// @param strideSource bytes between two rows of the source
+/// @param[out] destination first row of the destination, 8 rows of 1 byte
+/// @param strideDestination bytes between two rows of the destination
+/// @note Most significant bit is the first pixel, for both source and destination
+/// @note Uses the implementation selected by TRANSPOSE_MODE
+///
+void transpose8x8(const uint8_t * source, size_t strideSource, uint8_t * destination, size_t strideDestination);
+
+#endif // hV_TRANSPOSE_RELEASE
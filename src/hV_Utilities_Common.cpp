@@ -16,6 +16,10 @@
 //
 // Release 700: Refactored screen and board functions
 // Release 803: Added types for string and frame-buffer
+// Release 821: Added reentrant functions with caller buffer
+// Release 821: Added hash of string
+// Release 821: Added reverse of bits
+// Release 821: Fixed trimString() for text with spaces only
 //
 
 // Library header
@@ -29,31 +33,54 @@ void delay_ms(uint32_t ms)
     while (millis() < chrono);
 }
 
-char bufferIn[128];
-char bufferOut[128];
-
 // Code
 // Utilities
 
 STRING_TYPE formatString(const char * format, ...)
 {
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
+    char work[128]; // Local, for reentrancy
     va_list args;
+
     va_start(args, format);
-    vsnprintf(bufferOut, 127, format, args);
+    int length = vsnprintf(work, sizeof(work), format, args);
     va_end(args);
 
-    return String(bufferOut);
+    if (length < 0)
+    {
+        work[0] = 0x00;
+    }
+
+    // Truncated to 127 characters, no allocation other than the String
+    return String(work);
+}
+
+size_t formatBuffer(char * buffer, size_t size, const char * format, ...)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, size, format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        buffer[0] = 0x00;
+        return 0;
+    }
+    return length;
 }
 
 STRING_TYPE trimString(STRING_TYPE text)
 {
     String work = "";
     bool flag = true;
-    char c;
 
     uint8_t index;
-    uint8_t start, end;
+    uint8_t start = 0, end = 0; // Empty if only spaces
 
     // Upwards from start
     index = 0;
@@ -157,42 +184,124 @@ int32_t sin32x100(int32_t degreesX100)
     return cos32x100(degreesX100 + 27000);
 }
 
-STRING_TYPE utf2iso(STRING_TYPE s)
+uint8_t utf2isoNext(const char * text, size_t length, size_t & index)
 {
-    uint8_t c;
-
-    s.toCharArray(bufferIn, s.length() + 1);
-    // strcpy(bufferIn, s.c_str());
-
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
-
-    for (uint8_t i = 0; i < strlen(bufferIn); i++)
+    while (index < length)
     {
-        c = (uint8_t)bufferIn[i];
+        uint8_t c = (uint8_t)text[index];
+        uint32_t code = 0;
+        uint8_t extra = 0;
 
+        // Leading byte
         if (c < 0x80)
         {
-            bufferOut[strlen(bufferOut)] = c;
+            index += 1;
+            return c;
+        }
+        else if ((c & 0xe0) == 0xc0)
+        {
+            code = c & 0x1f;
+            extra = 1;
+        }
+        else if ((c & 0xf0) == 0xe0)
+        {
+            code = c & 0x0f;
+            extra = 2;
+        }
+        else if ((c & 0xf8) == 0xf0)
+        {
+            code = c & 0x07;
+            extra = 3;
         }
-        else if (c == 0xc3)
+        else // Continuation byte without leading byte
         {
-            bufferOut[strlen(bufferOut)] = (bufferIn[++i] + 64);
+            index += 1;
+            continue;
         }
-        else if (c == 0xc2)
+        index += 1;
+
+        // Continuation bytes
+        while ((extra > 0) and (index < length) and (((uint8_t)text[index] & 0xc0) == 0x80))
         {
-            bufferOut[strlen(bufferOut)] = bufferIn[++i];
+            code = (code << 6) | ((uint8_t)text[index] & 0x3f);
+            index += 1;
+            extra -= 1;
         }
-        else if (c == 0xe2)
+
+        if (extra > 0) // Truncated sequence
         {
-            if ((bufferIn[i + 1] == 0x82) && (bufferIn[i + 2] == 0xac))
-            {
-                bufferOut[strlen(bufferOut)] = 0x80;
-                i += 2;
-            }
+            continue;
         }
+        else if (code == 0x20ac) // Euro sign
+        {
+            return 0x80;
+        }
+        else if ((code >= 0xa0) and (code < 0x100))
+        {
+            return code;
+        }
+        // Other characters are not available in ISO-8859-1
     }
 
-    return bufferOut;
+    return 0x00;
+}
+
+size_t utf2iso(const char * text, char * buffer, size_t size)
+{
+    size_t result = 0;
+    size_t index = 0;
+    size_t length = strlen(text);
+    uint8_t c;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    while ((result < size - 1) and ((c = utf2isoNext(text, length, index)) != 0x00))
+    {
+        buffer[result] = c;
+        result += 1;
+    }
+    buffer[result] = 0x00;
+
+    return result;
+}
+
+STRING_TYPE utf2iso(STRING_TYPE s)
+{
+    String result = "";
+    size_t index = 0;
+    uint8_t c;
+
+    result.reserve(s.length());
+    while ((c = utf2isoNext(s.c_str(), s.length(), index)) != 0x00)
+    {
+        result += (char)c;
+    }
+
+    return result;
+}
+
+uint8_t reverseBits(uint8_t value)
+{
+    value = ((value & 0xf0) >> 4) | ((value & 0x0f) << 4);
+    value = ((value & 0xcc) >> 2) | ((value & 0x33) << 2);
+    value = ((value & 0xaa) >> 1) | ((value & 0x55) << 1);
+    return value;
+}
+
+uint32_t hashString(const char * text, size_t length)
+{
+    uint32_t result = 2166136261UL; // FNV offset basis
+
+    for (size_t index = 0; index < length; index += 1)
+    {
+        result ^= (uint8_t)text[index];
+        result *= 16777619UL; // FNV prime
+    }
+
+    return result;
 }
 
 uint16_t checkRange(uint16_t value, uint16_t valueMin, uint16_t valueMax)
@@ -224,3 +333,16 @@ uint32_t roundUp(uint32_t value, uint16_t modulo)
     }
     return result;
 }
+
+bool overlapArea(area_s area1, area_s area2)
+{
+    return ((area1.x1 <= area2.x2) and (area2.x1 <= area1.x2) and (area1.y1 <= area2.y2) and (area2.y1 <= area1.y2));
+}
+
+void mergeArea(area_s & area, area_s other)
+{
+    area.x1 = hV_HAL_min(area.x1, other.x1);
+    area.y1 = hV_HAL_min(area.y1, other.y1);
+    area.x2 = hV_HAL_max(area.x2, other.x2);
+    area.y2 = hV_HAL_max(area.y2, other.y2);
+}
@@ -53,6 +53,19 @@
 /// @}
 ///
 
+///
+/// @brief Area structure
+/// @details Rectangle with inclusive coordinates
+/// @note x1 <= x2 and y1 <= y2 are assumed
+///
+struct area_s
+{
+    uint16_t x1; ///< top left coordinate, x-axis
+    uint16_t y1; ///< top left coordinate, y-axis
+    uint16_t x2; ///< bottom right coordinate, x-axis
+    uint16_t y2; ///< bottom right coordinate, y-axis
+};
+
 ///
 /// @name Utilities
 ///
@@ -92,16 +105,78 @@ int32_t sin32x100(int32_t degreesX100);
 ///
 STRING_TYPE utf2iso(STRING_TYPE s);
 
+///
+/// @brief UTF-8 to ISO-8859-1 Converter, into buffer
+/// @param text UTF-8 null-terminated string, input
+/// @param[out] buffer ISO-8859-1 string, output
+/// @param size size of the buffer, including the final 0x00
+/// @return number of characters written, final 0x00 excluded
+/// @note Reentrant, the conversion stops when the buffer is full
+///
+size_t utf2iso(const char * text, char * buffer, size_t size);
+
+///
+/// @brief UTF-8 to ISO-8859-1 iterator
+/// @param text UTF-8 string
+/// @param length number of bytes of the string
+/// @param[out] index position in the string, moved to the next character
+/// @return ISO-8859-1 character, 0x00 at the end of the string
+/// @note Characters not available in ISO-8859-1 and invalid sequences are skipped.
+/// The euro sign is converted into 0x80.
+///
+/// @code {.cpp}
+/// size_t index = 0;
+/// uint8_t c;
+/// while ((c = utf2isoNext(text, length, index)) != 0x00)
+/// {
+///     // use c
+/// }
+/// @endcode
+///
+uint8_t utf2isoNext(const char * text, size_t length, size_t & index);
+
+///
+/// @brief Reverse the order of the bits of a byte
+/// @param value byte
+/// @return byte with bit 7 swapped with bit 0, bit 6 with bit 1, ...
+///
+uint8_t reverseBits(uint8_t value);
+
+///
+/// @brief Hash of a string
+/// @details FNV-1a, 32-bit
+/// @param text characters
+/// @param length number of characters
+/// @return hash
+/// @note For cache keys, not for security
+///
+uint32_t hashString(const char * text, size_t length);
+
 ///
 /// @brief Format string
 /// @details Based on vsprint
 /// @param format format with standard codes
 /// @param ... list of values
 /// @return string with values formatted
+/// @note Reentrant, string truncated to 127 characters
+/// @note Use formatBuffer() for longer strings or to avoid the String
 /// @see http://www.cplusplus.com/reference/cstdio/printf/?kw=printf for codes
 ///
 STRING_TYPE formatString(const char * format, ...);
 
+///
+/// @brief Format string, into buffer
+/// @details Based on vsnprintf
+/// @param[out] buffer formatted string, output
+/// @param size size of the buffer, including the final 0x00
+/// @param format format with standard codes
+/// @param ... list of values
+/// @return length of the complete formatted string, final 0x00 excluded
+/// @note Reentrant, no memory allocation
+/// @note The string is truncated if the result is equal or greater than size
+///
+size_t formatBuffer(char * buffer, size_t size, const char * format, ...);
+
 ///
 /// @brief Remove leading and ending characters
 /// @param text input text
@@ -153,4 +228,26 @@ uint32_t roundUp(uint32_t value, uint16_t modulo);
 
 /// @}
 
+///
+/// @name Areas
+/// @brief Utilities for rectangular areas
+/// @{
+
+///
+/// @brief Check whether two areas overlap
+/// @param area1 first area
+/// @param area2 second area
+/// @return true if both areas share at least one pixel
+///
+bool overlapArea(area_s area1, area_s area2);
+
+///
+/// @brief Extend an area to include another one
+/// @param[out] area area to extend
+/// @param other area to include
+///
+void mergeArea(area_s & area, area_s other);
+
+/// @}
+
 #endif // hV_UTILITIES_RELEASE
@@ -18,6 +18,8 @@
 // Release 805: Improved stability
 // Release 806: New library for Wide temperature only
 // Release 810: Added support for EXT4 and EPDK-Matter
+// Release 821: Added temperature provider with cache and hysteresis
+// Release 821: Allowed bus suspend without panelPower
 //
 
 // Library header
@@ -28,15 +30,17 @@ hV_Utilities_PDLS::hV_Utilities_PDLS()
     ;
 }
 
-void hV_Utilities_PDLS::u_begin(pins_t board, uint8_t family, uint16_t delayCS)
+void hV_Utilities_PDLS::u_begin(pins_t board, uint8_t family)
 {
-    b_begin(board, family, delayCS);
+    b_begin(board, family);
     u_temperature = 25; // Default = 25 °C
+    u_temperatureMode = UPDATE_FAST;
+    u_flagTemperature = false;
 }
 
 void hV_Utilities_PDLS::u_WhoAmI(char * answer)
 {
-    memcpy(answer, 0x00, strlen(answer));
+    memset(answer, 0x00, strlen(answer));
 
     switch (u_codeFilm)
     {
@@ -163,7 +167,7 @@ uint8_t hV_Utilities_PDLS::screenColours()
 
 void hV_Utilities_PDLS::u_screenNumber(char * answer)
 {
-    memcpy(answer, 0x00, strlen(answer));
+    memset(answer, 0x00, strlen(answer));
 
     // strcpy(answer, u_codeSize);
     sprintf(answer, "%i-%cS-0%c", u_codeSize, u_codeFilm, u_codeDriver);
@@ -210,24 +214,35 @@ void hV_Utilities_PDLS::setTemperatureF(int16_t temperatureF)
 
 uint8_t hV_Utilities_PDLS::checkTemperatureMode(uint8_t updateMode)
 {
+    // Hysteresis narrows the limits to enter a mode, not the limits to stay in it
+    int8_t marginFast = (u_temperatureMode == UPDATE_FAST) ? 0 : u_temperatureHysteresis;
+    int8_t marginGlobal = (u_temperatureMode != UPDATE_NONE) ? 0 : u_temperatureHysteresis;
+
     switch (u_codeFilm)
     {
         case FILM_P: // Film P, Embedded fast update
 
             // Fast 	PS 	Embedded fast update 	FU: +15 to +30 °C 	GU: 0 to +50 °C
-            if (updateMode == UPDATE_FAST) // Fast update
+            if ((u_temperature >= 15 + marginFast) and (u_temperature <= 30 - marginFast))
             {
-                if ((u_temperature < 15) or (u_temperature > 30))
-                {
-                    updateMode = UPDATE_GLOBAL;
-                }
+                u_temperatureMode = UPDATE_FAST;
             }
-            if (updateMode == UPDATE_GLOBAL) // Global update
+            else if ((u_temperature >= 0 + marginGlobal) and (u_temperature <= 50 - marginGlobal))
             {
-                if ((u_temperature < 0) or (u_temperature > 50))
-                {
-                    updateMode = UPDATE_NONE;
-                }
+                u_temperatureMode = UPDATE_GLOBAL;
+            }
+            else
+            {
+                u_temperatureMode = UPDATE_NONE;
+            }
+
+            if ((updateMode == UPDATE_FAST) and (u_temperatureMode != UPDATE_FAST)) // Fast update
+            {
+                updateMode = UPDATE_GLOBAL;
+            }
+            if ((updateMode == UPDATE_GLOBAL) and (u_temperatureMode == UPDATE_NONE)) // Global update
+            {
+                updateMode = UPDATE_NONE;
             }
             break;
 
@@ -288,12 +303,87 @@ uint8_t hV_Utilities_PDLS::checkTemperatureMode(uint8_t updateMode)
     return updateMode;
 }
 
+void hV_Utilities_PDLS::setTemperatureProvider(temperatureProvider_t provider, uint32_t interval)
+{
+    u_temperatureProvider = provider;
+    u_temperatureInterval = interval;
+    u_flagTemperature = false; // Read at next pollTemperature()
+}
+
+bool hV_Utilities_PDLS::pollTemperature()
+{
+    if (u_temperatureProvider == 0)
+    {
+        return RESULT_ERROR;
+    }
+
+    if (u_flagTemperature and (millis() - u_temperatureChrono < u_temperatureInterval))
+    {
+        return RESULT_ERROR;
+    }
+
+    u_temperatureChrono = millis();
+    u_flagTemperature = true;
+
+    int8_t temperatureC = u_temperature;
+    if (u_temperatureProvider(temperatureC) == RESULT_ERROR)
+    {
+        return RESULT_ERROR; // Cached temperature kept
+    }
+
+    u_temperature = temperatureC;
+    return RESULT_SUCCESS;
+}
+
+int8_t hV_Utilities_PDLS::getTemperatureC()
+{
+    return u_temperature;
+}
+
+void hV_Utilities_PDLS::setTemperatureHysteresis(uint8_t hysteresis)
+{
+    u_temperatureHysteresis = hysteresis;
+}
+
+bool temperatureProviderHDC2080(int8_t & temperatureC)
+{
+    static bool flagMeasure = false; // Measurement started by the previous call
+    uint8_t bufferWrite[2];
+    uint8_t bufferRead[2];
+    bool result = RESULT_ERROR;
+
+    hV_HAL_Wire_begin();
+
+    // Result of the previous measurement
+    if (flagMeasure)
+    {
+        bufferWrite[0] = 0x00; // Temperature, low byte then high byte
+        hV_HAL_Wire_transfer(HDC2080_I2C_ADDRESS, bufferWrite, 1, bufferRead, 2);
+
+        uint32_t raw = bufferRead[0] | (bufferRead[1] << 8);
+        temperatureC = (int8_t)((int32_t)((raw * 165 + 32768) >> 16) - 40); // T = raw * 165 / 2^16 - 40
+        result = RESULT_SUCCESS;
+    }
+
+    // Next measurement, ready well before the next call
+    bufferWrite[0] = 0x0f; // Measurement configuration
+    bufferWrite[1] = 0x03; // Temperature only, start
+    hV_HAL_Wire_transfer(HDC2080_I2C_ADDRESS, bufferWrite, 2);
+    flagMeasure = true;
+
+    return result;
+}
+//
+// === End of Temperature section
+//
+
 void hV_Utilities_PDLS::setPowerProfile(uint8_t mode, uint8_t scope)
 {
     u_suspendMode = mode;
     u_suspendScope = scope;
 
-    if (b_pin.panelPower == NOT_CONNECTED)
+    // Bus suspend does not require panelPower
+    if ((b_pin.panelPower == NOT_CONNECTED) and (scope != POWER_SCOPE_BUS_GPIO))
     {
         u_suspendMode = POWER_MODE_MANUAL;
         u_suspendScope = POWER_SCOPE_NONE;
@@ -65,6 +65,31 @@
 ///
 #define hV_UTILITIES_PDLS_RELEASE 812
 
+///
+/// @brief Temperature provider
+/// @param[out] temperatureC temperature in °C
+/// @return RESULT_SUCCESS or RESULT_ERROR, temperatureC unchanged on error
+/// @note Called by pollTemperature() only, never by flush()
+///
+typedef bool (*temperatureProvider_t)(int8_t & temperatureC);
+
+///
+/// @name Temperature provider
+/// @{
+#define TEMPERATURE_INTERVAL_DEFAULT 60000 ///< Refresh interval of the provider, 60 s
+#define HDC2080_I2C_ADDRESS 0x40 ///< HDC2080 temperature and humidity sensor, EXT4 board
+/// @}
+
+///
+/// @brief Temperature provider for the HDC2080 sensor of the EXT4 board
+/// @param[out] temperatureC temperature in °C
+/// @return RESULT_SUCCESS or RESULT_ERROR
+/// @details Each call reads the measurement started by the previous call and starts the next one,
+/// so no call waits for the conversion.
+/// @note The first call only starts a measurement and returns RESULT_ERROR.
+///
+bool temperatureProviderHDC2080(int8_t & temperatureC);
+
 // Objects
 //
 ///
@@ -102,10 +127,54 @@ class hV_Utilities_PDLS : public hV_Board
     ///
     uint8_t checkTemperatureMode(uint8_t updateMode);
 
+    ///
+    /// @brief Set the temperature provider
+    /// @param provider function, for example temperatureProviderHDC2080, 0 = none
+    /// @param interval minimum time between two readings, ms, default = TEMPERATURE_INTERVAL_DEFAULT
+    /// @note The provider is called by pollTemperature() only
+    ///
+    /// @code {.cpp}
+    /// myScreen.setTemperatureProvider(temperatureProviderHDC2080, 30000);
+    /// myScreen.setTemperatureHysteresis(2);
+    ///
+    /// void loop()
+    /// {
+    ///     myScreen.pollTemperature();
+    ///     // ...
+    ///     myScreen.flush(); // uses the cached temperature
+    /// }
+    /// @endcode
+    ///
+    void setTemperatureProvider(temperatureProvider_t provider, uint32_t interval = TEMPERATURE_INTERVAL_DEFAULT);
+
+    ///
+    /// @brief Poll the temperature provider
+    /// @details Call the provider if the interval has elapsed and update the cached temperature
+    /// @return RESULT_SUCCESS if the cached temperature was updated, RESULT_ERROR otherwise
+    /// @note Call it from loop(), it returns immediately until the interval has elapsed
+    ///
+    bool pollTemperature();
+
+    ///
+    /// @brief Get the cached temperature
+    /// @return temperature in °C, as used by checkTemperatureMode()
+    ///
+    int8_t getTemperatureC();
+
+    ///
+    /// @brief Set the hysteresis band around the temperature limits of film P
+    /// @param hysteresis band in °C, default = 0 = no hysteresis
+    /// @details A mode is entered when the temperature is inside its limits narrowed by the band,
+    /// and left only when the temperature is outside its limits
+    /// @n With hysteresis = 2, fast update starts at 17 °C and stops below 15 °C
+    ///
+    void setTemperatureHysteresis(uint8_t hysteresis = 0);
+
     /// @brief Set the power profile
     /// @param mode default = POWER_MODE_AUTO, otherwise POWER_MODE_MANUAL
-    /// @param scope default = POWER_SCOPE_GPIO_ONLY, otherwise POWER_SCOPE_NONE
+    /// @param scope default = POWER_SCOPE_GPIO_ONLY, otherwise POWER_SCOPE_NONE or POWER_SCOPE_BUS_GPIO
     /// @note If panelPower is NOT_CONNECTED, (POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY) defaults to (POWER_MODE_MANUAL, POWER_SCOPE_NONE)
+    /// @note POWER_SCOPE_BUS_GPIO releases the SPI bus even if panelPower is NOT_CONNECTED
     ///
     void setPowerProfile(uint8_t mode = POWER_MODE_AUTO, uint8_t scope = POWER_SCOPE_GPIO_ONLY);
 
@@ -145,7 +214,7 @@ class hV_Utilities_PDLS : public hV_Board
     ///
     /// @brief Initialisation
     ///
-    void u_begin(pins_t board, uint8_t family, uint16_t delayCS);
+    void u_begin(pins_t board, uint8_t family);
 
     ///
     /// @brief Screen extra specifications for WhoAmI()
@@ -163,6 +232,12 @@ class hV_Utilities_PDLS : public hV_Board
     // Screen dependent variables
     eScreen_EPD_t u_eScreen_EPD;
     int8_t u_temperature = 25;
+    temperatureProvider_t u_temperatureProvider = 0;
+    uint32_t u_temperatureInterval = TEMPERATURE_INTERVAL_DEFAULT;
+    uint32_t u_temperatureChrono = 0;
+    bool u_flagTemperature = false; // Provider read at least once
+    uint8_t u_temperatureHysteresis = 0;
+    uint8_t u_temperatureMode = UPDATE_FAST; // Best mode for the temperature, with hysteresis
     uint16_t u_codeSize;
     uint8_t u_codeFilm;
     uint8_t u_codeDriver;
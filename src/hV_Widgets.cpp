@@ -0,0 +1,492 @@
+//
+// hV_Widgets.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 19 Oct 2026
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+// For exclusive use with Pervasive Displays screens
+//
+// See hV_Widgets.h for references
+//
+// Release 821: Initial release
+//
+
+// Library header
+#include "hV_Widgets.h"
+#include "stdio.h"
+
+// Code
+// Widget
+hV_Widget::hV_Widget()
+{
+    w_area = { 0, 0, 0, 0 };
+    w_frontColour = myColours.black;
+    w_backColour = myColours.white;
+    w_areaDrawn = { 0, 0, 0, 0 };
+    w_areaErased = { 0, 0, 0, 0 };
+    w_dirty = true;
+    w_visible = true;
+    w_drawn = false;
+    w_erased = false;
+    w_next = 0; // nullptr
+}
+
+void hV_Widget::setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    w_area.x1 = x0;
+    w_area.y1 = y0;
+    w_area.x2 = x0 + hV_HAL_max(dx, 1) - 1;
+    w_area.y2 = y0 + hV_HAL_max(dy, 1) - 1;
+    w_dirty = true;
+}
+
+area_s hV_Widget::getArea()
+{
+    return w_area;
+}
+
+void hV_Widget::setColours(uint16_t frontColour, uint16_t backColour)
+{
+    if ((frontColour != w_frontColour) or (backColour != w_backColour))
+    {
+        w_frontColour = frontColour;
+        w_backColour = backColour;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget::setVisible(bool flag)
+{
+    if (flag != w_visible)
+    {
+        w_visible = flag;
+        w_dirty = true;
+    }
+}
+
+bool hV_Widget::isDirty()
+{
+    return w_dirty;
+}
+
+void hV_Widget::invalidate()
+{
+    w_dirty = true;
+}
+
+void hV_Widget::draw(hV_Screen_Buffer * screen)
+{
+    // Previous area, if moved or hidden
+    w_erase(screen);
+
+    if (w_visible)
+    {
+        w_render(screen, w_area);
+        w_areaDrawn = w_area;
+        w_drawn = true;
+    }
+    w_dirty = false;
+}
+
+bool hV_Widget::w_erase(hV_Screen_Buffer * screen)
+{
+    bool flagSame = (w_area.x1 == w_areaDrawn.x1) and (w_area.y1 == w_areaDrawn.y1) and (w_area.x2 == w_areaDrawn.x2) and (w_area.y2 == w_areaDrawn.y2);
+
+    if ((w_drawn == false) or (w_visible and flagSame))
+    {
+        return false;
+    }
+
+    bool penSolid = screen->getPenSolid();
+    screen->setPenSolid(true);
+    screen->rectangle(w_areaDrawn.x1, w_areaDrawn.y1, w_areaDrawn.x2, w_areaDrawn.y2, w_backColour);
+    screen->setPenSolid(penSolid);
+
+    w_areaErased = w_areaDrawn;
+    w_drawn = false;
+    return true;
+}
+
+void hV_Widget::w_render(hV_Screen_Buffer * screen, area_s clip)
+{
+    uint16_t dx = w_area.x2 - w_area.x1 + 1;
+    uint16_t dy = w_area.y2 - w_area.y1 + 1;
+
+    // Local coordinates, drawing limited to the area and to the clip
+    if (screen->pushViewport(w_area.x1, w_area.y1, dx, dy) == RESULT_ERROR)
+    {
+        return;
+    }
+    screen->setClip(clip.x1 - w_area.x1, clip.y1 - w_area.y1, clip.x2 - clip.x1 + 1, clip.y2 - clip.y1 + 1);
+
+    // Background, then content with wire frame pen, pen state of the caller restored
+    bool penSolid = screen->getPenSolid();
+    screen->setPenSolid(true);
+    screen->rectangle(0, 0, dx - 1, dy - 1, w_backColour);
+    screen->setPenSolid(false);
+
+    w_paint(screen);
+
+    screen->setPenSolid(penSolid);
+    screen->popViewport();
+}
+
+// Label
+hV_Widget_Label::hV_Widget_Label()
+{
+    w_text[0] = 0x00;
+    w_font = 0;
+}
+
+void hV_Widget_Label::setFont(uint8_t font)
+{
+    if (font != w_font)
+    {
+        w_font = font;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget_Label::setText(STRING_CONST_TYPE text)
+{
+    setText(text.c_str());
+}
+
+void hV_Widget_Label::setText(const char * text)
+{
+    if (strncmp(text, w_text, WIDGET_TEXT_SIZE - 1) != 0)
+    {
+        strncpy(w_text, text, WIDGET_TEXT_SIZE - 1);
+        w_text[WIDGET_TEXT_SIZE - 1] = 0x00;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget_Label::w_paint(hV_Screen_Buffer * screen)
+{
+    uint8_t font = screen->getFont();
+
+    screen->selectFont(w_font);
+    screen->gText(0, 0, w_text, w_frontColour, w_backColour);
+    screen->selectFont(font);
+}
+
+// Value
+hV_Widget_Value::hV_Widget_Value()
+{
+    w_value = 0;
+    w_decimals = 0;
+    w_unit[0] = 0x00;
+    w_font = 0;
+}
+
+void hV_Widget_Value::setFont(uint8_t font)
+{
+    if (font != w_font)
+    {
+        w_font = font;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget_Value::setFormat(uint8_t decimals, STRING_CONST_TYPE unit)
+{
+    setFormat(decimals, unit.c_str());
+}
+
+void hV_Widget_Value::setFormat(uint8_t decimals, const char * unit)
+{
+    w_decimals = hV_HAL_min(decimals, 4);
+    strncpy(w_unit, unit, WIDGET_UNIT_SIZE - 1);
+    w_unit[WIDGET_UNIT_SIZE - 1] = 0x00;
+    w_dirty = true;
+}
+
+void hV_Widget_Value::setValue(int32_t value)
+{
+    if (value != w_value)
+    {
+        w_value = value;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget_Value::w_paint(hV_Screen_Buffer * screen)
+{
+    // Worst case: sign, 10 digits, point, 4 decimals, space, unit and final 0x00, 25 characters
+    char text[32];
+    int length;
+    uint32_t magnitude = (w_value < 0) ? -(uint32_t)w_value : w_value;
+    const char * sign = (w_value < 0) ? "-" : "";
+
+    if (w_decimals > 0)
+    {
+        uint32_t divider = 1;
+        for (uint8_t index = 0; index < w_decimals; index += 1)
+        {
+            divider *= 10;
+        }
+        length = snprintf(text, sizeof(text), "%s%lu.%0*lu %s", sign, (unsigned long)(magnitude / divider), w_decimals, (unsigned long)(magnitude % divider), w_unit);
+    }
+    else
+    {
+        length = snprintf(text, sizeof(text), "%s%lu %s", sign, (unsigned long)magnitude, w_unit);
+    }
+
+    if ((length < 0) or (length >= (int)sizeof(text)))
+    {
+        return;
+    }
+
+    uint8_t font = screen->getFont();
+    screen->selectFont(w_font);
+    screen->gText(0, 0, text, w_frontColour, w_backColour);
+    screen->selectFont(font);
+}
+
+// Bar
+hV_Widget_Bar::hV_Widget_Bar()
+{
+    w_value = 0;
+    w_minimum = 0;
+    w_maximum = 100;
+}
+
+void hV_Widget_Bar::setRange(int32_t minimum, int32_t maximum)
+{
+    w_minimum = hV_HAL_min(minimum, maximum);
+    w_maximum = hV_HAL_max(minimum, maximum);
+    w_dirty = true;
+}
+
+uint16_t hV_Widget_Bar::w_fill(int32_t value)
+{
+    // Inner length, within the border
+    uint16_t dx = w_area.x2 - w_area.x1 + 1;
+    uint16_t dy = w_area.y2 - w_area.y1 + 1;
+    uint16_t length = (dx >= dy) ? dx : dy;
+    length = (length > 2) ? length - 2 : 0;
+
+    if ((w_maximum == w_minimum) or (value <= w_minimum))
+    {
+        return 0;
+    }
+    if (value >= w_maximum)
+    {
+        return length;
+    }
+    return (uint16_t)(((int64_t)(value - w_minimum) * length) / (w_maximum - w_minimum));
+}
+
+void hV_Widget_Bar::setValue(int32_t value)
+{
+    // Redraw only if the filled length changes
+    if (w_fill(value) != w_fill(w_value))
+    {
+        w_dirty = true;
+    }
+    w_value = value;
+}
+
+void hV_Widget_Bar::w_paint(hV_Screen_Buffer * screen)
+{
+    uint16_t fill = w_fill(w_value);
+    uint16_t x2 = w_area.x2 - w_area.x1;
+    uint16_t y2 = w_area.y2 - w_area.y1;
+
+    screen->rectangle(0, 0, x2, y2, w_frontColour);
+
+    if (fill > 0)
+    {
+        bool penSolid = screen->getPenSolid();
+        screen->setPenSolid(true);
+        if (x2 >= y2)
+        {
+            // Horizontal, from left
+            screen->rectangle(1, 1, fill, y2 - 1, w_frontColour);
+        }
+        else
+        {
+            // Vertical, from bottom
+            screen->rectangle(1, y2 - fill, x2 - 1, y2 - 1, w_frontColour);
+        }
+        screen->setPenSolid(penSolid);
+    }
+}
+
+// Icon
+hV_Widget_Icon::hV_Widget_Icon()
+{
+    w_bitmap = 0; // nullptr
+    w_width = 0;
+    w_height = 0;
+}
+
+void hV_Widget_Icon::setIcon(const uint8_t * bitmap, uint16_t width, uint16_t height)
+{
+    if ((bitmap != w_bitmap) or (width != w_width) or (height != w_height))
+    {
+        w_bitmap = bitmap;
+        w_width = width;
+        w_height = height;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget_Icon::w_paint(hV_Screen_Buffer * screen)
+{
+    if (w_bitmap == 0)
+    {
+        return;
+    }
+
+    // Trimmed to the area by the viewport
+    screen->drawBitmap(0, 0, w_width, w_height, w_bitmap, 0, w_frontColour, w_backColour, true);
+}
+
+// Frame
+hV_Widget_Frame::hV_Widget_Frame()
+{
+    w_thickness = 1;
+}
+
+void hV_Widget_Frame::setThickness(uint8_t thickness)
+{
+    if (thickness != w_thickness)
+    {
+        w_thickness = thickness;
+        w_dirty = true;
+    }
+}
+
+void hV_Widget_Frame::w_paint(hV_Screen_Buffer * screen)
+{
+    uint16_t x2 = w_area.x2 - w_area.x1;
+    uint16_t y2 = w_area.y2 - w_area.y1;
+
+    for (uint8_t index = 0; index < w_thickness; index += 1)
+    {
+        if ((index > x2 - index) or (index > y2 - index))
+        {
+            break;
+        }
+        screen->rectangle(index, index, x2 - index, y2 - index, w_frontColour);
+    }
+}
+
+// Layer
+hV_Widget_Layer::hV_Widget_Layer()
+{
+    w_first = 0; // nullptr
+    w_last = 0; // nullptr
+}
+
+void hV_Widget_Layer::add(hV_Widget * widget)
+{
+    widget->w_next = 0; // nullptr
+    if (w_first == 0)
+    {
+        w_first = widget;
+    }
+    else
+    {
+        w_last->w_next = widget;
+    }
+    w_last = widget;
+    widget->w_dirty = true;
+}
+
+void hV_Widget_Layer::invalidate()
+{
+    for (hV_Widget * widget = w_first; widget != 0; widget = widget->w_next)
+    {
+        widget->w_dirty = true;
+    }
+}
+
+void hV_Widget_Layer::w_addArea(area_s * area, area_s other, bool flagFirst)
+{
+    if (area != 0)
+    {
+        if (flagFirst)
+        {
+            *area = other;
+        }
+        else
+        {
+            mergeArea(*area, other);
+        }
+    }
+}
+
+uint16_t hV_Widget_Layer::update(hV_Screen_Buffer * screen, area_s * area)
+{
+    uint16_t result = 0;
+    bool flagFirst = true;
+
+    // Erase the previous areas of the moved and hidden widgets first,
+    // so the widgets below are restored before the widgets above
+    for (hV_Widget * widget = w_first; widget != 0; widget = widget->w_next)
+    {
+        if (widget->w_dirty)
+        {
+            widget->w_erased = widget->w_erase(screen);
+            if (widget->w_erased)
+            {
+                w_addArea(area, widget->w_areaErased, flagFirst);
+                flagFirst = false;
+            }
+        }
+    }
+
+    for (hV_Widget * widget = w_first; widget != 0; widget = widget->w_next)
+    {
+        if (widget->w_dirty)
+        {
+            widget->draw(screen);
+
+            if (widget->w_drawn)
+            {
+                // The background was cleared, so the widgets drawn after and overlapping need to be redrawn
+                for (hV_Widget * other = widget->w_next; other != 0; other = other->w_next)
+                {
+                    if (overlapArea(widget->w_area, other->w_area))
+                    {
+                        other->w_dirty = true;
+                    }
+                }
+
+                w_addArea(area, widget->w_area, flagFirst);
+                flagFirst = false;
+            }
+            result += 1;
+        }
+        else if (widget->w_drawn)
+        {
+            // Restore the parts of the unchanged widgets within the erased areas, before or after
+            bool flagRestored = false;
+            for (hV_Widget * other = w_first; other != 0; other = other->w_next)
+            {
+                if (other->w_erased and overlapArea(other->w_areaErased, widget->w_area))
+                {
+                    widget->w_render(screen, other->w_areaErased);
+                    flagRestored = true;
+                }
+            }
+            result += flagRestored ? 1 : 0;
+        }
+    }
+
+    for (hV_Widget * widget = w_first; widget != 0; widget = widget->w_next)
+    {
+        widget->w_erased = false;
+    }
+
+    return result;
+}
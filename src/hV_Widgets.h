@@ -0,0 +1,428 @@
+///
+/// @file hV_Widgets.h
+/// @brief Retained widgets with dirty-region tracking
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The widgets keep their state and their area.
+/// Only the widgets whose state has changed are redrawn,
+/// with the background cleared within their area only.
+/// The previous area of a moved or hidden widget is erased
+/// and the widgets below are restored within it.
+///
+/// @author Rei Vilo
+/// @date 19 Oct 2026
+/// @version 821
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+// Checks
+#if (hV_SCREEN_BUFFER_RELEASE < 812)
+#error Required hV_SCREEN_BUFFER_RELEASE 812
+#endif // hV_SCREEN_BUFFER_RELEASE
+
+#ifndef hV_WIDGETS_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_WIDGETS_RELEASE 821
+
+///
+/// @name Widget constants
+/// @{
+#define WIDGET_TEXT_SIZE 32 ///< maximum size of the text of a label, including the final 0x00
+#define WIDGET_UNIT_SIZE 8 ///< maximum size of the unit of a value, including the final 0x00
+/// @}
+
+// Objects
+//
+///
+/// @brief Generic widget class
+/// @details A widget has an area, a pair of colours and a dirty flag.
+/// @note The widget is redrawn only when dirty.
+///
+class hV_Widget
+{
+    friend class hV_Widget_Layer;
+
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget();
+
+    ///
+    /// @brief Set the area of the widget
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width
+    /// @param dy height
+    /// @note The previous area is erased on the next draw
+    ///
+    void setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Get the area of the widget
+    /// @return area
+    ///
+    area_s getArea();
+
+    ///
+    /// @brief Set the colours
+    /// @param frontColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    ///
+    void setColours(uint16_t frontColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Show or hide the widget
+    /// @param flag true = visible, false = hidden
+    /// @note The area of a hidden widget is erased with the background colour
+    ///
+    void setVisible(bool flag = true);
+
+    ///
+    /// @brief Check whether the widget requires to be redrawn
+    /// @return true if the state has changed since the last draw
+    ///
+    bool isDirty();
+
+    ///
+    /// @brief Force the widget to be redrawn
+    ///
+    void invalidate();
+
+    ///
+    /// @brief Draw the widget
+    /// @param screen target screen
+    /// @note The background is cleared within the area of the widget
+    /// @note The previous area, if moved or hidden, is erased first
+    /// @note Drawing within a viewport, so up to VIEWPORT_MAX - 1 viewports may be open
+    /// @note The pen state of the screen is preserved
+    ///
+    void draw(hV_Screen_Buffer * screen);
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Draw the content of the widget
+    /// @param screen target screen
+    /// @note Called by draw() after the background is cleared, with wire frame pen
+    /// @note Coordinates relative to the top left corner of the area, drawing limited to the area
+    ///
+    virtual void w_paint(hV_Screen_Buffer * screen) = 0;
+
+    ///
+    /// @brief Erase the previous area, if moved or hidden
+    /// @param screen target screen
+    /// @return true if erased
+    ///
+    bool w_erase(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Clear the background and draw the content within a clip area
+    /// @param screen target screen
+    /// @param clip clip area, screen coordinates
+    ///
+    void w_render(hV_Screen_Buffer * screen, area_s clip);
+
+    area_s w_area; ///< area to draw
+    area_s w_areaDrawn; ///< area drawn on the screen, valid if w_drawn
+    area_s w_areaErased; ///< area erased during the current update, valid if w_erased
+    uint16_t w_frontColour, w_backColour;
+    bool w_dirty, w_visible, w_drawn, w_erased;
+    hV_Widget * w_next;
+
+    /// @endcond
+};
+
+///
+/// @brief Label widget
+/// @details Single line of text
+///
+class hV_Widget_Label : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget_Label();
+
+    ///
+    /// @brief Select the font
+    /// @param font font number
+    ///
+    void setFont(uint8_t font);
+
+    ///
+    /// @brief Set the text
+    /// @param text text, up to WIDGET_TEXT_SIZE - 1 characters
+    /// @note The widget becomes dirty only if the text has changed
+    ///
+    void setText(STRING_CONST_TYPE text);
+
+    ///
+    /// @brief Set the text
+    /// @param text null-terminated string, up to WIDGET_TEXT_SIZE - 1 characters
+    /// @note The widget becomes dirty only if the text has changed
+    ///
+    void setText(const char * text);
+
+  protected:
+    /// @cond
+
+    void w_paint(hV_Screen_Buffer * screen);
+
+    char w_text[WIDGET_TEXT_SIZE];
+    uint8_t w_font;
+
+    /// @endcond
+};
+
+///
+/// @brief Value widget
+/// @details Fixed-point value with unit
+///
+class hV_Widget_Value : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget_Value();
+
+    ///
+    /// @brief Select the font
+    /// @param font font number
+    ///
+    void setFont(uint8_t font);
+
+    ///
+    /// @brief Define the format
+    /// @param decimals number of decimals, 0..4
+    /// @param unit unit, up to WIDGET_UNIT_SIZE - 1 characters
+    /// @note Example: value 2145 with 2 decimals and unit "oC" is displayed as 21.45 oC
+    ///
+    void setFormat(uint8_t decimals, STRING_CONST_TYPE unit);
+
+    ///
+    /// @brief Define the format
+    /// @param decimals number of decimals, 0..4
+    /// @param unit null-terminated string, up to WIDGET_UNIT_SIZE - 1 characters
+    /// @note No memory is allocated
+    ///
+    void setFormat(uint8_t decimals, const char * unit = "");
+
+    ///
+    /// @brief Set the value
+    /// @param value value, scaled by 10 ^ decimals
+    /// @note The widget becomes dirty only if the value has changed
+    ///
+    void setValue(int32_t value);
+
+  protected:
+    /// @cond
+
+    void w_paint(hV_Screen_Buffer * screen);
+
+    int32_t w_value;
+    uint8_t w_decimals;
+    char w_unit[WIDGET_UNIT_SIZE];
+    uint8_t w_font;
+
+    /// @endcond
+};
+
+///
+/// @brief Bar widget
+/// @details Horizontal bar if wider than high, vertical bar otherwise
+///
+class hV_Widget_Bar : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget_Bar();
+
+    ///
+    /// @brief Define the range
+    /// @param minimum value for empty bar
+    /// @param maximum value for full bar
+    ///
+    void setRange(int32_t minimum, int32_t maximum);
+
+    ///
+    /// @brief Set the value
+    /// @param value value, within the range
+    /// @note The widget becomes dirty only if the filled length has changed
+    ///
+    void setValue(int32_t value);
+
+  protected:
+    /// @cond
+
+    void w_paint(hV_Screen_Buffer * screen);
+    uint16_t w_fill(int32_t value);
+
+    int32_t w_value, w_minimum, w_maximum;
+
+    /// @endcond
+};
+
+///
+/// @brief Icon widget
+/// @details Monochrome bitmap, one bit per pixel, rows padded to bytes, MSB first
+///
+class hV_Widget_Icon : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget_Icon();
+
+    ///
+    /// @brief Set the icon
+    /// @param bitmap bitmap, width x height pixels
+    /// @param width width of the bitmap
+    /// @param height height of the bitmap
+    /// @note The widget becomes dirty only if the bitmap has changed
+    ///
+    void setIcon(const uint8_t * bitmap, uint16_t width, uint16_t height);
+
+  protected:
+    /// @cond
+
+    void w_paint(hV_Screen_Buffer * screen);
+
+    const uint8_t * w_bitmap;
+    uint16_t w_width, w_height;
+
+    /// @endcond
+};
+
+///
+/// @brief Frame widget
+/// @details Rectangle border
+///
+class hV_Widget_Frame : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget_Frame();
+
+    ///
+    /// @brief Set the thickness of the border
+    /// @param thickness thickness, pixels
+    ///
+    void setThickness(uint8_t thickness);
+
+  protected:
+    /// @cond
+
+    void w_paint(hV_Screen_Buffer * screen);
+
+    uint8_t w_thickness;
+
+    /// @endcond
+};
+
+///
+/// @brief Layer of widgets
+/// @details The layer links the widgets and redraws the dirty ones.
+/// @note No memory is allocated by the layer.
+///
+/// @code {.cpp}
+/// hV_Widget_Layer myLayer;
+/// hV_Widget_Value myTemperature;
+///
+/// myTemperature.setArea(10, 10, 100, 20);
+/// myTemperature.setFormat(1, "oC");
+/// myLayer.add(&myTemperature);
+///
+/// myTemperature.setValue(215);
+/// if (myLayer.update(&myScreen) > 0)
+/// {
+///     myScreen.flush();
+/// }
+/// @endcode
+///
+class hV_Widget_Layer
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Widget_Layer();
+
+    ///
+    /// @brief Add a widget to the layer
+    /// @param widget widget
+    /// @note Widgets are drawn in the order they are added, so containers like frames go first
+    ///
+    void add(hV_Widget * widget);
+
+    ///
+    /// @brief Force all the widgets to be redrawn
+    ///
+    void invalidate();
+
+    ///
+    /// @brief Redraw the dirty widgets
+    /// @param screen target screen
+    /// @param[out] area area covering all the redrawn widgets, optional
+    /// @return number of widgets redrawn, 0 if none
+    /// @note Call flush() only if the result is greater than 0
+    /// @note A redrawn widget also triggers the redraw of the widgets added after it and overlapping its area
+    /// @note The previous area of a moved or hidden widget is erased first,
+    /// then the unchanged widgets, added before or after, are restored within it
+    ///
+    uint16_t update(hV_Screen_Buffer * screen, area_s * area = 0);
+
+  protected:
+    /// @cond
+
+    void w_addArea(area_s * area, area_s other, bool flagFirst);
+
+    hV_Widget * w_first;
+    hV_Widget * w_last;
+
+    /// @endcond
+};
+
+#endif // hV_WIDGETS_RELEASE